@@ -276,6 +276,15 @@ bool RenderInterface_GL2::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL2::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& offset,
+	const Rml::Vector2i& dimensions)
+{
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, dimensions.x, dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+
+	return true;
+}
+
 void RenderInterface_GL2::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	glDeleteTextures(1, (GLuint*)&texture_handle);
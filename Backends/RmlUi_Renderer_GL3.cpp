@@ -339,6 +339,13 @@ struct CompiledGeometryData {
 	GLsizei draw_count;
 };
 
+// Buffers shared by all draw lists, their contents are replaced for each draw list.
+struct DrawListBuffers {
+	GLuint vao;
+	GLuint vbo;
+	GLuint ibo;
+};
+
 struct Shaders {
 	GLuint vert_main;
 	GLuint frag_main_color;
@@ -389,6 +396,7 @@ enum class FramebufferAttachment { None, Depth, DepthStencil };
 
 static Shaders shaders = {};
 static Programs programs = {};
+static DrawListBuffers draw_list_buffers = {};
 static ProgramId active_program = ProgramId::None;
 static Rml::Matrix4f projection;
 
@@ -738,6 +746,33 @@ static void DestroyShaders()
 	programs = {};
 }
 
+// Sets up the vertex attributes of the currently bound vertex array, sourced from the currently bound array buffer.
+static void SetupVertexAttributes()
+{
+	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Position);
+	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Position, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, position)));
+
+	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Color0);
+	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Color0, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, colour)));
+
+	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::TexCoord0);
+	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::TexCoord0, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
+		(const GLvoid*)(offsetof(Rml::Vertex, tex_coord)));
+}
+
+static void DestroyDrawListBuffers()
+{
+	if (draw_list_buffers.vao)
+	{
+		glDeleteVertexArrays(1, &draw_list_buffers.vao);
+		glDeleteBuffers(1, &draw_list_buffers.vbo);
+		glDeleteBuffers(1, &draw_list_buffers.ibo);
+	}
+	draw_list_buffers = {};
+}
+
 static void DrawFullscreenQuad(Rml::Vector2f uv_offset = {}, Rml::Vector2f uv_scaling = Rml::Vector2f(1.f))
 {
 	// Draw a fullscreen quad.
@@ -835,17 +870,7 @@ Rml::CompiledGeometryHandle RenderInterface_GL3::CompileGeometry(Rml::Vertex* ve
 	glBindBuffer(GL_ARRAY_BUFFER, vbo);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Vertex) * num_vertices, (const void*)vertices, draw_usage);
 
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Position);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Position, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, position)));
-
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::Color0);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::Color0, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, colour)));
-
-	glEnableVertexAttribArray((GLuint)Gfx::VertexAttribute::TexCoord0);
-	glVertexAttribPointer((GLuint)Gfx::VertexAttribute::TexCoord0, 2, GL_FLOAT, GL_FALSE, sizeof(Rml::Vertex),
-		(const GLvoid*)(offsetof(Rml::Vertex, tex_coord)));
+	Gfx::SetupVertexAttributes();
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
 	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int) * num_indices, (const void*)indices, draw_usage);
@@ -867,22 +892,7 @@ void RenderInterface_GL3::RenderCompiledGeometry(Rml::CompiledGeometryHandle han
 {
 	Gfx::CompiledGeometryData* geometry = (Gfx::CompiledGeometryData*)handle;
 
-	if (geometry->texture == TexturePostprocess)
-	{
-		// Do nothing.
-	}
-	else if (geometry->texture)
-	{
-		Gfx::UseProgram(ProgramId::Texture);
-		SubmitTransformUniform(translation);
-		if (geometry->texture != TextureIgnoreBinding)
-			glBindTexture(GL_TEXTURE_2D, (GLuint)geometry->texture);
-	}
-	else
-	{
-		Gfx::UseProgram(ProgramId::Color);
-		SubmitTransformUniform(translation);
-	}
+	UseGeometryProgram(geometry->texture, translation);
 
 	glBindVertexArray(geometry->vao);
 	glDrawElements(GL_TRIANGLES, geometry->draw_count, GL_UNSIGNED_INT, (const GLvoid*)0);
@@ -901,6 +911,46 @@ void RenderInterface_GL3::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle ha
 	delete geometry;
 }
 
+bool RenderInterface_GL3::SupportsDrawLists()
+{
+	return true;
+}
+
+void RenderInterface_GL3::RenderDrawList(const Rml::DrawList& draw_list)
+{
+	Gfx::DrawListBuffers& buffers = Gfx::draw_list_buffers;
+	if (!buffers.vao)
+	{
+		glGenVertexArrays(1, &buffers.vao);
+		glGenBuffers(1, &buffers.vbo);
+		glGenBuffers(1, &buffers.ibo);
+
+		glBindVertexArray(buffers.vao);
+		glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo);
+		Gfx::SetupVertexAttributes();
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers.ibo);
+	}
+	else
+	{
+		glBindVertexArray(buffers.vao);
+	}
+
+	// Respecify the buffers for every draw list, so that the driver does not have to wait for previous draw calls using them.
+	glBindBuffer(GL_ARRAY_BUFFER, buffers.vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Rml::Vertex) * draw_list.vertices.size(), (const void*)draw_list.vertices.data(), GL_STREAM_DRAW);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(int) * draw_list.indices.size(), (const void*)draw_list.indices.data(), GL_STREAM_DRAW);
+
+	for (const Rml::DrawListCommand& command : draw_list.commands)
+	{
+		UseGeometryProgram(command.texture, Rml::Vector2f(0.f));
+		glDrawElements(GL_TRIANGLES, command.num_indices, GL_UNSIGNED_INT, (const GLvoid*)(sizeof(int) * command.index_offset));
+	}
+
+	glBindVertexArray(0);
+
+	Gfx::CheckGLError("RenderDrawList");
+}
+
 void RenderInterface_GL3::EnableScissorRegion(bool enable)
 {
 	if (enable)
@@ -1128,6 +1178,31 @@ bool RenderInterface_GL3::GenerateTexture(Rml::TextureHandle& texture_handle, co
 	return true;
 }
 
+bool RenderInterface_GL3::UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& offset,
+	const Rml::Vector2i& dimensions)
+{
+#if RMLUI_PREMULTIPLIED_ALPHA
+	using Rml::byte;
+	const size_t num_bytes = dimensions.x * dimensions.y * 4;
+	Rml::UniquePtr<byte[]> source_premultiplied(new byte[num_bytes]);
+
+	for (size_t i = 0; i < num_bytes; i += 4)
+	{
+		const byte alpha = source[i + 3];
+		for (size_t j = 0; j < 3; j++)
+			source_premultiplied[i + j] = byte((int(source[i + j]) * int(alpha)) / 255);
+		source_premultiplied[i + 3] = alpha;
+	}
+
+	source = source_premultiplied.get();
+#endif
+
+	glBindTexture(GL_TEXTURE_2D, (GLuint)texture_handle);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, offset.x, offset.y, dimensions.x, dimensions.y, GL_RGBA, GL_UNSIGNED_BYTE, source);
+
+	return true;
+}
+
 void RenderInterface_GL3::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	glDeleteTextures(1, (GLuint*)&texture_handle);
@@ -1958,6 +2033,26 @@ Rml::TextureHandle RenderInterface_GL3::PopLayer(Rml::RenderTarget render_target
 	return texture_handle_result;
 }
 
+void RenderInterface_GL3::UseGeometryProgram(Rml::TextureHandle texture, Rml::Vector2f translation)
+{
+	if (texture == TexturePostprocess)
+	{
+		// Do nothing.
+	}
+	else if (texture)
+	{
+		Gfx::UseProgram(ProgramId::Texture);
+		SubmitTransformUniform(translation);
+		if (texture != TextureIgnoreBinding)
+			glBindTexture(GL_TEXTURE_2D, (GLuint)texture);
+	}
+	else
+	{
+		Gfx::UseProgram(ProgramId::Color);
+		SubmitTransformUniform(translation);
+	}
+}
+
 void RenderInterface_GL3::SubmitTransformUniform(Rml::Vector2f translation)
 {
 	Gfx::ProgramData* program = Gfx::GetProgramData(Gfx::active_program);
@@ -2000,6 +2095,7 @@ void RmlGL3::Shutdown()
 {
 	render_state.Shutdown();
 
+	Gfx::DestroyDrawListBuffers();
 	Gfx::DestroyShaders();
 
 #if !defined RMLUI_PLATFORM_EMSCRIPTEN
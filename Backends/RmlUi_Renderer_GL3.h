@@ -50,6 +50,9 @@ public:
 	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
 	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
 
+	bool SupportsDrawLists() override;
+	void RenderDrawList(const Rml::DrawList& draw_list) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
@@ -58,6 +61,7 @@ public:
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& offset, const Rml::Vector2i& dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
@@ -77,6 +81,7 @@ public:
 	static const Rml::TextureHandle TexturePostprocess = Rml::TextureHandle(-2);
 
 private:
+	void UseGeometryProgram(Rml::TextureHandle texture, Rml::Vector2f translation);
 	void SubmitTransformUniform(Rml::Vector2f translation);
 
 	void RenderFilters();
@@ -80,6 +80,7 @@
 #include "Core/RenderInterface.h"
 #include "Core/Spritesheet.h"
 #include "Core/StringUtilities.h"
+#include "Core/StringWidthCache.h"
 #include "Core/StyleSheet.h"
 #include "Core/StyleSheetContainer.h"
 #include "Core/StyleSheetSpecification.h"
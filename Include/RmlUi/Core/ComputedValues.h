@@ -392,6 +392,12 @@ namespace Style {
 			rare = other.rare;
 		}
 		void CopyInherited(const ComputedValues& parent) { inherited = parent.inherited; }
+		void CopyAll(const ComputedValues& other)
+		{
+			common = other.common;
+			inherited = other.inherited;
+			rare = other.rare;
+		}
 
 	private:
 		template <typename T>
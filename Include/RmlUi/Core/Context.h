@@ -46,8 +46,44 @@ class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class BoxShadowCache;
+class FrameProfiler;
+class ElementBackgroundBorder;
 enum class EventId : uint16_t;
 
+/// Statistics of the box-shadow textures shared between elements in a context.
+struct BoxShadowCacheStatistics {
+	// Number of box-shadow textures currently in use.
+	int num_textures = 0;
+	// Number of elements using the textures, this is at least as large as the number of textures.
+	int num_users = 0;
+	// Approximate size of the generated textures, in bytes.
+	size_t texture_memory = 0;
+	// Number of times a texture was requested and could be shared with an element already using it, or had to be generated.
+	size_t num_hits = 0;
+	size_t num_misses = 0;
+};
+
+/// Timings and work counters of a single frame of a context, that is, of a call to Update() and the following calls to Render().
+struct FrameStatistics {
+	// Time spent updating data models, updating element styles and animations, formatting layout, and rendering, in seconds.
+	double data_model_time = 0;
+	double style_time = 0;
+	double layout_time = 0;
+	double render_time = 0;
+	// Number of elements which had their properties computed, and which had their style definition looked up.
+	int num_elements_updated = 0;
+	int num_definitions_updated = 0;
+	// Number of elements formatted during layout.
+	int num_elements_formatted = 0;
+	// Number of times elements regenerated the geometry of their backgrounds, borders, decorators, or text.
+	int num_geometry_generated = 0;
+	// Number of geometry and draw list submissions to the render interface.
+	int num_draw_calls = 0;
+	// Number of textures loaded or generated through the render interface.
+	int num_textures_generated = 0;
+};
+
 /**
 	A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously.
 
@@ -231,6 +267,12 @@ public:
 	RenderInterface* GetRenderInterface() const;
 	/// Gets the current render state for the render traversal
 	RenderState& GetRenderState();
+	/// Returns statistics of the box-shadow textures shared between elements in this context.
+	BoxShadowCacheStatistics GetBoxShadowCacheStatistics() const;
+	/// Returns the timings and work counters of the most recently finished frame of this context.
+	/// @note A frame is finished at the start of the next call to Update(), thus the statistics include the rendering of the frame.
+	/// @note Only work done during Update() and Render() is counted, not e.g. documents formatted directly by ElementDocument::UpdateDocument().
+	FrameStatistics GetFrameStatistics() const;
 
 	/// Sets the instancer to use for releasing this object.
 	/// @param[in] instancer The context's instancer.
@@ -337,6 +379,10 @@ private:
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	UniquePtr<BoxShadowCache> box_shadow_cache;
+
+	UniquePtr<FrameProfiler> frame_profiler;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
@@ -371,7 +417,11 @@ private:
 	// Sends the specified event to all elements in new_items that don't appear in old_items.
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
+	// Returns the cache for sharing box-shadow textures between elements.
+	BoxShadowCache& GetBoxShadowCache();
+
 	friend class Rml::Element;
+	friend class Rml::ElementBackgroundBorder;
 };
 
 } // namespace Rml
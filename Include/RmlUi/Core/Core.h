@@ -42,6 +42,7 @@ class FileInterface;
 class FontEngineInterface;
 class RenderInterface;
 class SystemInterface;
+struct TextureMemoryStatistics;
 enum class DefaultActionPhase;
 
 
@@ -155,6 +156,22 @@ RMLUICORE_API StringList GetTextureSourceList();
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 /// @param[in] render_interface Release all textures belonging to the given interface, or nullptr to release all textures in all interfaces.
 RMLUICORE_API void ReleaseTextures(RenderInterface* render_interface = nullptr);
+/// Enables loading of texture files in the background. Textures are decoded on worker threads through RenderInterface::DecodeTexture(), and
+/// generated during Context::Update() within a budget of texture data per update. Until then, elements using the texture render nothing, or the
+/// placeholder texture if set. Elements waiting for a texture receive a 'load' event when it is ready, and requests are cancelled if all their
+/// elements are removed first.
+/// @param[in] upload_budget The number of bytes of texture data to generate per context update, at least one texture is always generated.
+///                          A value of zero disables background loading, which is the default.
+/// @param[in] placeholder_source The source of a texture to render while a texture is loading, or empty to render nothing.
+RMLUICORE_API void SetAsyncTextureLoading(int upload_budget, const String& placeholder_source = "");
+/// Sets a memory budget for all textures loaded and generated by RmlUi. Whenever a context is rendered and the budget is exceeded, the least
+/// recently rendered textures are released until the budget is met again. Released textures are loaded or generated again on their next use.
+/// @param[in] budget The budget in bytes, assuming four bytes per pixel, or zero for an unlimited budget which is the default.
+/// @param[in] min_unused_frames Textures rendered during this number of most recent frames are never released, at least one.
+/// @note A frame is counted for each call to Context::Render(), thus applications with multiple contexts should scale the frames accordingly.
+RMLUICORE_API void SetTextureMemoryBudget(size_t budget, int min_unused_frames = 60);
+/// Returns the size and last use of all textures currently loaded or generated by any render interface, and their total size.
+RMLUICORE_API TextureMemoryStatistics GetTextureMemoryStatistics();
 /// Forces all compiled geometry handles generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
 /// Releases unused font textures and rendered glyphs to free up memory, and regenerates actively used fonts.
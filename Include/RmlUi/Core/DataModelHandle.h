@@ -47,6 +47,11 @@ public:
 
 	bool IsVariableDirty(const String& variable_name);
 	void DirtyVariable(const String& variable_name);
+	// Dirty part of a variable, such as 'items[42].health'. Only views depending on this address, or any of its parents
+	// or children, are updated. Use this to avoid updating the views of all entries when a single entry is modified.
+	// Views of sibling members whose values are derived from the modified member, such as through getters, are not
+	// updated. Dirty their addresses as well, or dirty the whole variable.
+	void DirtyAddress(const String& address);
 	void DirtyAllVariables();
 
 	explicit operator bool() { return model; }
@@ -50,8 +50,12 @@ public:
 	void Register(const String& name, DataTransformFunc transform_func);
 	bool Call(const String& name, Variant& inout_result, const VariantList& arguments) const;
 
+	// Returns the function registered with the given name, or nullptr if none. The function stays valid for the lifetime of the register.
+	const DataTransformFunc* Get(const String& name) const;
+
 private:
-	UnorderedMap<String, DataTransformFunc> transform_functions;
+	// Functions are allocated separately so that their addresses remain stable as new functions are registered.
+	UnorderedMap<String, UniquePtr<DataTransformFunc>> transform_functions;
 };
 
 
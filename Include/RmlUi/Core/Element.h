@@ -55,9 +55,12 @@ class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
 class ElementStyle;
+class ElementText;
+class HitTestGrid;
 class LayoutEngine;
 class LayoutInlineBox;
 class LayoutBlockBox;
+struct LayoutState;
 class PropertiesIteratorView;
 class PropertyDictionary;
 class RenderInterface;
@@ -172,6 +175,7 @@ public:
 	virtual bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio);
 
 	/// Checks if a given point in screen coordinates lies within the bordered area of this element.
+	/// @note When picking elements, this is only called for points within the element's (transformed) border boxes.
 	/// @param[in] point The point to test.
 	/// @return True if the element is within this element, false otherwise.
 	virtual bool IsPointWithinElement(Vector2f point);
@@ -586,6 +590,14 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+#ifdef RMLUI_TESTS_ENABLED
+	/// Retrieves the element's local stacking context as currently maintained, and as it would be after a full rebuild.
+	/// @param[out] current The current stacking context, after any patches applied since it was last built.
+	/// @param[out] rebuilt The stacking context built from scratch.
+	/// @return True if the current stacking context is up to date without a rebuild, false if a rebuild was pending.
+	bool GetStackingContextForTesting(ElementList& current, ElementList& rebuilt);
+#endif
+
 protected:
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
@@ -608,6 +620,8 @@ protected:
 	virtual void OnDpRatioChange();
 	/// Called when the current document's compiled style sheet has been changed. This may result in changed sprites.
 	virtual void OnStyleSheetChange();
+	/// Called during update when a texture requested by the element during layout or render has finished loading in the background.
+	virtual void OnTextureLoad();
 
 	/// Called when attributes on the element are changed.
 	/// @param[in] changed_attributes Dictionary of attributes changed on the element. Attribute value will be empty if it was unset.
@@ -663,6 +677,10 @@ private:
 	void BuildStackingContext(ElementList* stacking_context);
 	static void BuildStackingContextForTable(Vector<StackingOrderedChild>& ordered_children, Element* child);
 	void DirtyStackingContext();
+	void DirtyStackingContextChild(Element* child);
+	void DirtyHitTestGrid();
+	void DirtyRenderBounds();
+	void UpdateRenderBounds();
 
 	void DirtyStructure();
 	void UpdateStructure();
@@ -692,6 +710,11 @@ private:
 
 	/// Advances the animations (including transitions) forward in time.
 	void AdvanceAnimations();
+	/// Applies an intermediate value of an animated transform or opacity directly, bypassing the style system since these never affect
+	/// layout. Returns false if the property must be set through the style system instead.
+	bool ApplyAnimatedProperty(PropertyId id, const Property& property);
+	/// Sets the computed opacity of this element and of its descendants inheriting it, notifying each of them about the change.
+	void ApplyInheritedOpacity(float opacity);
 
 	// State flags are packed together for compact data layout.
 	bool local_stacking_context;
@@ -765,15 +788,26 @@ private:
 	float z_index;
 
 	ElementList stacking_context;
+	// The stacking context in render order before sorting by z-index, patched in place when a single child changes.
+	ElementList stacking_context_unsorted;
+	int num_stacking_context_patches;
+
+	// Index of the element's entry in its document's hit test grid, only valid while that entry refers back to this element.
+	int hit_test_grid_index;
 	
 	UniquePtr< TransformState > transform_state;
 
+	// Only set on elements which have been formatted as the root of an independent formatting context, used for incremental layout.
+	UniquePtr< LayoutState > layout_state;
+
 	ElementAnimationList animations;
 
 	ElementMeta* meta;
 
 	friend class Rml::Context;
 	friend class Rml::ElementStyle;
+	friend class Rml::ElementText;
+	friend class Rml::HitTestGrid;
 	friend class Rml::LayoutEngine;
 	friend class Rml::LayoutBlockBox;
 	friend class Rml::LayoutInlineBox;
@@ -37,6 +37,7 @@ class Context;
 class Stream;
 class DocumentHeader;
 class ElementText;
+class HitTestGrid;
 class StyleSheet;
 class StyleSheetContainer;
 
@@ -160,6 +161,8 @@ private:
 	void DirtyLayout() override;
 	/// Returns true if the document has been marked as needing a re-layout.
 	bool IsLayoutDirty() override;
+	/// Dirties the layout of the given element. When possible, only its closest relayout boundary will be formatted again.
+	void DirtyElementLayout(Element* element);
 
 	/// Notify the document that media query related properties have changed and that style sheets need to be re-evaluated.
 	void DirtyMediaQueries();
@@ -169,12 +172,27 @@ private:
 
 	/// Updates the layout if necessary.
 	void UpdateLayout();
+	/// Formats the dirty relayout boundaries.
+	/// @return False if the document must be formatted as a whole.
+	bool UpdateLayoutBoundaries();
 
 	/// Updates the position of the document based on the style properties.
 	void UpdatePosition();
 	/// Sets the dirty flag for document positioning
 	void DirtyPosition();
 
+	/// Returns the element under the given point, using the hit test grid which is rebuilt if necessary.
+	Element* GetElementAtPoint(Vector2f point, const Element* ignore_element);
+	/// Invalidates the hit test grid and the render bounds of the document's elements, called whenever the geometry or stacking order of
+	/// any element in the document changes.
+	void DirtyHitTestGrid();
+	/// Invalidates the hit test grid entries of the element and its descendants, and the render bounds of the document's elements, called
+	/// when they move without any other changes to the document, such as when scrolling.
+	void DirtyHitTestGridSubtree(Element* element);
+	/// Invalidates only the render bounds of the document's elements, called when the area covered by an element's content changes
+	/// without affecting its boxes.
+	void DirtyRenderBounds();
+
 	// Title of the document
 	String title;
 
@@ -191,10 +209,22 @@ private:
 
 	// Is the layout dirty?
 	bool layout_dirty;
+	// Relayout boundaries which need to be formatted again, only used while the layout as a whole is not dirty.
+	Vector<ObserverPtr<Element>> dirty_layout_boundaries;
 
 	bool position_dirty;
 
+	// Spatial index of the document's elements for picking, rebuilt on demand when dirty.
+	UniquePtr<HitTestGrid> hit_test_grid;
+	bool hit_test_grid_dirty;
+	// Elements which moved together with their descendants, only used while the hit test grid as a whole is not dirty.
+	Vector<ObserverPtr<Element>> hit_test_moved_elements;
+
+	// Incremented whenever the render bounds of the document's elements may have changed, invalidating those previously cached.
+	int render_bounds_generation;
+
 	friend class Rml::Context;
+	friend class Rml::Element;
 	friend class Rml::Factory;
 
 };
@@ -76,6 +76,9 @@ public:
 	/// @param[in] line The contents of the line.
 	void AddLine(Vector2f line_position, const String& line);
 
+	/// Returns the area covered by the lines of text, relative to the element's offset.
+	Rectanglef GetTextBounds();
+
 	/// Prevents the element from dirtying its document's layout when its text is changed.
 	void SuppressAutoLayout();
 
@@ -93,9 +96,10 @@ private:
 	// Used to store the position and length of each line we have geometry for.
 	struct Line
 	{
-		Line(const String& text, Vector2f position) : text(text), position(position), width(0) {}
+		Line(const String& text, Vector2f position) : text(text), position(position), width(-1) {}
 		String text;
 		Vector2f position;
+		// Negative until the line is measured or its geometry is generated.
 		int width;
 	};
 
@@ -117,6 +121,7 @@ private:
 	bool geometry_dirty;
 
 	Colourb colour;
+	// Applied to the geometry when rendered, not when generated.
 	float opacity;
 
 	// The decoration geometry we've generated for this string.
@@ -56,6 +56,16 @@ public:
 	/// @param[in] data_source_name The name of the new data source.
 	void SetDataSource(const String& data_source_name);
 
+	/// Enables or disables virtualized rows, also set by the 'virtualized' attribute. When virtualized, row elements
+	/// are only instanced for the rows within the visible scroll window, and recycled as the grid is scrolled. All rows
+	/// are assumed to have the same height, and child rows of the data source are not shown. The grid must have a
+	/// constrained height, such as a fixed 'height' or 'max-height', otherwise it grows to fit every row and all the
+	/// rows are instanced.
+	/// @param[in] virtualized True to virtualize the rows.
+	void SetVirtualized(bool virtualized);
+	/// Returns true if the rows are virtualized.
+	bool IsVirtualized() const;
+
 	/**
 		A column inside a table.
 
@@ -117,11 +127,20 @@ public:
 	int GetNumRows() const;
 	/// Returns the row at the given index in the table.
 	/// @param[in] index The index of the row, relative to the table.
+	/// @return The row, or nullptr if the rows are virtualized and the row is not currently instanced.
 	ElementDataGridRow* GetRow(int index) const;
 
 protected:
 	void OnUpdate() override;
 
+	void OnAttributeChange(const ElementAttributes& changed_attributes) override;
+
+	void OnDataSourceDestroy(DataSource* data_source) override;
+	void OnRowAdd(DataSource* data_source, const String& table, int first_row_added, int num_rows_added) override;
+	void OnRowRemove(DataSource* data_source, const String& table, int first_row_removed, int num_rows_removed) override;
+	void OnRowChange(DataSource* data_source, const String& table, int first_row_changed, int num_rows_changed) override;
+	void OnRowChange(DataSource* data_source, const String& table) override;
+
 	void OnResize() override;
 
 	/// Gets the markup and content of the element.
@@ -132,6 +151,18 @@ private:
 	typedef Vector< Column > ColumnList;
 	typedef Vector< ElementDataGridRow* > RowList;
 
+	// Sets the data source of the virtualized rows. The grid listens to the data source itself in this mode.
+	void SetVirtualDataSource(const String& data_source_name);
+	// Instances, recycles and loads the row elements within the visible scroll window.
+	// @return True if any rows were loaded.
+	bool UpdateVirtualRows();
+	// Instances a new row element for the virtualized rows.
+	ElementDataGridRow* AddVirtualRow();
+	// Moves a virtualized row element to the position of its row index.
+	void PositionVirtualRow(ElementDataGridRow* row);
+	// Removes all the virtualized row elements, they are instanced again as needed.
+	void ClearVirtualRows();
+
 	ColumnList columns;
 	String column_fields;
 
@@ -144,6 +175,18 @@ private:
 	// If this is non-empty, then in the previous update the data source was set
 	// and we must set it this update.
 	String new_data_source;
+	// The data source currently set, applied again when switching between regular and virtualized rows.
+	String data_source_name;
+
+	bool virtualized;
+	// The data source and table of the virtualized rows.
+	DataSource* virtual_data_source;
+	String virtual_data_table;
+	int num_virtual_rows;
+	// The height of every virtualized row, measured from the laid out rows.
+	float virtual_row_height;
+	// The row elements used for the virtualized rows. Rows with a child index of -1 are hidden and free to be recycled.
+	RowList virtual_rows;
 
 	// The block element that contains all our rows. Only used for applying styles.
 	Element* body;
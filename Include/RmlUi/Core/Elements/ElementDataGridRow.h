@@ -128,6 +128,8 @@ private:
 
 	// Adds or refreshes the cell contents, and undirties the row's cells.
 	void Load(const DataQuery& row_information);
+	// Removes the cell contents, and undirties the row's cells. Used for rows which could not be loaded.
+	void ClearCells();
 	// Finds all children that have cell information missing (either though being
 	// refreshed or not being loaded yet) and reloads them.
 	void LoadChildren(float time_slice);
@@ -85,6 +85,8 @@ protected:
 
 	void OnResize() override;
 
+	void OnTextureLoad() override;
+
 	void OnAttributeChange(const ElementAttributes& changed_attributes) override;
 
 	void OnPropertyChange(const PropertyIdSet& changed_properties) override;
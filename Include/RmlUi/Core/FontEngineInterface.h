@@ -111,6 +111,7 @@ public:
 	/// @param[in] string The string to measure.
 	/// @param[in] prior_character The optionally-specified character that immediately precedes the string. This may have an impact on the string width due to kerning.
 	/// @return The width, in pixels, this string will occupy if rendered with this handle.
+	/// @note Called for every word of text during layout, engines can use a StringWidthCache per face to avoid measuring the same words again.
 	virtual int GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character = Character::Null);
 
 	/// Called by RmlUi when it wants to retrieve the geometry required to render a single line of text.
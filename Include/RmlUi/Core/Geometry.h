@@ -95,6 +95,12 @@ public:
 	/// Sets the geometry's texture.
 	void SetTexture(const Texture* texture);
 
+	/// Sets the opacity multiplied with the alpha of the vertex colours when rendered. Changing the opacity leaves the vertices intact, only the
+	/// compiled geometry is released if it was compiled with another opacity.
+	void SetOpacity(float opacity);
+	/// Gets the opacity applied to the vertex colours when rendered.
+	float GetOpacity() const;
+
 	/// Releases any previously-compiled geometry, and forces any new geometry to have a compile attempted.
 	/// @param[in] clear_buffers True to also clear the vertex and index buffers, false to leave intact.
 	void Release(bool clear_buffers = false);
@@ -108,6 +114,10 @@ public:
 private:
 	// Move members from another geometry.
 	void MoveFrom(Geometry& other);
+	// Releases the compiled geometry if it was compiled with another texture handle than the given one.
+	void ReleaseIfTextureChanged(TextureHandle texture_handle);
+	// Returns the vertices to submit to the render interface, with the opacity applied to their colours using the buffer when needed.
+	Vertex* GetRenderVertices(Vector< Vertex >& buffer);
 
 	RenderInterface* render_interface = nullptr;
 	Element* host_element = nullptr;
@@ -115,8 +125,10 @@ private:
 	Vector< Vertex > vertices;
 	Vector< int > indices;
 	const Texture* texture = nullptr;
+	float opacity = 1.f;
 
 	CompiledGeometryHandle compiled_geometry = 0;
+	TextureHandle compiled_texture_handle = 0;
 	bool compile_attempted = false;
 
 	GeometryDatabaseHandle database_handle;
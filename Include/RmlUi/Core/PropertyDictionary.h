@@ -54,6 +54,8 @@ public:
 
 	/// Returns the number of properties in the dictionary.
 	int GetNumProperties() const;
+	/// Reserves storage for the given number of properties.
+	void Reserve(int num_properties);
 	/// Returns the map of properties in the dictionary.
 	const PropertyMap& GetProperties() const;
 
@@ -44,6 +44,27 @@ enum class RenderClear { None, Clear, Clone };
 enum class RenderTarget { Layer, MaskImage, RenderTexture };
 enum class BlendMode { Blend, Replace };
 
+/**
+	A range of indices in a draw list, to be rendered with a single texture.
+ */
+struct DrawListCommand {
+	int index_offset;
+	int num_indices;
+	TextureHandle texture;
+};
+
+/**
+	Geometry from consecutive render calls collected into shared buffers, see RenderInterface::RenderDrawList().
+
+	The translation of each geometry has already been applied to its vertices, and the indices refer to the shared vertex buffer.
+	Consecutive geometry using the same texture is merged into a single command.
+ */
+struct DrawList {
+	Vector<Vertex> vertices;
+	Vector<int> indices;
+	Vector<DrawListCommand> commands;
+};
+
 /**
 	The abstract base class for application-specific rendering implementation. Your application must provide a concrete
 	implementation of this class and install it through Rml::SetRenderInterface() in order for anything to be rendered.
@@ -87,6 +108,15 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 	
+	/// Called by RmlUi at the start of rendering a context, to determine whether geometry should be submitted through draw lists.
+	/// @return True if RenderDrawList() is implemented. Otherwise, the default, geometry is submitted through the functions above.
+	virtual bool SupportsDrawLists();
+	/// Called by RmlUi when it wants to render a list of batched geometry. Consecutive geometry is collected into the same draw list as
+	/// long as the scissor region, transform, clip mask, and layer stay the same, thus the current state applies to all of its commands.
+	/// @param[in] draw_list The geometry to render, the commands should be rendered in order.
+	/// @note Affected by transform: Yes. Affected by scissor: Yes. Affected by clip mask: Yes.
+	virtual void RenderDrawList(const DrawList& draw_list);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -108,12 +138,26 @@ public:
 	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
 	/// @return True if the load attempt succeeded and the handle and dimensions are valid, false if not.
 	virtual bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source);
+	/// Called by RmlUi on a worker thread when textures are loaded in the background, see Rml::SetAsyncTextureLoading().
+	/// The decoded pixels are later passed to GenerateTexture() on the main thread. Must be safe to call concurrently with any other function.
+	/// @param[out] texture_data The raw 8-bit texture data, in the same format as for GenerateTexture.
+	/// @param[out] texture_dimensions The dimensions, in pixels, of the texture data.
+	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
+	/// @return True if the texture was decoded. If false is returned, the texture is loaded through LoadTexture() on the main thread instead.
+	virtual bool DecodeTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const String& source);
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
 	/// @param[in] source The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
 	/// @param[in] source_dimensions The dimensions, in pixels, of the source data.
 	/// @return True if the texture generation succeeded and the handle is valid, false if not.
 	virtual bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions);
+	/// Called by RmlUi when a region of a previously generated texture needs to be updated, such as when new glyphs are added to a font texture.
+	/// @param[in] texture_handle The handle of the texture to update, as generated by GenerateTexture.
+	/// @param[in] source The raw 8-bit texture data of the region, in the same format as for GenerateTexture.
+	/// @param[in] offset The position of the region's top-left corner within the texture.
+	/// @param[in] dimensions The dimensions, in pixels, of the region.
+	/// @return True if the region was updated. If false is returned, the texture will be released and generated again instead.
+	virtual bool UpdateTexture(TextureHandle texture_handle, const byte* source, const Vector2i& offset, const Vector2i& dimensions);
 	/// Called by RmlUi when a loaded texture is no longer required.
 	/// @param texture The texture handle to release.
 	virtual void ReleaseTexture(TextureHandle texture);
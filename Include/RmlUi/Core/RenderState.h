@@ -62,6 +62,9 @@ using ElementClipList = Vector<ElementClip>;
        - Transform
     All such operations on the render interface should go through this class. Pushing and popping the render state is supported through the
     RenderStateSession() object.
+
+    When supported by the render interface, geometry is collected into a draw list which is submitted whenever the state changes. Any other
+    calls to the render interface during rendering must be preceded by a call to FlushDrawList().
  */
 class RMLUICORE_API RenderState : NonCopyMoveable {
 public:
@@ -84,6 +87,14 @@ public:
 	Rectanglei GetScissorState() const;
 
 	bool SupportsClipMask() const { return supports_clip_mask; }
+	bool SupportsDrawLists() const { return supports_draw_lists; }
+
+	// Adds geometry to the draw list, to be submitted together with consecutive geometry. Requires support for draw lists.
+	// The opacity is multiplied with the alpha of the vertex colours.
+	void AddToDrawList(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture, Vector2f translation,
+		float opacity = 1.f);
+	// Submits the geometry collected in the draw list to the render interface, if any.
+	void FlushDrawList();
 	RenderInterface* GetRenderInterface() const { return render_interface; }
 
 	void SetViewport(Vector2i dimensions);
@@ -106,6 +117,8 @@ private:
 	Vector2i viewport_dimensions;
 	Vector<State> stack;
 	bool supports_clip_mask = false;
+	bool supports_draw_lists = false;
+	DrawList draw_list;
 
 	friend class Rml::RenderStateSession;
 };
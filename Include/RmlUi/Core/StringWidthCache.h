@@ -0,0 +1,100 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_STRINGWIDTHCACHE_H
+#define RMLUI_CORE_STRINGWIDTHCACHE_H
+
+#include "Header.h"
+#include "Traits.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+	A bounded cache of measured string widths for a single font face, evicting the least recently used strings when full.
+
+	Text is measured token by token during every layout, mostly with the same tokens as in previous layouts. The default font engine keeps
+	one cache per font face handle, custom font engines can use it in their implementation of FontEngineInterface::GetStringWidth().
+ */
+
+class RMLUICORE_API StringWidthCache : NonCopyMoveable {
+public:
+	/// @param[in] max_entries The maximum number of strings to keep.
+	/// @param[in] max_string_length Longer strings are not cached, bounding the memory used by the cache.
+	explicit StringWidthCache(int max_entries = 2048, int max_string_length = 64);
+	~StringWidthCache();
+
+	/// Looks up the width of a previously measured string, and marks it as recently used.
+	/// @param[in] string The measured string.
+	/// @param[in] prior_character The character preceding the string when it was measured.
+	/// @param[out] width The width of the string, if found.
+	/// @return True if the string was found.
+	bool Find(const String& string, Character prior_character, int& width);
+
+	/// Stores the measured width of a string, replacing the least recently used string if the cache is full.
+	/// @param[in] string The measured string.
+	/// @param[in] prior_character The character preceding the string when it was measured.
+	/// @param[in] width The width of the string.
+	void Insert(const String& string, Character prior_character, int width);
+
+	/// Removes all strings from the cache, should be called whenever the widths may have changed.
+	void Clear();
+
+	/// Returns the number of strings currently in the cache.
+	int GetNumEntries() const;
+
+private:
+	struct Entry {
+		size_t hash;
+		String string;
+		Character prior_character;
+		int width;
+		// Neighbours in the list of entries by recent use, or -1 at either end.
+		int previous;
+		int next;
+	};
+
+	static size_t Hash(const String& string, Character prior_character);
+
+	void Unlink(int index);
+	void PushFront(int index);
+
+	int max_entries;
+	int max_string_length;
+
+	// Entries are linked by their indices from most to least recently used. Once full, the least recently used entry is reused for new strings.
+	Vector<Entry> entries;
+	int front = -1;
+	int back = -1;
+
+	// Entry index by hash of string and prior character.
+	UnorderedMap<size_t, int> entry_map;
+};
+
+} // namespace Rml
+#endif
@@ -85,6 +85,9 @@ public:
 private:
 	StyleSheet();
 
+	/// Returns the cached element definition for the given nodes, sorting them in the process.
+	SharedPtr<const ElementDefinition> GetOrCreateElementDefinition(StyleSheetIndex::NodeList& applicable_nodes) const;
+
 	// Root level node, attributes from special nodes like "body" get added to this node
 	UniquePtr<StyleSheetNode> root;
 
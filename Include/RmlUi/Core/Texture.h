@@ -47,6 +47,26 @@ class RenderInterface;
 */
 using TextureCallback = Function<bool(RenderInterface* render_interface, const String& name, TextureHandle& handle, Vector2i& dimensions)>;
 
+/// Memory used by the textures loaded and generated by RmlUi, see Rml::GetTextureMemoryStatistics().
+struct TextureMemoryStatistics {
+	struct Entry {
+		// The source of a texture loaded from file, or the name of a generated texture.
+		String source;
+		// Size of the texture data in bytes, assuming four bytes per pixel, summed over all render interfaces holding the texture.
+		size_t size = 0;
+		// The frame in which the texture was last rendered, or loaded.
+		int last_used_frame = 0;
+	};
+	// All textures currently held by a render interface, from the largest to the smallest.
+	Vector<Entry> textures;
+	// Total size of all the textures in bytes.
+	size_t total_size = 0;
+	// The memory budget in bytes, or zero if unlimited.
+	size_t budget = 0;
+	// The current frame, which is advanced after each call to Context::Render().
+	int frame = 0;
+};
+
 
 /**
 	Abstraction of a two-dimensional texture image, with an application-specific texture handle.
@@ -67,6 +87,13 @@ public:
 	/// @param[in] callback The callback function which generates the data of the texture, see TextureCallback.
 	void Set(const String& name, const TextureCallback& callback);
 
+	/// Updates a region of a texture set through a callback function, for each render interface which has already generated the texture.
+	/// Render interfaces that cannot update the region release the texture, which is then generated again from the callback on next use.
+	/// @param[in] source The raw 8-bit texture data of the region, in the format used by the texture callback.
+	/// @param[in] offset The position of the region's top-left corner within the texture.
+	/// @param[in] dimensions The dimensions, in pixels, of the region.
+	void UpdateRegion(const byte* source, Vector2i offset, Vector2i dimensions);
+
 	/// Returns the texture's source name. This is usually the name of the file the texture was loaded from.
 	/// @return The name of the this texture's source. This will be the empty string if this texture is not loaded.
 	const String& GetSource() const;
@@ -79,6 +106,12 @@ public:
 	/// @return The texture's dimensions. This will be (0, 0) if the texture isn't loaded.
 	Vector2i GetDimensions(RenderInterface* render_interface) const;
 
+	/// Returns true if the texture has been loaded or generated by any render interface.
+	bool IsLoaded() const;
+	/// Returns true while the texture is being loaded in the background, see Rml::SetAsyncTextureLoading().
+	/// @param[in] The render interface that is requesting the texture.
+	bool IsLoading(RenderInterface* render_interface) const;
+
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
 
@@ -120,7 +120,7 @@ using VariantList = Vector< Variant >;
 using ElementAnimationList = Vector< ElementAnimation >;
 
 using AttributeNameList = SmallUnorderedSet< String >;
-using PropertyMap = UnorderedMap< PropertyId, Property >;
+using PropertyMap = SmallUnorderedMap< PropertyId, Property >;
 
 using Dictionary = SmallUnorderedMap< String, Variant >;
 using ElementAttributes = Dictionary;
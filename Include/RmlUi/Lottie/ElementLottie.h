@@ -38,6 +38,9 @@ namespace rlottie { class Animation; }
 
 namespace Rml {
 
+class LottieRasterizer;
+struct LottieFrame;
+
 class RMLUICORE_API ElementLottie : public Element
 {
 public:
@@ -49,6 +52,11 @@ public:
 	/// Returns the element's inherent size.
 	bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio) override;
 
+	/// Enables sharing of rendered frames between all lottie elements playing the same file at the same size. Only animations where all
+	/// frames fit within the given size are shared, which makes this mainly useful for short, looping animations.
+	/// @param[in] max_bytes The maximum size in bytes of all the frames of a single animation, or zero to disable sharing (default).
+	static void SetFrameCacheLimit(size_t max_bytes);
+
 protected:
 	/// Renders the animation.
 	void OnRender() override;
@@ -78,9 +86,8 @@ private:
 
 	// The texture this element is rendering from.
 	Texture texture;
-	// The texture data buffer.
-	size_t texture_data_size = 0;
-	UniquePtr<byte[]> texture_data;
+	// The dimensions of the texture as last generated.
+	Vector2i texture_dimensions;
 
 	// The animation's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
@@ -92,10 +99,14 @@ private:
 
 	// The absolute time when the current animation was first displayed.
 	double time_animation_start = -1;
-	// The previous animation frame displayed.
-	size_t prev_animation_frame = size_t(-1);
-
-	UniquePtr<rlottie::Animation> animation;
+	// The absolute time of the previous texture update.
+	double time_previous_update = -1;
+
+	SharedPtr<rlottie::Animation> animation;
+	// Renders the animation frames ahead of time on worker threads.
+	SharedPtr<LottieRasterizer> rasterizer;
+	// The frame currently uploaded to the texture.
+	SharedPtr<LottieFrame> displayed_frame;
 };
 
 } // namespace Rml
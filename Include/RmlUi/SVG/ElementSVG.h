@@ -34,10 +34,11 @@
 #include "../Core/Geometry.h"
 #include "../Core/Texture.h"
 
-namespace lunasvg { class Document; }
-
 namespace Rml {
 
+struct SVGData;
+class SVGTexture;
+
 class RMLUICORE_API ElementSVG : public Element
 {
 public:
@@ -49,6 +50,11 @@ public:
 	/// Returns the element's inherent size.
 	bool GetIntrinsicDimensions(Vector2f& dimensions, float& ratio) override;
 
+	/// Enables rasterization of SVG images on worker threads, so that newly displayed images do not stall the frame. Until finished, new
+	/// images are not rendered, while resized images are rendered from their previous texture.
+	/// @param[in] enable True to rasterize on worker threads, false to rasterize on first use (default).
+	static void SetAsyncRasterization(bool enable);
+
 protected:
 	/// Renders the image.
 	void OnRender() override;
@@ -76,9 +82,6 @@ private:
 	bool geometry_dirty = false;
 	bool texture_size_dirty = false;
 
-	// The texture this element is rendering from.
-	Texture texture;
-
 	// The image's intrinsic dimensions.
 	Vector2f intrinsic_dimensions;
 	// The element's size for rendering.
@@ -87,7 +90,11 @@ private:
 	// The geometry used to render this element.
 	Geometry geometry;
 
-	UniquePtr<lunasvg::Document> svg_document;
+	// The parsed document and its rasterized texture, shared with other elements.
+	SharedPtr<SVGData> svg_data;
+	SharedPtr<SVGTexture> svg_texture;
+	// The texture being rasterized for the current size, replaces the current texture when ready.
+	SharedPtr<SVGTexture> pending_svg_texture;
 };
 
 } // namespace Rml
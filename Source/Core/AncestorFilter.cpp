@@ -0,0 +1,285 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "AncestorFilter.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+#include "ElementDefinition.h"
+#include <algorithm>
+
+namespace Rml {
+
+static constexpr int MaxSiblingMatches = 16;
+static constexpr int MaxSharedComputedValues = 8;
+
+static AncestorFilter ancestor_filter;
+
+enum class HashKind { Tag = 1, Id, Class };
+
+static uint32_t HashName(HashKind kind, const String& name)
+{
+	std::size_t seed = std::size_t(kind);
+	Utilities::HashCombine(seed, name);
+	return uint32_t(uint64_t(seed) ^ (uint64_t(seed) >> 32));
+}
+
+void AncestorFilter::PushParent(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	if (filter.num_levels == (int)filter.levels.size())
+		filter.levels.emplace_back();
+
+	Level& level = filter.levels[filter.num_levels];
+	level.element = element;
+	level.include_ancestors = (filter.num_levels == 0 || filter.levels[filter.num_levels - 1].element != element->GetParentNode());
+	level.num_sibling_matches = 0;
+	level.num_shared_computed_values = 0;
+
+	filter.num_levels += 1;
+}
+
+void AncestorFilter::PopParent()
+{
+	AncestorFilter& filter = ancestor_filter;
+	RMLUI_ASSERT(filter.num_levels > 0);
+
+	Level& level = filter.levels[filter.num_levels - 1];
+
+	if (filter.num_hashed_levels == filter.num_levels)
+	{
+		for (int i = level.hashes_begin; i < (int)filter.hashes.size(); i++)
+		{
+			const uint32_t hash = filter.hashes[i];
+			for (uint8_t* counter : {&filter.counters[hash % NumCounters], &filter.counters[(hash >> NumBits) % NumCounters]})
+			{
+				// Saturated counters are never decremented, which only results in additional false positives.
+				if (*counter != 0xff)
+					*counter -= 1;
+			}
+		}
+		filter.hashes.resize(level.hashes_begin);
+		filter.num_hashed_levels -= 1;
+	}
+
+	// Release the definitions so that they don't outlive the traversal.
+	for (int i = 0; i < level.num_sibling_matches; i++)
+		level.sibling_matches[i].definition.reset();
+	level.num_sibling_matches = 0;
+
+	for (SharedComputedValues& shared : level.shared_computed_values)
+		shared.definition.reset();
+	level.num_shared_computed_values = 0;
+
+	filter.num_levels -= 1;
+}
+
+AncestorFilter* AncestorFilter::Get(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	if (!GetParentLevel(element))
+		return nullptr;
+
+	filter.UpdateHashes();
+
+	return &filter;
+}
+
+bool AncestorFilter::MayContainAll(const HashList& in_hashes) const
+{
+	for (const uint32_t hash : in_hashes)
+	{
+		if (counters[hash % NumCounters] == 0 || counters[(hash >> NumBits) % NumCounters] == 0)
+			return false;
+	}
+	return true;
+}
+
+void AncestorFilter::AddTagHash(HashList& hashes, const String& tag)
+{
+	hashes.push_back(HashName(HashKind::Tag, tag));
+}
+
+void AncestorFilter::AddIdHash(HashList& hashes, const String& id)
+{
+	hashes.push_back(HashName(HashKind::Id, id));
+}
+
+void AncestorFilter::AddClassHash(HashList& hashes, const String& class_name)
+{
+	hashes.push_back(HashName(HashKind::Class, class_name));
+}
+
+AncestorFilter::SiblingMatch* AncestorFilter::FindSiblingMatch(const StyleSheet* style_sheet, const Element* element)
+{
+	Level& level = levels[num_levels - 1];
+
+	const String& tag = element->GetTagName();
+	const String& id = element->GetId();
+	const StringList& class_names = element->GetStyle()->GetClassNameList();
+	const PseudoClassMap& pseudo_classes = element->GetStyle()->GetActivePseudoClasses();
+
+	for (int i = 0; i < level.num_sibling_matches; i++)
+	{
+		SiblingMatch& match = level.sibling_matches[i];
+		if (match.style_sheet != style_sheet || match.tag != tag || match.id != id || match.class_names != class_names ||
+			match.pseudo_classes.size() != pseudo_classes.size())
+			continue;
+
+		bool equal_pseudo_classes = true;
+		for (const auto& pseudo_class : pseudo_classes)
+		{
+			if (match.pseudo_classes.count(pseudo_class.first) == 0)
+			{
+				equal_pseudo_classes = false;
+				break;
+			}
+		}
+
+		if (equal_pseudo_classes)
+			return &match;
+	}
+
+	return nullptr;
+}
+
+AncestorFilter::SiblingMatch* AncestorFilter::AddSiblingMatch(const StyleSheet* style_sheet, const Element* element)
+{
+	Level& level = levels[num_levels - 1];
+	if (level.num_sibling_matches >= MaxSiblingMatches)
+		return nullptr;
+
+	if (level.num_sibling_matches == (int)level.sibling_matches.size())
+		level.sibling_matches.emplace_back();
+
+	SiblingMatch& match = level.sibling_matches[level.num_sibling_matches];
+	level.num_sibling_matches += 1;
+
+	match.style_sheet = style_sheet;
+	match.tag = element->GetTagName();
+	match.id = element->GetId();
+	match.class_names = element->GetStyle()->GetClassNameList();
+	match.pseudo_classes = element->GetStyle()->GetActivePseudoClasses();
+	match.nodes.clear();
+	match.structural_nodes.clear();
+	match.definition.reset();
+
+	return &match;
+}
+
+const Style::ComputedValues* AncestorFilter::FindSharedComputedValues(const Element* element, const ElementDefinition* definition)
+{
+	const Level* level = GetParentLevel(element);
+	if (!level)
+		return nullptr;
+
+	const int num_shared = std::min(level->num_shared_computed_values, MaxSharedComputedValues);
+	for (int i = 0; i < num_shared; i++)
+	{
+		const SharedComputedValues& shared = level->shared_computed_values[i];
+		if (shared.definition.get() == definition)
+			return shared.values.get();
+	}
+
+	return nullptr;
+}
+
+void AncestorFilter::AddSharedComputedValues(const Element* element, const SharedPtr<const ElementDefinition>& definition,
+	const Style::ComputedValues& values)
+{
+	Level* level = GetParentLevel(element);
+	if (!level)
+		return;
+
+	const int index = level->num_shared_computed_values % MaxSharedComputedValues;
+	if (index == (int)level->shared_computed_values.size())
+		level->shared_computed_values.push_back(SharedComputedValues{nullptr, MakeUnique<Style::ComputedValues>(nullptr)});
+
+	SharedComputedValues& shared = level->shared_computed_values[index];
+	shared.definition = definition;
+	shared.values->CopyAll(values);
+
+	level->num_shared_computed_values += 1;
+}
+
+AncestorFilter::Level* AncestorFilter::GetParentLevel(const Element* element)
+{
+	AncestorFilter& filter = ancestor_filter;
+	if (filter.num_levels == 0)
+		return nullptr;
+
+	Level& level = filter.levels[filter.num_levels - 1];
+	if (level.element != element->GetParentNode())
+		return nullptr;
+
+	return &level;
+}
+
+void AncestorFilter::AddHashes(const Element* element)
+{
+	const size_t begin = hashes.size();
+
+	AddTagHash(hashes, element->GetTagName());
+
+	const String& id = element->GetId();
+	if (!id.empty())
+		AddIdHash(hashes, id);
+
+	for (const String& class_name : element->GetStyle()->GetClassNameList())
+		AddClassHash(hashes, class_name);
+
+	for (size_t i = begin; i < hashes.size(); i++)
+	{
+		const uint32_t hash = hashes[i];
+		for (uint8_t* counter : {&counters[hash % NumCounters], &counters[(hash >> NumBits) % NumCounters]})
+		{
+			if (*counter != 0xff)
+				*counter += 1;
+		}
+	}
+}
+
+void AncestorFilter::UpdateHashes()
+{
+	for (; num_hashed_levels < num_levels; num_hashed_levels++)
+	{
+		Level& level = levels[num_hashed_levels];
+		level.hashes_begin = (int)hashes.size();
+
+		if (level.include_ancestors)
+		{
+			for (const Element* element = level.element; element; element = element->GetParentNode())
+				AddHashes(element);
+		}
+		else
+		{
+			AddHashes(level.element);
+		}
+	}
+}
+
+} // namespace Rml
@@ -0,0 +1,137 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_ANCESTORFILTER_H
+#define RMLUI_CORE_ANCESTORFILTER_H
+
+#include "../../Include/RmlUi/Core/StyleSheetTypes.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "ElementStyle.h"
+
+namespace Rml {
+
+class Element;
+class ElementDefinition;
+class StyleSheet;
+
+/**
+	Selector matching state maintained during the top-down update of the element tree.
+
+	Holds a counting bloom filter of the tags, ids, and classes of the ancestors of the elements currently being updated,
+	used to quickly reject style sheet nodes with descendant selectors that cannot match. In addition, the matching results
+	are memoized per parent element, so that siblings with the same tag, id, classes, and pseudo-classes share one matching
+	pass. Similarly, the computed values of recently updated siblings are kept so that elements with the same definition can
+	share them. The state only lives during a single traversal, and is filled lazily the first time an element needs matching.
+ */
+
+class AncestorFilter {
+public:
+	// Hashes of tags, ids, and classes, as stored for style sheet nodes and elements.
+	using HashList = Vector<uint32_t>;
+
+	/// Enters the children of the given element during the update traversal.
+	static void PushParent(const Element* element);
+	/// Leaves the children of the most recently pushed element.
+	static void PopParent();
+
+	/// Returns the filter when the traversal is currently visiting the children of the given element's parent, otherwise nullptr.
+	static AncestorFilter* Get(const Element* element);
+
+	/// Returns false if any of the given hashes is definitely not set on an ancestor of the current element.
+	bool MayContainAll(const HashList& hashes) const;
+
+	/// Adds the hashes of a style sheet node requirement to the list.
+	static void AddTagHash(HashList& hashes, const String& tag);
+	static void AddIdHash(HashList& hashes, const String& id);
+	static void AddClassHash(HashList& hashes, const String& class_name);
+
+	/// Memoized matching results for elements sharing a parent and selector-relevant state.
+	struct SiblingMatch {
+		const StyleSheet* style_sheet = nullptr;
+		String tag;
+		String id;
+		StringList class_names;
+		PseudoClassMap pseudo_classes;
+
+		// Nodes applicable to every element with this state.
+		StyleSheetIndex::NodeList nodes;
+		// Nodes only applicable after matching their structural selectors against each element.
+		StyleSheetIndex::NodeList structural_nodes;
+		// The resulting definition, only set when there are no structural nodes.
+		SharedPtr<const ElementDefinition> definition;
+	};
+
+	/// Returns the memoized match of a previous sibling sharing the element's state, or nullptr if none.
+	SiblingMatch* FindSiblingMatch(const StyleSheet* style_sheet, const Element* element);
+	/// Stores a new match for the element's state, to be filled in by the caller. Returns nullptr when the cache is full.
+	SiblingMatch* AddSiblingMatch(const StyleSheet* style_sheet, const Element* element);
+
+	/// Returns the computed values of a previously updated sibling with the given definition and no inline properties, or nullptr if none.
+	static const Style::ComputedValues* FindSharedComputedValues(const Element* element, const ElementDefinition* definition);
+	/// Stores the computed values of an element without inline properties, to be shared with its subsequent siblings.
+	static void AddSharedComputedValues(const Element* element, const SharedPtr<const ElementDefinition>& definition,
+		const Style::ComputedValues& values);
+
+private:
+	struct SharedComputedValues {
+		SharedPtr<const ElementDefinition> definition;
+		UniquePtr<Style::ComputedValues> values;
+	};
+
+	struct Level {
+		const Element* element = nullptr;
+		// Whether the element's parent is not part of the level below, then all its ancestors are hashed with this level.
+		bool include_ancestors = false;
+		// Range of this level's hashes in the hash list, when hashed.
+		int hashes_begin = 0;
+		Vector<SiblingMatch> sibling_matches;
+		int num_sibling_matches = 0;
+		// Recently computed values, replaced in round-robin order when full.
+		Vector<SharedComputedValues> shared_computed_values;
+		int num_shared_computed_values = 0;
+	};
+
+	// Returns the level of the traversal currently visiting the children of the given element's parent, otherwise nullptr.
+	static Level* GetParentLevel(const Element* element);
+
+	void AddHashes(const Element* element);
+	void UpdateHashes();
+
+	static constexpr int NumBits = 12;
+	static constexpr int NumCounters = 1 << NumBits;
+
+	uint8_t counters[NumCounters] = {};
+
+	Vector<Level> levels;
+	int num_levels = 0;
+	int num_hashed_levels = 0;
+	HashList hashes;
+};
+
+} // namespace Rml
+#endif
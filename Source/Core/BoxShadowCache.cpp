@@ -0,0 +1,153 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "BoxShadowCache.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+
+namespace Rml {
+
+bool operator==(const BoxShadowKey& a, const BoxShadowKey& b)
+{
+	return a.shadows == b.shadows && a.boxes == b.boxes && a.border_radius == b.border_radius && a.background_color == b.background_color &&
+		a.border_colors[0] == b.border_colors[0] && a.border_colors[1] == b.border_colors[1] && a.border_colors[2] == b.border_colors[2] &&
+		a.border_colors[3] == b.border_colors[3];
+}
+
+SharedPtr<const Texture> BoxShadowCache::GetTexture(const BoxShadowKey& key, Vector2i dimensions, const TextureCallback& callback)
+{
+	WeakPtr<Entry>& weak_entry = entries[key];
+	if (SharedPtr<Entry> entry = weak_entry.lock())
+	{
+		num_hits += 1;
+		return SharedPtr<const Texture>(entry, &entry->texture);
+	}
+
+	num_misses += 1;
+
+	SharedPtr<Entry> entry = MakeShared<Entry>();
+	entry->texture.Set("box-shadow", callback);
+	entry->dimensions = dimensions;
+	weak_entry = entry;
+
+	if (entries.size() > max_size_before_cleanup)
+		RemoveExpiredEntries();
+
+	return SharedPtr<const Texture>(entry, &entry->texture);
+}
+
+BoxShadowCacheStatistics BoxShadowCache::GetStatistics() const
+{
+	BoxShadowCacheStatistics statistics;
+	statistics.num_hits = num_hits;
+	statistics.num_misses = num_misses;
+
+	for (const auto& pair : entries)
+	{
+		const long use_count = pair.second.use_count();
+		if (use_count == 0)
+			continue;
+
+		statistics.num_textures += 1;
+		statistics.num_users += (int)use_count;
+
+		if (SharedPtr<Entry> entry = pair.second.lock())
+		{
+			if (entry->texture.IsLoaded())
+				statistics.texture_memory += size_t(entry->dimensions.x) * size_t(entry->dimensions.y) * 4;
+		}
+	}
+
+	return statistics;
+}
+
+void BoxShadowCache::RemoveExpiredEntries()
+{
+	for (auto it = entries.begin(); it != entries.end();)
+	{
+		if (it->second.expired())
+			it = entries.erase(it);
+		else
+			++it;
+	}
+
+	// Amortize the cost of the cleanup over the number of entries that can be added before the next one.
+	max_size_before_cleanup = Math::Max(size_t(64), 2 * entries.size());
+}
+
+} // namespace Rml
+
+namespace std {
+
+size_t hash<::Rml::BoxShadowKey>::operator()(const ::Rml::BoxShadowKey& key) const
+{
+	using namespace ::Rml;
+	using Utilities::HashCombine;
+
+	auto HashColour = [](size_t& seed, Colourb colour) {
+		HashCombine(seed, (uint32_t(colour.red) << 24) | (uint32_t(colour.green) << 16) | (uint32_t(colour.blue) << 8) | uint32_t(colour.alpha));
+	};
+
+	size_t seed = 0;
+	for (const Shadow& shadow : key.shadows)
+	{
+		HashColour(seed, shadow.color);
+		HashCombine(seed, shadow.offset_x.number);
+		HashCombine(seed, shadow.offset_y.number);
+		HashCombine(seed, shadow.blur_radius.number);
+		HashCombine(seed, shadow.spread_distance.number);
+		HashCombine(seed, shadow.inset);
+	}
+
+	for (const auto& offset_box : key.boxes)
+	{
+		const Box& box = offset_box.second;
+		HashCombine(seed, offset_box.first.x);
+		HashCombine(seed, offset_box.first.y);
+
+		const Vector2f size = box.GetSize(BoxArea::Content);
+		HashCombine(seed, size.x);
+		HashCombine(seed, size.y);
+		for (BoxArea area : {BoxArea::Border, BoxArea::Padding})
+		{
+			for (int i = 0; i < Box::num_edges; i++)
+				HashCombine(seed, box.GetEdge(area, BoxEdge(i)));
+		}
+	}
+
+	for (int i = 0; i < 4; i++)
+		HashCombine(seed, key.border_radius[i]);
+
+	HashColour(seed, key.background_color);
+	for (Colourb colour : key.border_colors)
+		HashColour(seed, colour);
+
+	return seed;
+}
+
+} // namespace std
@@ -0,0 +1,101 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_BOXSHADOWCACHE_H
+#define RMLUI_CORE_BOXSHADOWCACHE_H
+
+#include "../../Include/RmlUi/Core/Box.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/DecorationTypes.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/*
+    Everything that determines the contents of a box-shadow texture. Lengths are resolved to pixels, and the element's backgrounds and borders are
+    included since they are rendered into the same texture.
+*/
+struct BoxShadowKey {
+	ShadowList shadows;
+	Vector<Pair<Vector2f, Box>> boxes;
+	Vector4f border_radius;
+	Colourb background_color;
+	Colourb border_colors[4];
+};
+bool operator==(const BoxShadowKey& a, const BoxShadowKey& b);
+
+} // namespace Rml
+
+namespace std {
+// Hash specialization for the box-shadow key, so it can be used as key in UnorderedMap.
+template <>
+struct hash<::Rml::BoxShadowKey> {
+	std::size_t operator()(const ::Rml::BoxShadowKey& key) const;
+};
+} // namespace std
+
+namespace Rml {
+
+/**
+    Shares generated box-shadow textures between the elements of a context.
+
+    Textures are owned by the elements using them, and the cache only keeps weak references to them. Thus, a texture is released as soon as no
+    element uses it anymore, and elements with identical box-shadows generate their texture only once.
+ */
+
+class BoxShadowCache : NonCopyMoveable {
+public:
+	/// Returns a texture shared by all users of the given key. The callback is used to generate the texture if it is not already in use.
+	/// @param[in] key The key describing the box-shadow.
+	/// @param[in] dimensions The dimensions of the texture generated by the callback.
+	/// @param[in] callback Called to generate the texture on first use, see Texture::Set.
+	/// @return The shared texture, keep the pointer for as long as the texture is used.
+	SharedPtr<const Texture> GetTexture(const BoxShadowKey& key, Vector2i dimensions, const TextureCallback& callback);
+
+	BoxShadowCacheStatistics GetStatistics() const;
+
+private:
+	struct Entry {
+		Texture texture;
+		Vector2i dimensions;
+	};
+
+	// Removes entries of textures no longer used by any element.
+	void RemoveExpiredEntries();
+
+	UnorderedMap<BoxShadowKey, WeakPtr<Entry>> entries;
+	size_t max_size_before_cleanup = 64;
+
+	size_t num_hits = 0;
+	size_t num_misses = 0;
+};
+
+} // namespace Rml
+#endif
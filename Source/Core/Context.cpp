@@ -39,10 +39,15 @@
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "BoxShadowCache.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "FrameProfiler.h"
+#include "HitTestGrid.h"
 #include "PluginRegistry.h"
 #include "StreamFile.h"
+#include "TextureDatabase.h"
+#include "TextureLoader.h"
 #include <algorithm>
 #include <iterator>
 
@@ -96,6 +101,8 @@ Context::Context(const String& name, RenderInterface* render_interface) :
 	last_click_element = nullptr;
 	last_click_time = 0;
 	last_click_mouse_position = Vector2i(0, 0);
+
+	frame_profiler = MakeUnique<FrameProfiler>();
 }
 
 Context::~Context()
@@ -178,18 +185,47 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
-	// Update all data models first
-	for (auto& data_model : data_models)
-		data_model.second->Update(true);
+	frame_profiler->NextFrame();
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	// Generate the textures loaded in the background, and let the elements waiting for them know.
+	if (TextureLoader* texture_loader = TextureDatabase::GetTextureLoader())
+	{
+		Vector<ObserverPtr<Element>> loaded_elements;
+		{
+			FrameProfiler::PhaseScope phase(*frame_profiler, FrameProfiler::Phase::Render);
+			texture_loader->Process(GetRenderInterface(), loaded_elements);
+		}
 
-	for (int i = 0; i < root->GetNumChildren(); ++i)
-		if (auto doc = root->GetChild(i)->GetOwnerDocument())
+		for (ObserverPtr<Element>& element : loaded_elements)
 		{
-			doc->UpdateLayout();
-			doc->UpdatePosition();
+			if (element)
+				element->OnTextureLoad();
+			if (element)
+				element->DispatchEvent(EventId::Load, Dictionary());
 		}
+	}
+
+	// Update all data models first
+	{
+		FrameProfiler::PhaseScope phase(*frame_profiler, FrameProfiler::Phase::DataModels);
+		for (auto& data_model : data_models)
+			data_model.second->Update(true);
+	}
+
+	{
+		FrameProfiler::PhaseScope phase(*frame_profiler, FrameProfiler::Phase::Style);
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	}
+
+	{
+		FrameProfiler::PhaseScope phase(*frame_profiler, FrameProfiler::Phase::Layout);
+		for (int i = 0; i < root->GetNumChildren(); ++i)
+			if (auto doc = root->GetChild(i)->GetOwnerDocument())
+			{
+				doc->UpdateLayout();
+				doc->UpdatePosition();
+			}
+	}
 
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
@@ -206,6 +242,8 @@ bool Context::Render()
 	if (!render_interface)
 		return false;
 
+	FrameProfiler::PhaseScope phase(*frame_profiler, FrameProfiler::Phase::Render);
+
 	render_interface->context = this;
 	render_state.BeginRender();
 
@@ -224,6 +262,9 @@ bool Context::Render()
 	render_state.Reset();
 	render_interface->context = nullptr;
 
+	// Keep the textures within their memory budget, now that the textures used during this frame have been marked.
+	TextureDatabase::NextFrame();
+
 	return true;
 }
 
@@ -476,7 +517,7 @@ void Context::PullDocumentToFront(ElementDocument* document)
 				root->children.erase(root->children.begin() + i);
 				root->children.insert(root->children.begin() + root->GetNumChildren(), std::move(element));
 
-				root->DirtyStackingContext();
+				root->DirtyStackingContextChild(document);
 			}
 		}
 	}
@@ -496,7 +537,7 @@ void Context::PushDocumentToBack(ElementDocument* document)
 				root->children.erase(root->children.begin() + i);
 				root->children.insert(root->children.begin(), std::move(element));
 
-				root->DirtyStackingContext();
+				root->DirtyStackingContextChild(document);
 			}
 		}
 	}
@@ -834,6 +875,25 @@ RenderState& Context::GetRenderState()
 	return render_state;
 }
 
+BoxShadowCacheStatistics Context::GetBoxShadowCacheStatistics() const
+{
+	if (!box_shadow_cache)
+		return {};
+	return box_shadow_cache->GetStatistics();
+}
+
+FrameStatistics Context::GetFrameStatistics() const
+{
+	return frame_profiler->GetStatistics();
+}
+
+BoxShadowCache& Context::GetBoxShadowCache()
+{
+	if (!box_shadow_cache)
+		box_shadow_cache = MakeUnique<BoxShadowCache>();
+	return *box_shadow_cache;
+}
+
 // Sets the instancer to use for releasing this object.
 void Context::SetInstancer(ContextInstancer* _instancer)
 {
@@ -1133,6 +1193,9 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		}
 	}
 
+	// Documents maintain a spatial index of their elements, use it instead of traversing the whole stacking context tree.
+	if (element != root.get() && element->GetOwnerDocument() == element)
+		return static_cast<ElementDocument*>(element)->GetElementAtPoint(point, ignore_element);
 
 	// Check any elements within our stacking context. We want to return the lowest-down element
 	// that is under the cursor.
@@ -1164,23 +1227,7 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 		}
 	}
 
-	// Ignore elements whose pointer events are disabled.
-	if (element->GetComputedValues().pointer_events() == Style::PointerEvents::None)
-		return nullptr;
-
-	// Projection may fail if we have a singular transformation matrix.
-	bool projection_result = element->Project(point);
-
-	// Check if the point is actually within this element.
-	bool within_element = (projection_result && element->IsPointWithinElement(point));
-	if (within_element)
-	{
-		Rectanglei clip_region;
-		if (ElementUtilities::GetClippingRegion(clip_region, element))
-			within_element = clip_region.Contains(Vector2i(point));
-	}
-
-	if (within_element)
+	if (HitTestGrid::IsElementAtPoint(element, point))
 		return element;
 
 	return nullptr;
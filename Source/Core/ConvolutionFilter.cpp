@@ -28,11 +28,255 @@
 
 #include "../../Include/RmlUi/Core/ConvolutionFilter.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "Memory.h"
+#include <algorithm>
 #include <float.h>
 #include <string.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define RMLUI_CONVOLUTION_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define RMLUI_CONVOLUTION_NEON
+#endif
+
 namespace Rml {
 
+// Spans of equally weighted kernel values at least this long are evaluated using a running extremum for dilation and erosion.
+static constexpr int min_running_extremum_length = 4;
+
+using FloatArray = DynamicArray<float, GlobalStackAllocator<float>>;
+
+template <FilterOperation operation>
+static inline float Accumulate(float accumulated, float value)
+{
+	return operation == FilterOperation::Sum ? accumulated + value
+		: (operation == FilterOperation::Dilation ? Math::Max(accumulated, value) : Math::Min(accumulated, value));
+}
+
+// Accumulates a row of weighted source values into the destination row.
+template <FilterOperation operation>
+static void AccumulateRow(float* destination, const float* source, const float weight, const int num_values)
+{
+	int i = 0;
+
+#if defined(RMLUI_CONVOLUTION_SSE2)
+	const __m128 weight4 = _mm_set1_ps(weight);
+	for (; i + 4 <= num_values; i += 4)
+	{
+		const __m128 value = _mm_mul_ps(_mm_loadu_ps(source + i), weight4);
+		const __m128 accumulated = _mm_loadu_ps(destination + i);
+		switch (operation)
+		{
+		case FilterOperation::Sum: _mm_storeu_ps(destination + i, _mm_add_ps(accumulated, value)); break;
+		case FilterOperation::Dilation: _mm_storeu_ps(destination + i, _mm_max_ps(accumulated, value)); break;
+		case FilterOperation::Erosion: _mm_storeu_ps(destination + i, _mm_min_ps(accumulated, value)); break;
+		}
+	}
+#elif defined(RMLUI_CONVOLUTION_NEON)
+	const float32x4_t weight4 = vdupq_n_f32(weight);
+	for (; i + 4 <= num_values; i += 4)
+	{
+		const float32x4_t value = vmulq_f32(vld1q_f32(source + i), weight4);
+		const float32x4_t accumulated = vld1q_f32(destination + i);
+		switch (operation)
+		{
+		case FilterOperation::Sum: vst1q_f32(destination + i, vaddq_f32(accumulated, value)); break;
+		case FilterOperation::Dilation: vst1q_f32(destination + i, vmaxq_f32(accumulated, value)); break;
+		case FilterOperation::Erosion: vst1q_f32(destination + i, vminq_f32(accumulated, value)); break;
+		}
+	}
+#endif
+
+	for (; i < num_values; i++)
+		destination[i] = Accumulate<operation>(destination[i], source[i] * weight);
+}
+
+// Finds the extremum of every window of the given length along each row of the source plane, using the van Herk/Gil-Werman
+// algorithm. The rows are split into blocks of the window length, and the running extremum is computed from both ends of each
+// block. Then, any window is covered by the suffix of one block and the prefix of the next one.
+template <FilterOperation operation>
+static void RunningExtremum(float* destination, const float* source, const Vector2i source_dimensions, const int window_length)
+{
+	const int row_length = source_dimensions.x;
+	const int num_windows = row_length - window_length + 1;
+
+	FloatArray prefix(row_length);
+	FloatArray suffix(row_length);
+
+	for (int y = 0; y < source_dimensions.y; y++)
+	{
+		const float* source_row = source + y * row_length;
+
+		for (int block_begin = 0; block_begin < row_length; block_begin += window_length)
+		{
+			const int block_end = Math::Min(block_begin + window_length, row_length);
+
+			prefix[block_begin] = source_row[block_begin];
+			for (int i = block_begin + 1; i < block_end; i++)
+				prefix[i] = Accumulate<operation>(prefix[i - 1], source_row[i]);
+
+			suffix[block_end - 1] = source_row[block_end - 1];
+			for (int i = block_end - 2; i >= block_begin; i--)
+				suffix[i] = Accumulate<operation>(suffix[i + 1], source_row[i]);
+		}
+
+		float* destination_row = destination + y * num_windows;
+		for (int x = 0; x < num_windows; x++)
+			destination_row[x] = Accumulate<operation>(suffix[x], prefix[x + window_length - 1]);
+	}
+}
+
+// Factors the kernel into a column and a row vector such that kernel[y][x] = column[y] * row[x], if possible.
+static bool FactorKernel(const float* kernel, const Vector2i kernel_size, float* column, float* row)
+{
+	int pivot_index = 0;
+	for (int i = 1; i < kernel_size.x * kernel_size.y; i++)
+	{
+		if (Math::AbsoluteValue(kernel[i]) > Math::AbsoluteValue(kernel[pivot_index]))
+			pivot_index = i;
+	}
+
+	const float pivot = kernel[pivot_index];
+	if (pivot == 0.f)
+		return false;
+
+	const int pivot_x = pivot_index % kernel_size.x;
+	const int pivot_y = pivot_index / kernel_size.x;
+
+	for (int x = 0; x < kernel_size.x; x++)
+		row[x] = kernel[pivot_y * kernel_size.x + x] / pivot;
+	for (int y = 0; y < kernel_size.y; y++)
+		column[y] = kernel[y * kernel_size.x + pivot_x];
+
+	const float tolerance = 1e-5f * Math::AbsoluteValue(pivot);
+	for (int y = 0; y < kernel_size.y; y++)
+	{
+		for (int x = 0; x < kernel_size.x; x++)
+		{
+			if (Math::AbsoluteValue(column[y] * row[x] - kernel[y * kernel_size.x + x]) > tolerance)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+// Runs the filter on the padded source plane, where each result value is computed from the kernel-sized area at the same coordinates in the plane.
+template <FilterOperation operation>
+static void RunKernel(float* result, const Vector2i result_dimensions, const float* plane, const Vector2i plane_dimensions, const float* kernel,
+	const Vector2i kernel_size)
+{
+	for (int kernel_y = 0; kernel_y < kernel_size.y; kernel_y++)
+	{
+		for (int kernel_x = 0; kernel_x < kernel_size.x; kernel_x++)
+		{
+			// Zero-weighted values do not contribute to the sum, nor the dilation since the result is never negative.
+			const float weight = kernel[kernel_y * kernel_size.x + kernel_x];
+			if ((operation == FilterOperation::Sum && weight == 0.f) || (operation == FilterOperation::Dilation && weight <= 0.f))
+				continue;
+
+			for (int y = 0; y < result_dimensions.y; y++)
+				AccumulateRow<operation>(result + y * result_dimensions.x, plane + (y + kernel_y) * plane_dimensions.x + kernel_x, weight,
+					result_dimensions.x);
+		}
+	}
+}
+
+// Runs a sum filter with a separable kernel as two one-dimensional passes.
+static void RunSeparableSum(float* result, const Vector2i result_dimensions, const float* plane, const Vector2i plane_dimensions,
+	const float* column, const float* row, const Vector2i kernel_size)
+{
+	// The horizontal pass is done for all the rows needed by the vertical pass.
+	const Vector2i horizontal_dimensions(result_dimensions.x, plane_dimensions.y);
+	FloatArray horizontal(horizontal_dimensions.x * horizontal_dimensions.y);
+	std::fill(horizontal.data(), horizontal.data() + horizontal_dimensions.x * horizontal_dimensions.y, 0.f);
+
+	RunKernel<FilterOperation::Sum>(horizontal.data(), horizontal_dimensions, plane, plane_dimensions, row, Vector2i(kernel_size.x, 1));
+	RunKernel<FilterOperation::Sum>(result, result_dimensions, horizontal.data(), horizontal_dimensions, column, Vector2i(1, kernel_size.y));
+}
+
+// Runs a dilation or erosion filter. Each kernel row is split into spans of equal weights, where the long spans are evaluated
+// using the running extremum of the source plane, thereby making the cost independent of their length.
+template <FilterOperation operation>
+static void RunMorphology(float* result, const Vector2i result_dimensions, const float* plane, const Vector2i plane_dimensions,
+	const float* kernel, const Vector2i kernel_size)
+{
+	struct Span {
+		int length;
+		int kernel_x, kernel_y;
+		float weight;
+	};
+
+	Vector<Span> spans;
+
+	for (int kernel_y = 0; kernel_y < kernel_size.y; kernel_y++)
+	{
+		const float* kernel_row = kernel + kernel_y * kernel_size.x;
+		for (int kernel_x = 0; kernel_x < kernel_size.x;)
+		{
+			// See 'RunKernel' for skipped weights. Negative weights reverse the order of the values, thus they are never grouped.
+			const float weight = kernel_row[kernel_x];
+			if (operation == FilterOperation::Dilation && weight <= 0.f)
+			{
+				kernel_x += 1;
+				continue;
+			}
+
+			int span_end = kernel_x + 1;
+			if (weight >= 0.f)
+			{
+				while (span_end < kernel_size.x && kernel_row[span_end] == weight)
+					span_end += 1;
+			}
+
+			spans.push_back(Span{span_end - kernel_x, kernel_x, kernel_y, weight});
+			kernel_x = span_end;
+		}
+	}
+
+	std::sort(spans.begin(), spans.end(), [](const Span& a, const Span& b) { return a.length < b.length; });
+
+	const int max_window_length = (spans.empty() ? 0 : spans.back().length);
+	FloatArray windows(max_window_length >= min_running_extremum_length ? plane_dimensions.x * plane_dimensions.y : 1);
+
+	for (size_t i = 0; i < spans.size();)
+	{
+		const int length = spans[i].length;
+		size_t group_end = i;
+		while (group_end < spans.size() && spans[group_end].length == length)
+			group_end += 1;
+
+		if (length < min_running_extremum_length)
+		{
+			for (; i < group_end; i++)
+			{
+				const Span& span = spans[i];
+				for (int x = 0; x < span.length; x++)
+				{
+					for (int y = 0; y < result_dimensions.y; y++)
+						AccumulateRow<operation>(result + y * result_dimensions.x,
+							plane + (y + span.kernel_y) * plane_dimensions.x + span.kernel_x + x, span.weight, result_dimensions.x);
+				}
+			}
+		}
+		else
+		{
+			const Vector2i windows_dimensions(plane_dimensions.x - length + 1, plane_dimensions.y);
+			RunningExtremum<operation>(windows.data(), plane, plane_dimensions, length);
+
+			for (; i < group_end; i++)
+			{
+				const Span& span = spans[i];
+				for (int y = 0; y < result_dimensions.y; y++)
+					AccumulateRow<operation>(result + y * result_dimensions.x,
+						windows.data() + (y + span.kernel_y) * windows_dimensions.x + span.kernel_x, span.weight, result_dimensions.x);
+			}
+		}
+	}
+}
+
 ConvolutionFilter::ConvolutionFilter()
 {}
 
@@ -75,47 +319,70 @@ void ConvolutionFilter::Run(byte* destination, const Vector2i destination_dimens
 {
 	RMLUI_ZoneScopedNC("ConvFilter::Run", 0xd6bf49);
 
+	if (destination_dimensions.x <= 0 || destination_dimensions.y <= 0)
+		return;
+
 	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
 	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
 	const int source_alpha_offset = (source_color_format == ColorFormat::RGBA8 ? 3 : 0);
 
-	const float initial_opacity = (operation == FilterOperation::Erosion ? FLT_MAX : 0.f);
-
 	const Vector2i kernel_radius = (kernel_size - Vector2i(1)) / 2;
 
-	for (int y = 0; y < destination_dimensions.y; ++y)
+	// Copy the source opacity into a zero-padded plane, such that each destination pixel is computed from the kernel-sized area at
+	// the same coordinates within the plane. This avoids any bounds checking in the filter loops.
+	const Vector2i plane_dimensions = destination_dimensions + kernel_size - Vector2i(1);
+	const Vector2i plane_offset = source_offset + kernel_radius;
+
+	FloatArray plane(plane_dimensions.x * plane_dimensions.y);
+	std::fill(plane.data(), plane.data() + plane_dimensions.x * plane_dimensions.y, 0.f);
+
+	const int source_x_begin = Math::Max(-plane_offset.x, 0);
+	const int source_x_end = Math::Min(plane_dimensions.x - plane_offset.x, source_dimensions.x);
+	const int source_y_begin = Math::Max(-plane_offset.y, 0);
+	const int source_y_end = Math::Min(plane_dimensions.y - plane_offset.y, source_dimensions.y);
+
+	for (int source_y = source_y_begin; source_y < source_y_end; source_y++)
 	{
-		for (int x = 0; x < destination_dimensions.x; ++x)
-		{
-			float opacity = initial_opacity;
+		const byte* source_row = source + source_y * source_dimensions.x * source_bytes_per_pixel + source_alpha_offset;
+		float* plane_row = plane.data() + (source_y + plane_offset.y) * plane_dimensions.x + plane_offset.x;
 
-			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
-			{
-				const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+		for (int source_x = source_x_begin; source_x < source_x_end; source_x++)
+			plane_row[source_x] = float(source_row[source_x * source_bytes_per_pixel]);
+	}
 
-				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
-				{
-					float pixel_opacity = 0.f;
-
-					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
-					if (source_y >= 0 && source_y < source_dimensions.y &&
-						source_x >= 0 && source_x < source_dimensions.x)
-					{
-						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
-						pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
-					}
-
-					switch (operation)
-					{
-					case FilterOperation::Sum:      opacity += pixel_opacity; break;
-					case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
-					case FilterOperation::Erosion:  opacity = Math::Min(opacity, pixel_opacity); break;
-					}
-				}
-			}
+	const int num_results = destination_dimensions.x * destination_dimensions.y;
+	FloatArray result(num_results);
+	std::fill(result.data(), result.data() + num_results, operation == FilterOperation::Erosion ? FLT_MAX : 0.f);
+
+	switch (operation)
+	{
+	case FilterOperation::Sum:
+	{
+		FloatArray column(kernel_size.y);
+		FloatArray row(kernel_size.x);
+
+		if (kernel_size.x > 1 && kernel_size.y > 1 && FactorKernel(kernel.get(), kernel_size, column.data(), row.data()))
+			RunSeparableSum(result.data(), destination_dimensions, plane.data(), plane_dimensions, column.data(), row.data(), kernel_size);
+		else
+			RunKernel<FilterOperation::Sum>(result.data(), destination_dimensions, plane.data(), plane_dimensions, kernel.get(), kernel_size);
+	}
+	break;
+	case FilterOperation::Dilation:
+		RunMorphology<FilterOperation::Dilation>(result.data(), destination_dimensions, plane.data(), plane_dimensions, kernel.get(), kernel_size);
+		break;
+	case FilterOperation::Erosion:
+		RunMorphology<FilterOperation::Erosion>(result.data(), destination_dimensions, plane.data(), plane_dimensions, kernel.get(), kernel_size);
+		break;
+	}
 
-			opacity = Math::Min(255.f, opacity);
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		const float* result_row = result.data() + y * destination_dimensions.x;
+
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			const float opacity = Math::Min(255.f, result_row[x]);
 
 			const int destination_index = x * destination_bytes_per_pixel + destination_alpha_offset;
 			destination[destination_index] = byte(opacity);
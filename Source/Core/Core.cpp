@@ -371,6 +371,21 @@ void ReleaseTextures(RenderInterface* in_render_interface)
 	TextureDatabase::ReleaseTextures(in_render_interface);
 }
 
+void SetAsyncTextureLoading(int upload_budget, const String& placeholder_source)
+{
+	TextureDatabase::SetAsyncLoading(upload_budget, placeholder_source);
+}
+
+void SetTextureMemoryBudget(size_t budget, int min_unused_frames)
+{
+	TextureDatabase::SetMemoryBudget(budget, min_unused_frames);
+}
+
+TextureMemoryStatistics GetTextureMemoryStatistics()
+{
+	return TextureDatabase::GetMemoryStatistics();
+}
+
 void ReleaseCompiledGeometry()
 {
 	return GeometryDatabase::ReleaseAll();
@@ -69,5 +69,12 @@ void DataControllers::OnElementRemove(Element* element)
 	controllers.erase(element);
 }
 
+void DataControllers::ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	auto range = controllers.equal_range(element);
+	for (auto it = range.first; it != range.second; ++it)
+		it->second->ReplaceAddressPrefix(from_prefix, to_prefix);
+}
+
 
 } // namespace Rml
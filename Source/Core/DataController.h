@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/DataTypes.h"
 
 namespace Rml {
 
@@ -86,6 +87,9 @@ public:
     // @return True on success.
     virtual bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) = 0;
 
+    // Replaces the start of the controller's variable addresses when they match the given prefix.
+    virtual void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) = 0;
+
     // Returns the attached element if it still exists.
     Element* GetElement() const;
 
@@ -109,6 +113,8 @@ public:
 
     void OnElementRemove(Element* element);
 
+    void ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix);
+
 private:
     using ElementControllersMap = UnorderedMultimap<Element*, DataControllerPtr>;
     ElementControllersMap controllers;
@@ -61,6 +61,11 @@ bool DataControllerValue::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerValue::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	ReplaceDataAddressPrefix(address, from_prefix, to_prefix);
+}
+
 void DataControllerValue::ProcessEvent(Event& event)
 {
 	if (const Element* element = GetElement())
@@ -127,6 +132,12 @@ bool DataControllerEvent::Initialize(DataModel& model, Element* element, const S
 	return true;
 }
 
+void DataControllerEvent::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	if (expression)
+		expression->ReplaceAddressPrefix(from_prefix, to_prefix);
+}
+
 void DataControllerEvent::ProcessEvent(Event& event)
 {
 	if (!expression)
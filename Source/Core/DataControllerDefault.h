@@ -49,6 +49,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) override;
+
 private:
     // Responds to 'Change' events.
     void ProcessEvent(Event& event) override;
@@ -67,6 +69,8 @@ public:
 
     bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
+    void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) override;
+
 protected:
     // Responds to the event type specified in the attribute modifier.
     void ProcessEvent(Event& event) override;
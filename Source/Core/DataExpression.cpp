@@ -67,6 +67,7 @@ enum class Instruction {
 	                        // Assignment (register/stack) = Read (register R/L/C, instruction data D, or stack)
 	Push         = 'P',     //      S+ = R
 	Pop          = 'o',     // <R/L/C> = S-  (D determines R/L/C)
+	Move         = 'M',     //       L = R   (R is left unspecified)
 	Literal      = 'D',     //       R = D
 	Variable     = 'V',     //       R = DataModel.GetVariable(D)  (D is an index into the variable address list)
 	Add          = '+',     //       R = L + R
@@ -85,6 +86,7 @@ enum class Instruction {
 	Ternary      = '?',     //       R = L ? C : R
 	Arguments    = 'a',     //      A+ = S-  (Repeated D times, where D gives the num. arguments)
 	TransformFnc = 'T',     //       R = DataModel.Execute( D, R, A ); A.Clear();  (D determines function name, R the input value, A the arguments)
+	                        //                                                     (the function is called directly when resolved during parsing)
 	EventFnc     = 'E',     //       DataModel.EventCallback(D, A); A.Clear();
 	Assign       = 'A',     //       DataModel.SetVariable(D, R)
 };
@@ -98,8 +100,19 @@ enum class Register {
 struct InstructionData {
 	Instruction instruction;
 	Variant data;
+	// Transform function called by the instruction, if it was registered when the expression was parsed.
+	const DataTransformFunc* transform_func = nullptr;
 };
 
+struct ParsedDataExpression {
+	Program program;
+	// Names of the variables referred to by the program, their addresses are resolved separately for each expression.
+	StringList variable_names;
+};
+
+// Replaces the instructions at the end of the program by a single literal, if they only operate on literals.
+static void FoldConstants(Program& program);
+
 namespace Parse {
 	static void Assignment(DataParser& parser);
 	static void Expression(DataParser& parser);
@@ -165,9 +178,11 @@ public:
 	{
 		program.clear();
 		variable_addresses.clear();
+		variable_names.clear();
 		index = 0;
 		reached_end = false;
 		parse_error = false;
+		program_stack_size = 0;
 		if (expression.empty())
 			reached_end = true;
 
@@ -198,13 +213,20 @@ public:
 		RMLUI_ASSERT(!parse_error);
 		return std::move(variable_addresses);
 	}
+	StringList ReleaseVariableNames() {
+		RMLUI_ASSERT(!parse_error);
+		return std::move(variable_names);
+	}
 
 	void Emit(Instruction instruction, Variant data = Variant())
 	{
 		RMLUI_ASSERTMSG(instruction != Instruction::Push && instruction != Instruction::Pop &&
-			instruction != Instruction::Arguments && instruction != Instruction::Variable && instruction != Instruction::Assign,
-			"Use the Push(), Pop(), Arguments(), Variable(), and Assign() procedures for stack manipulation and variable instructions.");
+			instruction != Instruction::Arguments && instruction != Instruction::Variable && instruction != Instruction::Assign &&
+			instruction != Instruction::Move && instruction != Instruction::TransformFnc,
+			"Use the Push(), Pop(), Arguments(), Variable(), Assign(), and TransformFunction() procedures for stack manipulation, variable, and "
+			"transform function instructions.");
 		program.push_back(InstructionData{ instruction, std::move(data) });
+		FoldConstants(program);
 	}
 	void Push() {
 		program_stack_size += 1;
@@ -216,6 +238,16 @@ public:
 			return;
 		}
 		program_stack_size -= 1;
+
+		// A single literal or variable between the push and pop only writes to R, thus the value can be moved directly to L instead.
+		const size_t size = program.size();
+		if (destination == Register::L && size >= 2 && program[size - 2].instruction == Instruction::Push &&
+			(program[size - 1].instruction == Instruction::Literal || program[size - 1].instruction == Instruction::Variable))
+		{
+			program[size - 2].instruction = Instruction::Move;
+			return;
+		}
+
 		program.push_back(InstructionData{ Instruction::Pop, Variant(int(destination)) });
 	}
 	void Arguments(int num_arguments) {
@@ -232,6 +264,9 @@ public:
 	void Assign(const String& name) {
 		VariableGetSet(name, true);
 	}
+	void TransformFunction(const String& name) {
+		program.push_back(InstructionData{ Instruction::TransformFnc, Variant(name), expression_interface.GetTransformFunc(name) });
+	}
 
 private:
 	void VariableGetSet(const String& name, bool is_assignment)
@@ -243,6 +278,7 @@ private:
 		}
 		int index = int(variable_addresses.size());
 		variable_addresses.push_back(std::move(address));
+		variable_names.push_back(name);
 		program.push_back(InstructionData{ is_assignment ? Instruction::Assign : Instruction::Variable, Variant(int(index)) });
 	}
 
@@ -257,6 +293,7 @@ private:
 	Program program;
 	
 	AddressList variable_addresses;
+	StringList variable_names;
 };
 
 
@@ -742,7 +779,10 @@ namespace Parse {
 			parser.SkipWhitespace();
 		}
 
-		parser.Emit(function_type, Variant(func_name));
+		if (function_type == Instruction::TransformFnc)
+			parser.TransformFunction(func_name);
+		else
+			parser.Emit(function_type, Variant(func_name));
 	}
 
 
@@ -752,8 +792,9 @@ namespace Parse {
 
 class DataInterpreter {
 public:
-	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface)
-		: program(program), addresses(addresses), expression_interface(expression_interface) {}
+	DataInterpreter(const Program& program, const AddressList& addresses, DataExpressionInterface expression_interface,
+		const Vector<DataVariable>* variables = nullptr)
+		: program(program), addresses(addresses), expression_interface(expression_interface), variables(variables) {}
 
 	bool Error(String message) const
 	{
@@ -768,7 +809,7 @@ public:
 		bool success = true;
 		for (size_t i = 0; i < program.size(); i++)
 		{
-			if (!Execute(program[i].instruction, program[i].data))
+			if (!Execute(program[i]))
 			{
 				success = false;
 				break;
@@ -799,31 +840,38 @@ public:
 		return str;
 	}
 
-	Variant Result() const {
+	const Variant& Result() const {
 		return R;
 	}
+	Variant ReleaseResult() {
+		return std::move(R);
+	}
 
 
 private:
 	Variant R, L, C;
-	Stack<Variant> stack;
+	Vector<Variant> stack;
 	Vector<Variant> arguments;
 
 	const Program& program;
 	const AddressList& addresses;
 	DataExpressionInterface expression_interface;
+	const Vector<DataVariable>* variables;
 
-	bool Execute(const Instruction instruction, const Variant& data)
+	bool Execute(const InstructionData& instruction_data)
 	{
 		auto AnyString = [](const Variant& v1, const Variant& v2) {
 			return v1.GetType() == Variant::STRING || v2.GetType() == Variant::STRING;
 		};
 
-		switch (instruction)
+		const Variant& data = instruction_data.data;
+
+		// Results are assigned to the registers directly from their value types, avoiding temporary variants.
+		switch (instruction_data.instruction)
 		{
 		case Instruction::Push:
 		{
-			stack.push(std::move(R));
+			stack.push_back(std::move(R));
 			R.Clear();
 		}
 		break;
@@ -834,14 +882,19 @@ private:
 
 			Register reg = Register(data.Get<int>(-1));
 			switch (reg) {
-			case Register::R:  R = stack.top(); stack.pop(); break;
-			case Register::L:  L = stack.top(); stack.pop(); break;
-			case Register::C:  C = stack.top(); stack.pop(); break;
+			case Register::R:  R = std::move(stack.back()); stack.pop_back(); break;
+			case Register::L:  L = std::move(stack.back()); stack.pop_back(); break;
+			case Register::C:  C = std::move(stack.back()); stack.pop_back(); break;
 			default:
 				return Error(CreateString(50, "Invalid register %d.", int(reg)));
 			}
 		}
 		break;
+		case Instruction::Move:
+		{
+			L = std::move(R);
+		}
+		break;
 		case Instruction::Literal:
 		{
 			R = data;
@@ -850,50 +903,58 @@ private:
 		case Instruction::Variable:
 		{
 			size_t variable_index = size_t(data.Get<int>(-1));
-			if (variable_index < addresses.size())
-				R = expression_interface.GetValue(addresses[variable_index]);
-			else
+			if (variable_index >= addresses.size())
 				return Error("Variable address not found.");
+
+			// Use the variable resolved during parsing when available, otherwise look it up from its address.
+			DataVariable variable = (variables && variable_index < variables->size() ? (*variables)[variable_index] : DataVariable());
+			R.Clear();
+			if (!variable || !variable.Get(R))
+				R = expression_interface.GetValue(addresses[variable_index]);
 		}
 		break;
 		case Instruction::Add:
 		{
 			if (AnyString(L, R))
-				R = Variant(L.Get<String>() + R.Get<String>());
+				R = L.Get<String>() + R.Get<String>();
 			else
-				R = Variant(L.Get<double>() + R.Get<double>());
+				R = L.Get<double>() + R.Get<double>();
 		}
 		break;
-		case Instruction::Subtract:  R = Variant(L.Get<double>() - R.Get<double>());  break;
-		case Instruction::Multiply:  R = Variant(L.Get<double>() * R.Get<double>());  break;
-		case Instruction::Divide:    R = Variant(L.Get<double>() / R.Get<double>());  break;
-		case Instruction::Not:       R = Variant(!R.Get<bool>());                     break;
-		case Instruction::And:       R = Variant(L.Get<bool>() && R.Get<bool>());     break;
-		case Instruction::Or:        R = Variant(L.Get<bool>() || R.Get<bool>());     break;
-		case Instruction::Less:      R = Variant(L.Get<double>() < R.Get<double>());  break;
-		case Instruction::LessEq:    R = Variant(L.Get<double>() <= R.Get<double>()); break;
-		case Instruction::Greater:   R = Variant(L.Get<double>() > R.Get<double>());  break;
-		case Instruction::GreaterEq: R = Variant(L.Get<double>() >= R.Get<double>()); break;
+		case Instruction::Subtract:  R = L.Get<double>() - R.Get<double>();  break;
+		case Instruction::Multiply:  R = L.Get<double>() * R.Get<double>();  break;
+		case Instruction::Divide:    R = L.Get<double>() / R.Get<double>();  break;
+		case Instruction::Not:       R = !R.Get<bool>();                     break;
+		case Instruction::And:       R = L.Get<bool>() && R.Get<bool>();     break;
+		case Instruction::Or:        R = L.Get<bool>() || R.Get<bool>();     break;
+		case Instruction::Less:      R = L.Get<double>() < R.Get<double>();  break;
+		case Instruction::LessEq:    R = L.Get<double>() <= R.Get<double>(); break;
+		case Instruction::Greater:   R = L.Get<double>() > R.Get<double>();  break;
+		case Instruction::GreaterEq: R = L.Get<double>() >= R.Get<double>(); break;
 		case Instruction::Equal:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() == R.Get<String>());
+			if (L.GetType() == Variant::STRING && R.GetType() == Variant::STRING)
+				R = (L.GetReference<String>() == R.GetReference<String>());
+			else if (AnyString(L, R))
+				R = L.Get<String>() == R.Get<String>();
 			else
-				R = Variant(L.Get<double>() == R.Get<double>());
+				R = L.Get<double>() == R.Get<double>();
 		}
 		break;
 		case Instruction::NotEqual:
 		{
-			if (AnyString(L, R))
-				R = Variant(L.Get<String>() != R.Get<String>());
+			if (L.GetType() == Variant::STRING && R.GetType() == Variant::STRING)
+				R = (L.GetReference<String>() != R.GetReference<String>());
+			else if (AnyString(L, R))
+				R = L.Get<String>() != R.Get<String>();
 			else
-				R = Variant(L.Get<double>() != R.Get<double>());
+				R = L.Get<double>() != R.Get<double>();
 		}
 		break;
 		case Instruction::Ternary:
 		{
 			if (L.Get<bool>())
-				R = C;
+				R = std::move(C);
 		}
 		break;
 		case Instruction::Arguments:
@@ -910,16 +971,17 @@ private:
 			arguments.resize(num_arguments);
 			for (int i = num_arguments - 1; i >= 0; i--)
 			{
-				arguments[i] = std::move(stack.top());
-				stack.pop();
+				arguments[i] = std::move(stack.back());
+				stack.pop_back();
 			}
 		}
 		break;
 		case Instruction::TransformFnc:
 		{
-			const String function_name = data.Get<String>();
-			
-			if (!expression_interface.CallTransform(function_name, R, arguments))
+			const String& function_name = data.GetReference<String>();
+			const DataTransformFunc* transform_func = instruction_data.transform_func;
+
+			if (transform_func ? !(*transform_func)(R, arguments) : !expression_interface.CallTransform(function_name, R, arguments))
 			{
 				String arguments_str;
 				for (size_t i = 0; i < arguments.size(); i++)
@@ -936,7 +998,7 @@ private:
 		break;
 		case Instruction::EventFnc:
 		{
-			const String function_name = data.Get<String>();
+			const String& function_name = data.GetReference<String>();
 
 			if (!expression_interface.EventCallback(function_name, arguments))
 			{
@@ -973,6 +1035,69 @@ private:
 };
 
 
+static void FoldConstants(Program& program)
+{
+	auto IsLiteral = [&program](size_t index_from_end) {
+		return program[program.size() - index_from_end].instruction == Instruction::Literal;
+	};
+	auto IsPop = [&program](size_t index_from_end, Register destination) {
+		const InstructionData& data = program[program.size() - index_from_end];
+		return data.instruction == Instruction::Pop && data.data.Get<int>(-1) == int(destination);
+	};
+
+	// Constant sub-expressions are folded as soon as their operation is emitted, thus all constant operands are single literals.
+	size_t num_instructions = 0;
+	switch (program.back().instruction)
+	{
+	case Instruction::Add:
+	case Instruction::Subtract:
+	case Instruction::Multiply:
+	case Instruction::Divide:
+	case Instruction::And:
+	case Instruction::Or:
+	case Instruction::Less:
+	case Instruction::LessEq:
+	case Instruction::Greater:
+	case Instruction::GreaterEq:
+	case Instruction::Equal:
+	case Instruction::NotEqual:
+	{
+		// Literal, Move, Literal, <operation>
+		if (program.size() >= 4 && IsLiteral(4) && program[program.size() - 3].instruction == Instruction::Move && IsLiteral(2))
+			num_instructions = 4;
+	}
+	break;
+	case Instruction::Not:
+	{
+		// Literal, Not
+		if (program.size() >= 2 && IsLiteral(2))
+			num_instructions = 2;
+	}
+	break;
+	case Instruction::Ternary:
+	{
+		// Literal, Push, Literal, Push, Literal, Pop C, Pop L, Ternary
+		if (program.size() >= 8 && IsLiteral(8) && IsLiteral(6) && IsLiteral(4) && IsPop(3, Register::C) && IsPop(2, Register::L))
+			num_instructions = 8;
+	}
+	break;
+	default: break;
+	}
+
+	if (num_instructions == 0)
+		return;
+
+	// Evaluate the instructions using the interpreter, so that the results are exactly the same as during execution.
+	const Program constant_program(program.end() - num_instructions, program.end());
+	const AddressList no_addresses;
+	DataInterpreter interpreter(constant_program, no_addresses, DataExpressionInterface());
+	if (!interpreter.Run())
+		return;
+
+	program.resize(program.size() - num_instructions);
+	program.push_back(InstructionData{ Instruction::Literal, interpreter.ReleaseResult() });
+}
+
 DataExpression::DataExpression(String expression) : expression(expression)
 {}
 
@@ -981,24 +1106,71 @@ DataExpression::~DataExpression()
 
 bool DataExpression::Parse(const DataExpressionInterface& expression_interface, bool is_assignment_expression)
 {
+	DataExpressionCache* cache = expression_interface.GetExpressionCache();
+
+	// Assignment expressions are parsed differently, keep them apart in the cache.
+	String cache_key;
+	if (cache)
+	{
+		cache_key.reserve(expression.size() + 1);
+		cache_key += (is_assignment_expression ? '=' : ' ');
+		cache_key += expression;
+
+		auto it = cache->find(cache_key);
+		if (it != cache->end())
+		{
+			// The program is shared, only the variable addresses need to be resolved for this element.
+			AddressList new_addresses;
+			new_addresses.reserve(it->second->variable_names.size());
+
+			for (const String& name : it->second->variable_names)
+			{
+				DataAddress address = expression_interface.ParseAddress(name);
+				if (address.empty())
+				{
+					Log::Message(Log::LT_WARNING, "Could not find data variable with name '%s' in data expression '%s'.", name.c_str(),
+						expression.c_str());
+					return false;
+				}
+				new_addresses.push_back(std::move(address));
+			}
+
+			parsed = it->second;
+			addresses = std::move(new_addresses);
+			ResolveVariables(expression_interface);
+			return true;
+		}
+	}
+
 	DataParser parser(expression, expression_interface);
 	if (!parser.Parse(is_assignment_expression))
 		return false;
 
-	program = parser.ReleaseProgram();
+	auto new_parsed = MakeShared<ParsedDataExpression>();
+	new_parsed->program = parser.ReleaseProgram();
+	new_parsed->variable_names = parser.ReleaseVariableNames();
 	addresses = parser.ReleaseAddresses();
 
+	if (cache)
+		(*cache)[cache_key] = new_parsed;
+
+	parsed = std::move(new_parsed);
+	ResolveVariables(expression_interface);
+
 	return true;
 }
 
 bool DataExpression::Run(const DataExpressionInterface& expression_interface, Variant& out_value)
 {
-	DataInterpreter interpreter(program, addresses, expression_interface);
-	
+	if (!parsed)
+		return false;
+
+	DataInterpreter interpreter(parsed->program, addresses, expression_interface, &variables);
+
 	if (!interpreter.Run())
 		return false;
 
-	out_value = interpreter.Result();
+	out_value = interpreter.ReleaseResult();
 	return true;
 }
 
@@ -1014,6 +1186,33 @@ StringList DataExpression::GetVariableNameList() const
 	return list;
 }
 
+const AddressList& DataExpression::GetVariableAddressList() const
+{
+	return addresses;
+}
+
+void DataExpression::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	for (size_t i = 0; i < addresses.size(); i++)
+	{
+		if (ReplaceDataAddressPrefix(addresses[i], from_prefix, to_prefix) && i < variables.size())
+			variables[i] = DataVariable();
+	}
+}
+
+void DataExpression::ResolveVariables(const DataExpressionInterface& expression_interface)
+{
+	variables.clear();
+	variables.resize(addresses.size());
+
+	// Only top-level variables are resolved, as the data of their children may be reallocated, e.g. when an array is resized.
+	for (size_t i = 0; i < addresses.size(); i++)
+	{
+		if (addresses[i].size() == 1)
+			variables[i] = expression_interface.GetVariable(addresses[i]);
+	}
+}
+
 DataExpressionInterface::DataExpressionInterface(DataModel* data_model, Element* element, Event* event) : data_model(data_model), element(element), event(event)
 {}
 
@@ -1041,6 +1240,11 @@ Variant DataExpressionInterface::GetValue(const DataAddress& address) const
 	return result;
 }
 
+DataVariable DataExpressionInterface::GetVariable(const DataAddress& address) const
+{
+	return data_model ? data_model->GetVariable(address) : DataVariable();
+}
+
 bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant& value) const
 {
 	bool result = false;
@@ -1055,6 +1259,16 @@ bool DataExpressionInterface::SetValue(const DataAddress& address, const Variant
 	return result;
 }
 
+DataExpressionCache* DataExpressionInterface::GetExpressionCache() const
+{
+	return data_model ? &data_model->GetExpressionCache() : nullptr;
+}
+
+const DataTransformFunc* DataExpressionInterface::GetTransformFunc(const String& name) const
+{
+	return data_model ? data_model->GetTransformFunc(name) : nullptr;
+}
+
 bool DataExpressionInterface::CallTransform(const String& name, Variant& inout_variant, const VariantList& arguments)
 {
 	return data_model ? data_model->CallTransform(name, inout_variant, arguments) : false;
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "../../Include/RmlUi/Core/DataVariable.h"
 
 namespace Rml {
 
@@ -41,6 +42,11 @@ struct InstructionData;
 using Program = Vector<InstructionData>;
 using AddressList = Vector<DataAddress>;
 
+// The parsed program of an expression string is independent of the element it is used on, thus it can be shared between
+// all identical expressions of a data model. This avoids parsing again, eg., for each iteration generated by 'data-for'.
+struct ParsedDataExpression;
+using DataExpressionCache = UnorderedMap<String, SharedPtr<const ParsedDataExpression>>;
+
 class DataExpressionInterface {
 public:
     DataExpressionInterface() = default;
@@ -48,9 +54,12 @@ public:
 
     DataAddress ParseAddress(const String& address_str) const;
     Variant GetValue(const DataAddress& address) const;
+    DataVariable GetVariable(const DataAddress& address) const;
     bool SetValue(const DataAddress& address, const Variant& value) const;
+    const DataTransformFunc* GetTransformFunc(const String& name) const;
     bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments);
     bool EventCallback(const String& name, const VariantList& arguments);
+    DataExpressionCache* GetExpressionCache() const;
 
 private:
     DataModel* data_model = nullptr;
@@ -70,12 +79,20 @@ public:
 
     // Available after Parse()
     StringList GetVariableNameList() const;
+    const AddressList& GetVariableAddressList() const;
+
+    // Replaces the start of the variable addresses when they match the given prefix.
+    void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix);
 
 private:
+    void ResolveVariables(const DataExpressionInterface& expression_interface);
+
     String expression;
     
-    Program program;
+    SharedPtr<const ParsedDataExpression> parsed;
     AddressList addresses;
+    // Variables of the addresses above resolved during parsing, or invalid if they must be looked up on every run.
+    Vector<DataVariable> variables;
 };
 
 } // namespace Rml
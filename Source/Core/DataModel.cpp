@@ -31,6 +31,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "DataController.h"
 #include "DataView.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -303,6 +304,9 @@ DataVariable DataModel::GetVariable(const DataAddress& address) const
 	{
 		if (address.size() > 2 && address[1].name == "int")
 			return MakeLiteralIntVariable(address[2].index);
+		// The index of a 'data-for' iteration, the remaining entries represent the address of the iterated element.
+		if (address.size() > 2 && address[1].name == "index")
+			return MakeLiteralIntVariable(address.back().index);
 	}
 
 	return DataVariable();
@@ -335,10 +339,46 @@ void DataModel::DirtyVariable(const String& variable_name)
 	dirty_variables.emplace(variable_name);
 }
 
+void DataModel::DirtyAddress(const DataAddress& address)
+{
+	if (address.empty())
+		return;
+
+	if (address.size() == 1)
+	{
+		DirtyVariable(address.front().name);
+		return;
+	}
+
+	RMLUI_ASSERTMSG(variables.count(address.front().name) == 1 || address.front().name == "literal",
+		"In DirtyAddress: Variable name not found among added variables.");
+
+	if (dirty_variables.count(address.front().name) == 1)
+		return;
+
+	dirty_addresses.push_back(address);
+}
+
+void DataModel::DirtyAddress(const String& address_str)
+{
+	DataAddress address = ParseAddress(address_str);
+	if (address.empty())
+	{
+		Log::Message(Log::LT_WARNING, "Could not dirty address '%s', invalid address.", address_str.c_str());
+		return;
+	}
+
+	DirtyAddress(address);
+}
+
 bool DataModel::IsVariableDirty(const String& variable_name) const
 {
 	RMLUI_ASSERTMSG(LegalVariableName(variable_name) == nullptr, "Illegal variable name provided. Only top-level variables can be dirtied.");
-	return dirty_variables.count(variable_name) == 1;
+	if (dirty_variables.count(variable_name) == 1)
+		return true;
+
+	return std::any_of(dirty_addresses.begin(), dirty_addresses.end(),
+		[&variable_name](const DataAddress& address) { return address.front().name == variable_name; });
 }
 
 void DataModel::DirtyAllVariables() {
@@ -355,6 +395,16 @@ bool DataModel::CallTransform(const String& name, Variant& inout_result, const V
 	return false;
 }
 
+const DataTransformFunc* DataModel::GetTransformFunc(const String& name) const
+{
+	return transform_register ? transform_register->Get(name) : nullptr;
+}
+
+DataExpressionCache& DataModel::GetExpressionCache()
+{
+	return expression_cache;
+}
+
 void DataModel::AttachModelRootElement(Element* element)
 {
 	attached_elements.insert(element);
@@ -373,14 +423,56 @@ void DataModel::OnElementRemove(Element* element)
 	attached_elements.erase(element);
 }
 
+void DataModel::ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	auto it = aliases.find(element);
+	if (it != aliases.end())
+	{
+		for (auto& alias : it->second)
+			ReplaceDataAddressPrefix(alias.second, from_prefix, to_prefix);
+	}
+
+	views->ReplaceAddressPrefix(element, from_prefix, to_prefix);
+	controllers->ReplaceAddressPrefix(element, from_prefix, to_prefix);
+
+	const int num_children = element->GetNumChildren(true);
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = element->GetChild(i);
+		if (child->GetDataModel() == this)
+			ReplaceAddressPrefix(child, from_prefix, to_prefix);
+	}
+}
+
 bool DataModel::Update(bool clear_dirty_variables)
 {
-	const bool result = views->Update(*this, dirty_variables);
+	const bool result = views->Update(*this, dirty_variables, dirty_addresses);
 
 	if (clear_dirty_variables)
+	{
 		dirty_variables.clear();
+		dirty_addresses.clear();
+	}
 	
 	return result;
 }
 
+bool ReplaceDataAddressPrefix(DataAddress& address, const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	if (address.size() < from_prefix.size())
+		return false;
+
+	for (size_t i = 0; i < from_prefix.size(); i++)
+	{
+		const DataAddressEntry& entry = address[i];
+		const DataAddressEntry& prefix_entry = from_prefix[i];
+		if (entry.index != prefix_entry.index || (entry.index < 0 && entry.name != prefix_entry.name))
+			return false;
+	}
+
+	address.erase(address.begin(), address.begin() + from_prefix.size());
+	address.insert(address.begin(), to_prefix.begin(), to_prefix.end());
+	return true;
+}
+
 } // namespace Rml
@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/DataModelHandle.h"
 #include "../../Include/RmlUi/Core/DataTypes.h"
+#include "DataExpression.h"
 
 namespace Rml {
 
@@ -67,10 +68,16 @@ public:
 	bool GetVariableInto(const DataAddress& address, Variant& out_value) const;
 
 	void DirtyVariable(const String& variable_name);
+	// Dirty part of a variable, only views depending on the given address, or on any of its parents or children, will be updated.
+	void DirtyAddress(const DataAddress& address);
+	void DirtyAddress(const String& address_str);
 	bool IsVariableDirty(const String& variable_name) const;
 	void DirtyAllVariables();
 
 	bool CallTransform(const String& name, Variant& inout_result, const VariantList& arguments) const;
+	const DataTransformFunc* GetTransformFunc(const String& name) const;
+
+	DataExpressionCache& GetExpressionCache();
 
 	// Elements declaring 'data-model' need to be attached.
 	void AttachModelRootElement(Element* element);
@@ -78,6 +85,10 @@ public:
 
 	void OnElementRemove(Element* element);
 
+	// Replaces the given address prefix in all aliases, views, and controllers of the element and its descendants.
+	// Used to rebind an element generated by 'data-for' to a new array index.
+	void ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix);
+
 	bool Update(bool clear_dirty_variables);
 
 private:
@@ -86,6 +97,8 @@ private:
 
 	UnorderedMap<String, DataVariable> variables;
 	DirtyVariables dirty_variables;
+	// Dirty addresses below the top-level variables, only those which are not already dirty as a whole.
+	Vector<DataAddress> dirty_addresses;
 
 	UnorderedMap<String, UniquePtr<FuncDefinition>> function_variable_definitions;
 	UnorderedMap<String, DataEventFunc> event_callbacks;
@@ -95,9 +108,13 @@ private:
 
 	const TransformFuncRegister* transform_register;
 
+	DataExpressionCache expression_cache;
+
 	SmallUnorderedSet<Element*> attached_elements;
 };
 
+// Replaces the start of the address if it matches the given prefix, returns true if replaced.
+bool ReplaceDataAddressPrefix(DataAddress& address, const DataAddress& from_prefix, const DataAddress& to_prefix);
 
 } // namespace Rml
 #endif
@@ -43,6 +43,10 @@ void DataModelHandle::DirtyVariable(const String& variable_name) {
 	model->DirtyVariable(variable_name);
 }
 
+void DataModelHandle::DirtyAddress(const String& address) {
+	model->DirtyAddress(address);
+}
+
 void DataModelHandle::DirtyAllVariables() {
 	model->DirtyAllVariables();
 }
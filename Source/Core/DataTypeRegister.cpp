@@ -102,7 +102,7 @@ DataTypeRegister::~DataTypeRegister()
 void TransformFuncRegister::Register(const String& name, DataTransformFunc transform_func)
 {
     RMLUI_ASSERT(transform_func);
-    bool inserted = transform_functions.emplace(name, std::move(transform_func)).second;
+    bool inserted = transform_functions.emplace(name, MakeUnique<DataTransformFunc>(std::move(transform_func))).second;
     if (!inserted)
     {
         Log::Message(Log::LT_ERROR, "Transform function '%s' already exists.", name.c_str());
@@ -112,14 +112,22 @@ void TransformFuncRegister::Register(const String& name, DataTransformFunc trans
 
 bool TransformFuncRegister::Call(const String& name, Variant& inout_result, const VariantList& arguments) const
 {
-    auto it = transform_functions.find(name);
-    if (it == transform_functions.end())
+    const DataTransformFunc* transform_func = Get(name);
+    if (!transform_func)
         return false;
 
-    const DataTransformFunc& transform_func = it->second;
-    RMLUI_ASSERT(transform_func);
+    RMLUI_ASSERT(*transform_func);
+
+    return (*transform_func)(inout_result, arguments);
+}
+
+const DataTransformFunc* TransformFuncRegister::Get(const String& name) const
+{
+    auto it = transform_functions.find(name);
+    if (it == transform_functions.end())
+        return nullptr;
 
-    return transform_func(inout_result, arguments);
+    return it->second.get();
 }
 
 } // namespace Rml
@@ -74,54 +74,170 @@ void DataViews::Add(DataViewPtr view) {
 
 void DataViews::OnElementRemove(Element* element) 
 {
-	for (auto it = views.begin(); it != views.end();)
+	auto range = views.equal_range(element);
+	for (auto it = range.first; it != range.second; ++it)
+		views_to_remove.push_back(std::move(it->second));
+	views.erase(range.first, range.second);
+
+	// Views which have not yet been added are not part of the address index, they can be released directly.
+	views_to_add.erase(std::remove_if(views_to_add.begin(), views_to_add.end(),
+						   [element](const DataViewPtr& view) { return view->IsValid() && view->GetElement() == element; }),
+		views_to_add.end());
+}
+
+void DataViews::ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	auto range = views.equal_range(element);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		DataView* view = it->second.get();
+		RemoveFromIndex(view);
+		view->ReplaceAddressPrefix(from_prefix, to_prefix);
+		AddToIndex(view);
+	}
+
+	for (DataViewPtr& view : views_to_add)
+	{
+		if (view->IsValid() && view->GetElement() == element)
+			view->ReplaceAddressPrefix(from_prefix, to_prefix);
+	}
+}
+
+void DataViews::AddToIndex(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
+	{
+		AddressNode* node = &address_root;
+		for (const DataAddressEntry& entry : address)
+		{
+			UniquePtr<AddressNode>& child = (entry.index < 0 ? node->names[entry.name] : node->indices[entry.index]);
+			if (!child)
+				child = MakeUnique<AddressNode>();
+			node = child.get();
+		}
+
+		node->views.push_back(view);
+	}
+}
+
+void DataViews::RemoveFromIndex(DataView* view)
+{
+	for (const DataAddress& address : view->GetVariableAddressList())
 	{
-		auto& view = *it;
-		if (view && view->GetElement() == element)
+		AddressNode* node = &address_root;
+		for (const DataAddressEntry& entry : address)
 		{
-			views_to_remove.push_back(std::move(view));
-			it = views.erase(it);
+			if (entry.index < 0)
+			{
+				auto it = node->names.find(entry.name);
+				node = (it == node->names.end() ? nullptr : it->second.get());
+			}
+			else
+			{
+				auto it = node->indices.find(entry.index);
+				node = (it == node->indices.end() ? nullptr : it->second.get());
+			}
+
+			if (!node)
+				break;
+		}
+
+		if (node)
+		{
+			auto it = std::find(node->views.begin(), node->views.end(), view);
+			if (it != node->views.end())
+				node->views.erase(it);
+		}
+	}
+}
+
+void DataViews::CollectDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const
+{
+	// Views depending on any parent of the address are dirty, as well as all views depending on the address or any of its children.
+	const AddressNode* node = &address_root;
+	for (const DataAddressEntry& entry : address)
+	{
+		dirty_views.insert(dirty_views.end(), node->views.begin(), node->views.end());
+
+		if (entry.index < 0)
+		{
+			auto it = node->names.find(entry.name);
+			if (it == node->names.end())
+				return;
+			node = it->second.get();
 		}
 		else
-			++it;
+		{
+			auto it = node->indices.find(entry.index);
+			if (it == node->indices.end())
+				return;
+			node = it->second.get();
+		}
 	}
+
+	CollectAllViews(*node, dirty_views);
 }
 
-bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
+void DataViews::CollectAllViews(const AddressNode& node, Vector<DataView*>& views)
+{
+	views.insert(views.end(), node.views.begin(), node.views.end());
+
+	for (const auto& child : node.names)
+		CollectAllViews(*child.second, views);
+	for (const auto& child : node.indices)
+		CollectAllViews(*child.second, views);
+}
+
+bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses)
 {
 	bool result = false;
 	size_t num_dirty_variables_prev = 0;
+	size_t num_dirty_addresses_prev = 0;
 
 	// View updates may result in newly added views, or even new dirty variables. Thus, we do the
 	// update recursively but with an upper limit. Without the loop, newly added views won't be
 	// updated until the next Update() call.
-	for(int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size()) && i < 10; i++)
+	for (int i = 0; (i == 0 || !views_to_add.empty() || num_dirty_variables_prev != dirty_variables.size() ||
+			 num_dirty_addresses_prev != dirty_addresses.size()) &&
+		 i < 10;
+		 i++)
 	{
+		// Dirty addresses from previous iterations have already been handled, only collect views from those added since.
+		const size_t first_dirty_address = num_dirty_addresses_prev;
+
 		num_dirty_variables_prev = dirty_variables.size();
+		num_dirty_addresses_prev = dirty_addresses.size();
 
 		Vector<DataView*> dirty_views;
 
 		if (!views_to_add.empty())
 		{
-			views.reserve(views.size() + views_to_add.size());
-			for (auto&& view : views_to_add)
+			DataViewList new_views = std::move(views_to_add);
+			views_to_add.clear();
+
+			for (auto&& view : new_views)
 			{
+				if (!view->IsValid())
+					continue;
+
 				dirty_views.push_back(view.get());
-				for (const String& variable_name : view->GetVariableNameList())
-					name_view_map.emplace(variable_name, view.get());
+				AddToIndex(view.get());
 
-				views.push_back(std::move(view));
+				Element* element = view->GetElement();
+				views.emplace(element, std::move(view));
 			}
-			views_to_add.clear();
 		}
 
 		for (const String& variable_name : dirty_variables)
 		{
-			auto pair = name_view_map.equal_range(variable_name);
-			for (auto it = pair.first; it != pair.second; ++it)
-				dirty_views.push_back(it->second);
+			auto it = address_root.names.find(variable_name);
+			if (it != address_root.names.end())
+				CollectAllViews(*it->second, dirty_views);
 		}
 
+		for (size_t j = first_dirty_address; j < dirty_addresses.size(); j++)
+			CollectDirtyViews(dirty_addresses[j], dirty_views);
+
 		// Remove duplicate entries
 		std::sort(dirty_views.begin(), dirty_views.end());
 		auto it_remove = std::unique(dirty_views.begin(), dirty_views.end());
@@ -137,24 +253,16 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 			if (!view)
 				continue;
 
+			// Views may be removed by the update of a previous view, they will then be released below.
 			if (view->IsValid())
 				result |= view->Update(model);
 		}
 
 		// Destroy views marked for destruction
-		// @performance: Horrible...
 		if (!views_to_remove.empty())
 		{
 			for (const auto& view : views_to_remove)
-			{
-				for (auto it = name_view_map.begin(); it != name_view_map.end(); )
-				{
-					if (it->second == view.get())
-						it = name_view_map.erase(it);
-					else
-						++it;
-				}
-			}
+				RemoveFromIndex(view.get());
 
 			views_to_remove.clear();
 		}
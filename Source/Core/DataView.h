@@ -82,8 +82,12 @@ public:
 	// Returns true if the update resulted in a document change.
 	virtual bool Update(DataModel& model) = 0;
 
-	// Returns the list of data variable name(s) which can modify this view.
-	virtual StringList GetVariableNameList() const = 0;
+	// Returns the addresses of the data variables which can modify this view.
+	// The view is updated when any of these addresses, or any of their parents or children, are dirtied.
+	virtual Vector<DataAddress> GetVariableAddressList() const = 0;
+
+	// Replaces the start of the view's variable addresses when they match the given prefix.
+	virtual void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) = 0;
 
 	// Returns the attached element if it still exists.
 	Element* GetElement() const;
@@ -117,18 +121,32 @@ public:
 
 	void OnElementRemove(Element* element);
 
-	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
+	void ReplaceAddressPrefix(Element* element, const DataAddress& from_prefix, const DataAddress& to_prefix);
+
+	bool Update(DataModel& model, const DirtyVariables& dirty_variables, const Vector<DataAddress>& dirty_addresses);
 
 private:
+	// Views are indexed by the addresses they depend on, so that dirtying an address only has to visit the matching nodes.
+	struct AddressNode {
+		Vector<DataView*> views;
+		UnorderedMap<String, UniquePtr<AddressNode>> names;
+		UnorderedMap<int, UniquePtr<AddressNode>> indices;
+	};
+
+	void AddToIndex(DataView* view);
+	void RemoveFromIndex(DataView* view);
+	void CollectDirtyViews(const DataAddress& address, Vector<DataView*>& dirty_views) const;
+	static void CollectAllViews(const AddressNode& node, Vector<DataView*>& views);
+
 	using DataViewList = Vector<DataViewPtr>;
+	using ElementViewMap = UnorderedMultimap<Element*, DataViewPtr>;
 
-	DataViewList views;
+	ElementViewMap views;
 	
 	DataViewList views_to_add;
 	DataViewList views_to_remove;
 
-	using NameViewMap = UnorderedMultimap<String, DataView*>;
-	NameViewMap name_view_map;
+	AddressNode address_root;
 };
 
 } // namespace Rml
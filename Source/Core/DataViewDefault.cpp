@@ -63,9 +63,14 @@ bool DataViewCommon::Initialize(DataModel& model, Element* element, const String
 	return result;
 }
 
-StringList DataViewCommon::GetVariableNameList() const {
+Vector<DataAddress> DataViewCommon::GetVariableAddressList() const {
 	RMLUI_ASSERT(expression);
-	return expression->GetVariableNameList();
+	return expression->GetVariableAddressList();
+}
+
+void DataViewCommon::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) {
+	RMLUI_ASSERT(expression);
+	expression->ReplaceAddressPrefix(from_prefix, to_prefix);
 }
 
 const String& DataViewCommon::GetModifier() const {
@@ -429,25 +434,31 @@ bool DataViewText::Update(DataModel& model)
 	return entries_modified;
 }
 
-StringList DataViewText::GetVariableNameList() const
+Vector<DataAddress> DataViewText::GetVariableAddressList() const
 {
-	StringList full_list;
+	Vector<DataAddress> full_list;
 	full_list.reserve(data_entries.size());
 
 	for (const DataEntry& entry : data_entries)
 	{
 		RMLUI_ASSERT(entry.data_expression);
 
-		StringList entry_list = entry.data_expression->GetVariableNameList();
-		full_list.insert(full_list.end(),
-			MakeMoveIterator(entry_list.begin()),
-			MakeMoveIterator(entry_list.end())
-		);
+		const AddressList& entry_list = entry.data_expression->GetVariableAddressList();
+		full_list.insert(full_list.end(), entry_list.begin(), entry_list.end());
 	}
 
 	return full_list;
 }
 
+void DataViewText::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	for (DataEntry& entry : data_entries)
+	{
+		RMLUI_ASSERT(entry.data_expression);
+		entry.data_expression->ReplaceAddressPrefix(from_prefix, to_prefix);
+	}
+}
+
 void DataViewText::Release()
 {
 	delete this;
@@ -541,6 +552,29 @@ bool DataViewFor::Initialize(DataModel& model, Element* element, const String& i
 		}
 	}
 
+	use_rml_fragment = rml_fragment.Compile(rml_contents);
+
+	// The key expression is parsed once with the iterator bound to the first entry, and rebound for each evaluated entry.
+	const String key_expression_str = element->GetAttribute<String>("data-key", "");
+	if (!key_expression_str.empty())
+	{
+		attributes.erase("data-key");
+
+		model.InsertAlias(element, iterator_name, GetIteratorAddress(0));
+
+		key_expression = MakeUnique<DataExpression>(key_expression_str);
+		DataExpressionInterface expr_interface(&model, element);
+		const bool key_result = key_expression->Parse(expr_interface, false);
+
+		model.EraseAliases(element);
+
+		if (!key_result)
+		{
+			Log::Message(Log::LT_WARNING, "Could not parse data-key expression '%s' of data-for '%s'.", key_expression_str.c_str(), in_expression.c_str());
+			key_expression.reset();
+		}
+	}
+
 	return true;
 }
 
@@ -551,8 +585,12 @@ bool DataViewFor::Update(DataModel& model)
 	if (!variable)
 		return false;
 
-	bool result = false;
 	const int size = variable.Size();
+
+	if (key_expression)
+		return UpdateKeyed(model, size);
+
+	bool result = false;
 	const int num_elements = (int)elements.size();
 	Element* element = GetElement();
 
@@ -560,24 +598,13 @@ bool DataViewFor::Update(DataModel& model)
 	{
 		if (i >= num_elements)
 		{
-			ElementPtr new_element_ptr = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
-
-			DataAddress iterator_address;
-			iterator_address.reserve(container_address.size() + 1);
-			iterator_address = container_address;
-			iterator_address.push_back(DataAddressEntry(i));
-
-			DataAddress iterator_index_address = {
-				{"literal"}, {"int"}, {i}
-			};
-
-			model.InsertAlias(new_element_ptr.get(), iterator_name, std::move(iterator_address));
-			model.InsertAlias(new_element_ptr.get(), iterator_index_name, std::move(iterator_index_address));
-
-			Element* new_element = element->GetParentNode()->InsertBefore(std::move(new_element_ptr), element);
+			Element* new_element = element->GetParentNode()->InsertBefore(InstanceIteration(model, i), element);
 			elements.push_back(new_element);
 
-			elements[i]->SetInnerRML(rml_contents);
+			if (use_rml_fragment)
+				rml_fragment.Instance(new_element);
+			else
+				new_element->SetInnerRML(rml_contents);
 
 			RMLUI_ASSERT(i < (int)elements.size());
 		}
@@ -595,9 +622,161 @@ bool DataViewFor::Update(DataModel& model)
 	return result;
 }
 
-StringList DataViewFor::GetVariableNameList() const {
+bool DataViewFor::UpdateKeyed(DataModel& model, const int size)
+{
+	StringList new_keys;
+	if (!EvaluateKeys(model, size, new_keys))
+		return false;
+
+	if (new_keys == keys)
+		return false;
+
+	// Match the new keys against the existing iterations. Iterations are only reused when their relative order is
+	// unchanged, so that no element needs to be moved in the document. Thus, inserting or removing entries only
+	// affects the iterations of those entries, while reordered entries are instanced again.
+	UnorderedMap<String, int> previous_key_indices;
+	previous_key_indices.reserve(keys.size());
+	for (int i = 0; i < (int)keys.size(); i++)
+		previous_key_indices.emplace(keys[i], i);
+
+	Vector<int> reused_indices(size, -1);
+	Vector<bool> previous_reused(elements.size(), false);
+	int last_reused_index = -1;
+
+	for (int i = 0; i < size; i++)
+	{
+		auto it = previous_key_indices.find(new_keys[i]);
+		if (it != previous_key_indices.end() && it->second > last_reused_index)
+		{
+			reused_indices[i] = it->second;
+			previous_reused[it->second] = true;
+			last_reused_index = it->second;
+		}
+	}
+
+	for (int i = 0; i < (int)elements.size(); i++)
+	{
+		if (!previous_reused[i])
+		{
+			model.EraseAliases(elements[i]);
+			elements[i]->GetParentNode()->RemoveChild(elements[i]).reset();
+		}
+	}
+
+	// Walk backwards so that new iterations can be inserted before their following sibling.
+	Element* element = GetElement();
+	Element* next_sibling = element;
+	ElementList new_elements(size, nullptr);
+
+	for (int i = size - 1; i >= 0; i--)
+	{
+		const int previous_index = reused_indices[i];
+		if (previous_index >= 0)
+		{
+			Element* reused_element = elements[previous_index];
+			if (previous_index != i)
+				RebindIteration(model, reused_element, previous_index, i);
+
+			new_elements[i] = reused_element;
+		}
+		else
+		{
+			Element* new_element = element->GetParentNode()->InsertBefore(InstanceIteration(model, i), next_sibling);
+			new_elements[i] = new_element;
+
+			if (use_rml_fragment)
+				rml_fragment.Instance(new_element);
+			else
+				new_element->SetInnerRML(rml_contents);
+		}
+
+		next_sibling = new_elements[i];
+	}
+
+	elements = std::move(new_elements);
+	keys = std::move(new_keys);
+
+	return false;
+}
+
+bool DataViewFor::EvaluateKeys(DataModel& model, const int size, StringList& out_keys)
+{
+	RMLUI_ASSERT(key_expression);
+	DataExpressionInterface expr_interface(&model, GetElement());
+
+	out_keys.resize(size);
+
+	for (int i = 0; i < size; i++)
+	{
+		if (i != key_expression_index)
+		{
+			key_expression->ReplaceAddressPrefix(GetIteratorAddress(key_expression_index), GetIteratorAddress(i));
+			key_expression_index = i;
+		}
+
+		Variant key;
+		if (!key_expression->Run(expr_interface, key))
+			return false;
+
+		out_keys[i] = key.Get<String>();
+	}
+
+	return true;
+}
+
+ElementPtr DataViewFor::InstanceIteration(DataModel& model, const int index)
+{
+	Element* element = GetElement();
+	ElementPtr new_element = Factory::InstanceElement(nullptr, element->GetTagName(), element->GetTagName(), attributes);
+
+	model.InsertAlias(new_element.get(), iterator_name, GetIteratorAddress(index));
+	model.InsertAlias(new_element.get(), iterator_index_name, GetIteratorIndexAddress(index));
+
+	return new_element;
+}
+
+void DataViewFor::RebindIteration(DataModel& model, Element* iteration_element, const int from_index, const int to_index)
+{
+	model.ReplaceAddressPrefix(iteration_element, GetIteratorAddress(from_index), GetIteratorAddress(to_index));
+	model.ReplaceAddressPrefix(iteration_element, GetIteratorIndexAddress(from_index), GetIteratorIndexAddress(to_index));
+
+	// The iterated entry is unchanged, but views depending on the index need to be updated.
+	model.DirtyAddress(GetIteratorIndexAddress(to_index));
+}
+
+DataAddress DataViewFor::GetIteratorAddress(const int index) const
+{
+	DataAddress address;
+	address.reserve(container_address.size() + 1);
+	address = container_address;
+	address.push_back(DataAddressEntry(index));
+	return address;
+}
+
+DataAddress DataViewFor::GetIteratorIndexAddress(const int index) const
+{
+	// The index is retrieved from the last entry, while the container address lets the index follow any rebinding of the iterator.
+	DataAddress address;
+	address.reserve(container_address.size() + 3);
+	address.push_back(DataAddressEntry("literal"));
+	address.push_back(DataAddressEntry("index"));
+	address.insert(address.end(), container_address.begin(), container_address.end());
+	address.push_back(DataAddressEntry(index));
+	return address;
+}
+
+Vector<DataAddress> DataViewFor::GetVariableAddressList() const {
 	RMLUI_ASSERT(!container_address.empty());
-	return StringList{ container_address.front().name };
+	return Vector<DataAddress>{ container_address };
+}
+
+void DataViewFor::ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix)
+{
+	// Iterations of a nested 'data-for' are siblings of this element, they are rebound along with it by the data model.
+	ReplaceDataAddressPrefix(container_address, from_prefix, to_prefix);
+
+	if (key_expression)
+		key_expression->ReplaceAddressPrefix(from_prefix, to_prefix);
 }
 
 void DataViewFor::Release()
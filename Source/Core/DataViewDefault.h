@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/Variant.h"
 #include "DataView.h"
+#include "XMLFragment.h"
 
 namespace Rml {
 
@@ -47,7 +48,8 @@ public:
 
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+	void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) override;
 
 protected:
 	const String& GetModifier() const;
@@ -139,7 +141,9 @@ public:
 	bool Initialize(DataModel& model, Element* element, const String& expression, const String& modifier) override;
 
 	bool Update(DataModel& model) override;
-	StringList GetVariableNameList() const override;
+
+	Vector<DataAddress> GetVariableAddressList() const override;
+	void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) override;
 
 protected:
 	void Release() override;
@@ -166,18 +170,38 @@ public:
 
 	bool Update(DataModel& model) override;
 
-	StringList GetVariableNameList() const override;
+	Vector<DataAddress> GetVariableAddressList() const override;
+	void ReplaceAddressPrefix(const DataAddress& from_prefix, const DataAddress& to_prefix) override;
 
 protected:
 	void Release() override;
 
 private:
+	ElementPtr InstanceIteration(DataModel& model, int index);
+	void RebindIteration(DataModel& model, Element* iteration_element, int from_index, int to_index);
+
+	// Evaluates the key expression for each entry in the container, returns false on failure.
+	bool EvaluateKeys(DataModel& model, int size, StringList& out_keys);
+	bool UpdateKeyed(DataModel& model, int size);
+
+	DataAddress GetIteratorAddress(int index) const;
+	DataAddress GetIteratorIndexAddress(int index) const;
+
 	DataAddress container_address;
 	String iterator_name;
 	String iterator_index_name;
 	String rml_contents;
 	ElementAttributes attributes;
 
+	// The optional 'data-key' expression, its addresses are bound to the iterator at 'key_expression_index'.
+	DataExpressionPtr key_expression;
+	int key_expression_index = 0;
+	StringList keys;
+
+	// The contents parsed once, so that iterations can be instanced without running the XML parser.
+	XMLFragment rml_fragment;
+	bool use_rml_fragment = false;
+
 	ElementList elements;
 };
 
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Dictionary.h"
@@ -40,9 +41,11 @@
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertiesIteratorView.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
+#include "../../Include/RmlUi/Core/RenderState.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "Clock.h"
 #include "ComputeProperty.h"
 #include "DataModel.h"
@@ -54,11 +57,13 @@
 #include "EventSpecification.h"
 #include "ElementDecoration.h"
 #include "LayoutEngine.h"
+#include "LayoutState.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
 #include "Pool.h"
 #include "StyleSheetParser.h"
 #include "StyleSheetNode.h"
+#include "TextureLoader.h"
 #include "TransformState.h"
 #include "TransformUtilities.h"
 #include "XMLParseTools.h"
@@ -70,6 +75,19 @@ namespace Rml {
 // Determines how many levels up in the hierarchy the OnChildAdd and OnChildRemove are called (starting at the child itself)
 static constexpr int ChildNotifyLevels = 2;
 
+// Window-space bounds used to skip rendering of elements that cannot be visible. Invalid bounds are unknown, and never culled.
+struct RenderBounds
+{
+	// Bounds of the element's own backgrounds, decorators, and content.
+	Rectanglef self = Rectanglef::CreateInvalid();
+	// Bounds of the element itself and all elements rendered in its local stacking context.
+	Rectanglef subtree = Rectanglef::CreateInvalid();
+	// True if all the elements in the local stacking context are clipped at least by the clipping region of this element.
+	bool clip_contained = false;
+	// The owner document's generation these bounds were calculated for.
+	int generation = -1;
+};
+
 // Meta objects for element collected in a single struct to reduce memory allocations
 struct ElementMeta
 {
@@ -81,6 +99,7 @@ struct ElementMeta
 	ElementDecoration decoration;
 	ElementScroll scroll;
 	Style::ComputedValues computed_values;
+	RenderBounds render_bounds;
 };
 
 static Pool< ElementMeta > element_meta_chunk_pool(200, true);
@@ -108,6 +127,8 @@ Element::Element(const String& tag) :
 	num_non_dom_children = 0;
 
 	z_index = 0;
+	num_stacking_context_patches = 0;
+	hit_test_grid_index = -1;
 
 	meta = element_meta_chunk_pool.AllocateAndConstruct(this);
 	data_model = nullptr;
@@ -165,8 +186,15 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->decoration.InstanceDecorators();
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	if (!children.empty())
+	{
+		AncestorFilter::PushParent(this);
+
+		for (size_t i = 0; i < children.size(); i++)
+			children[i]->Update(dp_ratio, vp_dimensions);
+
+		AncestorFilter::PopParent();
+	}
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -206,33 +234,146 @@ void Element::Render()
 	// Rebuild our stacking context if necessary.
 	if (stacking_context_dirty)
 		BuildLocalStackingContext();
+	num_stacking_context_patches = 0;
 
 	UpdateTransformState();
 
+	// Elements can be culled when their bounds are known in window space, that is, when no transform applies to them.
+	const RenderBounds& bounds = meta->render_bounds;
+	const bool cullable = (!transform_state || !transform_state->GetTransform());
+	Rectanglef visible_region;
+
+	if (cullable)
+	{
+		UpdateRenderBounds();
+
+		// Skip the element and its whole stacking context when they are located entirely outside the window.
+		const Context* context = GetContext();
+		visible_region = Rectanglef::FromSize(Vector2f(context ? context->GetDimensions() : Vector2i(0)));
+		if (bounds.subtree.Valid() && !bounds.subtree.Intersects(visible_region))
+			return;
+	}
+
 	// Apply our transform
 	ElementUtilities::ApplyTransform(this);
 
 	meta->decoration.RenderDecorators(RenderStage::Enter);
 
+	bool render_stacking_context = true;
+
 	// Set up the clipping region for this element.
 	if (ElementUtilities::SetClippingRegion(this))
 	{
-		meta->background_border.Render(this);
-		meta->decoration.RenderDecorators(RenderStage::Decoration);
+		bool render_self = true;
 
+		if (cullable)
 		{
-			RMLUI_ZoneScopedNC("OnRender", 0x228B22);
-			OnRender();
+			// Skip anything located outside the clipping region. The stacking context can only be skipped when it cannot escape our clipping.
+			const Rectanglei scissor_region = GetContext()->GetRenderState().GetScissorState();
+			if (scissor_region.Valid())
+				visible_region.Intersect(Rectanglef(scissor_region));
+
+			render_self = (!bounds.self.Valid() || bounds.self.Intersects(visible_region));
+			render_stacking_context = (!bounds.clip_contained || !bounds.subtree.Valid() || bounds.subtree.Intersects(visible_region));
+		}
+
+		if (render_self)
+		{
+			TextureLoader::RequesterScope texture_requester(this);
+
+			meta->background_border.Render(this);
+			meta->decoration.RenderDecorators(RenderStage::Decoration);
+
+			{
+				RMLUI_ZoneScopedNC("OnRender", 0x228B22);
+				OnRender();
+			}
 		}
 	}
 
 	// Render all elements in our local stacking context.
-	for (Element* element : stacking_context)
-		element->Render();
+	if (render_stacking_context)
+	{
+		for (Element* element : stacking_context)
+			element->Render();
+	}
 
 	meta->decoration.RenderDecorators(RenderStage::Exit);
 }
 
+void Element::UpdateRenderBounds()
+{
+	RenderBounds& bounds = meta->render_bounds;
+	if (!owner_document)
+	{
+		bounds = RenderBounds{};
+		return;
+	}
+	if (bounds.generation == owner_document->render_bounds_generation)
+		return;
+
+	bounds.generation = owner_document->render_bounds_generation;
+
+	if (stacking_context_dirty)
+		BuildLocalStackingContext();
+
+	const ComputedValues& computed = meta->computed_values;
+
+	// Box shadows and filters paint outside the border box, and transforms move it elsewhere, so we simply don't bound those. Transforms of
+	// ancestors don't matter here, the bounds are only used when no transform applies to the element.
+	const bool transformed = (computed.transform() != nullptr);
+	const bool ink_overflow = (computed.has_box_shadow() || computed.has_filter() || computed.has_backdrop_filter());
+
+	ElementText* element_text = rmlui_dynamic_cast<ElementText*>(this);
+
+	if (transformed || ink_overflow || (element_text && computed.has_font_effect()))
+	{
+		bounds.self = Rectanglef::CreateInvalid();
+	}
+	else
+	{
+		const Vector2f position = GetAbsoluteOffset(BoxArea::Border);
+		if (element_text)
+		{
+			// Text elements are not sized during layout, instead their lines cover the area of the text.
+			const Rectanglef text_bounds = element_text->GetTextBounds();
+			bounds.self = Rectanglef::FromPositionSize(position + text_bounds.Position(), text_bounds.Size());
+		}
+		else
+		{
+			bounds.self = Rectanglef::FromPositionSize(position, main_box.GetSize(BoxArea::Border));
+			for (const PositionedBox& additional_box : additional_boxes)
+				bounds.self.Join(Rectanglef::FromPositionSize(position + additional_box.offset, additional_box.box.GetSize(BoxArea::Border)));
+		}
+
+		// Glyphs are positioned relative to the baseline and can extend beyond the line boxes, pad the bounds to be safe.
+		const float padding = (element_text ? Math::Max(computed.font_size(), computed.line_height().value) : 1.f);
+		bounds.self.Extend(padding);
+	}
+
+	bounds.subtree = bounds.self;
+	bounds.clip_contained = true;
+
+	for (Element* element : stacking_context)
+	{
+		element->UpdateRenderBounds();
+		const RenderBounds& element_bounds = element->meta->render_bounds;
+
+		if (bounds.subtree.Valid() && element_bounds.subtree.Valid())
+			bounds.subtree.Join(element_bounds.subtree);
+		else
+			bounds.subtree = Rectanglef::CreateInvalid();
+
+		// Elements ignoring some of their ancestors' clipping can be visible outside our clipping region.
+		if (!element_bounds.clip_contained || element->meta->computed_values.clip().GetType() != Style::Clip::Type::Auto)
+			bounds.clip_contained = false;
+	}
+
+	// Perspective projects the stacking context to anywhere in the window.
+	if (computed.perspective() > 0.f)
+		bounds.subtree = Rectanglef::CreateInvalid();
+}
+
 // Clones this element, returning a new, unparented element.
 ElementPtr Element::Clone() const
 {
@@ -452,6 +593,7 @@ void Element::SetBox(const Box& box)
 		additional_boxes.clear();
 
 		OnResize();
+		DirtyHitTestGrid();
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
@@ -465,6 +607,7 @@ void Element::AddBox(const Box& box, Vector2f offset)
 	additional_boxes.emplace_back(PositionedBox{ box, offset });
 
 	OnResize();
+	DirtyHitTestGrid();
 
 	meta->background_border.DirtyBackground();
 	meta->background_border.DirtyBorder();
@@ -1300,7 +1443,7 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 		ancestor->OnChildAdd(child_ptr);
 
-	DirtyStackingContext();
+	DirtyStackingContextChild(child_ptr);
 	DirtyStructure();
 
 	if (dom_element)
@@ -1349,7 +1492,7 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 			ancestor->OnChildAdd(child_ptr);
 
-		DirtyStackingContext();
+		DirtyStackingContextChild(child_ptr);
 		DirtyStructure();
 	}
 	else
@@ -1382,6 +1525,7 @@ ElementPtr Element::ReplaceChild(ElementPtr inserted_element, Element* replaced_
 	inserted_element_ptr->SetParent(this);
 
 	ElementPtr result = RemoveChild(replaced_element);
+	DirtyStackingContextChild(inserted_element_ptr);
 
 	Element* ancestor = inserted_element_ptr;
 	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
@@ -1436,7 +1580,7 @@ ElementPtr Element::RemoveChild(Element* child)
 			detached_child->SetParent(nullptr);
 
 			DirtyLayout();
-			DirtyStackingContext();
+			DirtyStackingContextChild(child);
 			DirtyStructure();
 
 			return detached_child;
@@ -1611,7 +1755,15 @@ void Element::SetInstancer(ElementInstancer* _instancer)
 void Element::ForceLocalStackingContext()
 {
 	local_stacking_context_forced = true;
-	local_stacking_context = true;
+
+	if (!local_stacking_context)
+	{
+		local_stacking_context = true;
+
+		// Our descendants are no longer part of our parent's stacking context.
+		if (parent)
+			parent->DirtyStackingContextChild(this);
+	}
 
 	DirtyStackingContext();
 }
@@ -1643,6 +1795,12 @@ void Element::OnStyleSheetChange()
 {
 }
 
+void Element::OnTextureLoad()
+{
+	// Decorators may depend on the texture dimensions.
+	GetElementDecoration()->DirtyDecoratorsData();
+}
+
 // Called when attributes on the element are changed.
 void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 {
@@ -1715,14 +1873,12 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
-	if (!IsLayoutDirty())
-	{
-		// Force a relayout if any of the changed properties require it.
-		const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
-		
-		if(!changed_properties_forcing_layout.Empty())
-			DirtyLayout();
-	}
+	// Force a relayout if any of the changed properties require it. This is done even if the document layout is already dirty, so that any
+	// cached layout of this element and its ancestors is invalidated.
+	const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
+
+	if (!changed_properties_forcing_layout.Empty())
+		DirtyLayout();
 
 	const bool border_radius_changed = (
 		changed_properties.Contains(PropertyId::BorderTopLeftRadius) ||
@@ -1744,9 +1900,6 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		{
 			visible = new_visibility;
 
-			if (parent != nullptr)
-				parent->DirtyStackingContext();
-
 			if (!visible)
 				Blur();
 		}
@@ -1761,6 +1914,16 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		}
 	}
 
+	// Our visibility and render order determine where we are placed in our parent's stacking context.
+	if (parent != nullptr &&
+		(changed_properties.Contains(PropertyId::Visibility) ||
+		changed_properties.Contains(PropertyId::Display) ||
+		changed_properties.Contains(PropertyId::Position) ||
+		changed_properties.Contains(PropertyId::Float)))
+	{
+		parent->DirtyStackingContextChild(this);
+	}
+
 	// Update the position.
 	if (changed_properties.Contains(PropertyId::Left) ||
 		changed_properties.Contains(PropertyId::Right) ||
@@ -1791,19 +1954,19 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 				// If we are no longer acting as a local stacking context, then we clear the list and are all set. Otherwise, we need to rebuild our
 				// local stacking context.
 				stacking_context.clear();
+				stacking_context_unsorted.clear();
 				stacking_context_dirty = local_stacking_context;
 			}
 
 			// When our z-index or local stacking context changes, then we must dirty our parent stacking context so we are re-indexed.
 			if (parent)
-				parent->DirtyStackingContext();
+				parent->DirtyStackingContextChild(this);
 		}
 	}
 
-	// Dirty the background if it's changed.
+	// Dirty the background if it's changed. Opacity is applied while rendering, thus it does not affect the background and border geometry.
     if (border_radius_changed ||
 		changed_properties.Contains(PropertyId::BackgroundColor) ||
-		changed_properties.Contains(PropertyId::Opacity) ||
 		changed_properties.Contains(PropertyId::ImageColor) ||
 		changed_properties.Contains(PropertyId::BoxShadow))
 	{
@@ -1819,8 +1982,7 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		changed_properties.Contains(PropertyId::BorderTopColor) ||
 		changed_properties.Contains(PropertyId::BorderRightColor) ||
 		changed_properties.Contains(PropertyId::BorderBottomColor) ||
-		changed_properties.Contains(PropertyId::BorderLeftColor) ||
-		changed_properties.Contains(PropertyId::Opacity))
+		changed_properties.Contains(PropertyId::BorderLeftColor))
 	{
 		meta->background_border.DirtyBorder();
 	}
@@ -1856,6 +2018,15 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		DirtyTransformState(false, true);
 	}
 
+	// The render bounds are affected by properties painting outside the border box, and by clipping.
+	if (filter_or_mask_changed ||
+		changed_properties.Contains(PropertyId::BoxShadow) ||
+		changed_properties.Contains(PropertyId::FontEffect) ||
+		changed_properties.Contains(PropertyId::Clip))
+	{
+		DirtyHitTestGrid();
+	}
+
 	// Check for `animation' changes
 	if (changed_properties.Contains(PropertyId::Animation))
 	{
@@ -1885,9 +2056,11 @@ void Element::OnChildRemove(Element* /*child*/)
 // Forces a re-layout of this element, and any other children required.
 void Element::DirtyLayout()
 {
-	Element* document = GetOwnerDocument();
+	LayoutEngine::DirtyLayoutCache(this);
+
+	ElementDocument* document = GetOwnerDocument();
 	if (document != nullptr)
-		document->DirtyLayout();
+		document->DirtyElementLayout(this);
 }
 
 // Forces a re-layout of this element, and any other children required.
@@ -2051,6 +2224,9 @@ void Element::SetParent(Element* _parent)
 
 	parent = _parent;
 
+	// The listeners of our new ancestors now receive our events.
+	EventDispatcher::DirtyListenerSummaries();
+
 	if (parent)
 	{
 		// We need to update our definition and make sure we inherit the properties of our new parent.
@@ -2097,6 +2273,10 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyAbsoluteOffset()
 {
+	// Only the element and its descendants move, their order in the hit test grid is unaffected.
+	if (owner_document)
+		owner_document->DirtyHitTestGridSubtree(this);
+
 	if (!absolute_offset_dirty)
 		DirtyAbsoluteOffsetRecursive();
 }
@@ -2196,15 +2376,6 @@ void Element::SetBaseline(float in_baseline)
 	baseline = in_baseline;
 }
 
-void Element::BuildLocalStackingContext()
-{
-	stacking_context_dirty = false;
-	stacking_context.clear();
-
-	BuildStackingContext(&stacking_context);
-	std::stable_sort(stacking_context.begin(), stacking_context.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
-}
-
 enum class RenderOrder { Block, TableColumnGroup, TableColumn, TableRowGroup, TableRow, TableCell, Inline, Floating, Positioned };
 struct StackingOrderedChild {
 	Element* element;
@@ -2212,6 +2383,100 @@ struct StackingOrderedChild {
 	bool include_children;
 };
 
+// Returns the render order of a child within its parent's stacking context, for parents not formatted as tables.
+static RenderOrder GetRenderOrder(Element* child)
+{
+	const Style::Display child_display = child->GetDisplay();
+
+	if (child->GetPosition() != Style::Position::Static)
+		return RenderOrder::Positioned;
+	else if (child->GetFloat() != Style::Float::None)
+		return RenderOrder::Floating;
+	else if (child_display == Style::Display::Block || child_display == Style::Display::Table || child_display == Style::Display::Flex)
+		return RenderOrder::Block;
+
+	return RenderOrder::Inline;
+}
+
+// Sorts the stacking context by z-index from the list in render order, keeping the render order among elements of equal z-index.
+static void SortStackingContext(ElementList& stacking_context, const ElementList& unsorted_stacking_context)
+{
+	auto z_index_less = [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); };
+
+	stacking_context = unsorted_stacking_context;
+	if (!std::is_sorted(stacking_context.begin(), stacking_context.end(), z_index_less))
+		std::stable_sort(stacking_context.begin(), stacking_context.end(), z_index_less);
+}
+
+// Removes a range of entries of the unsorted stacking context from the sorted one.
+static void RemoveFromSortedStackingContext(ElementList& stacking_context, ElementList::const_iterator begin, ElementList::const_iterator end)
+{
+	if (end - begin == 1)
+	{
+		auto it = std::find(stacking_context.begin(), stacking_context.end(), *begin);
+		RMLUI_ASSERT(it != stacking_context.end());
+		if (it != stacking_context.end())
+			stacking_context.erase(it);
+		return;
+	}
+
+	ElementList removed(begin, end);
+	std::sort(removed.begin(), removed.end());
+	stacking_context.erase(std::remove_if(stacking_context.begin(), stacking_context.end(),
+							   [&](Element* element) { return std::binary_search(removed.begin(), removed.end(), element); }),
+		stacking_context.end());
+}
+
+// Inserts a range of entries of the unsorted stacking context into the sorted one. Each entry is placed next to its closest neighbor of equal
+// z-index in render order, this way we only need to look up the z-index of a few elements.
+static void InsertIntoSortedStackingContext(ElementList& stacking_context, const ElementList& unsorted_stacking_context, size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; i++)
+	{
+		Element* element = unsorted_stacking_context[i];
+		const float z_index = element->GetZIndex();
+
+		auto it_insert = stacking_context.end();
+
+		size_t j = i;
+		while (j > 0 && unsorted_stacking_context[j - 1]->GetZIndex() != z_index)
+			j--;
+
+		if (j > 0)
+		{
+			it_insert = std::find(stacking_context.begin(), stacking_context.end(), unsorted_stacking_context[j - 1]);
+			RMLUI_ASSERT(it_insert != stacking_context.end());
+			if (it_insert != stacking_context.end())
+				++it_insert;
+		}
+		else
+		{
+			// Entries after the inserted range are already sorted, while later inserted entries will be placed after this one anyway.
+			j = end;
+			while (j < unsorted_stacking_context.size() && unsorted_stacking_context[j]->GetZIndex() != z_index)
+				j++;
+
+			if (j < unsorted_stacking_context.size())
+				it_insert = std::find(stacking_context.begin(), stacking_context.end(), unsorted_stacking_context[j]);
+			else
+				it_insert = std::upper_bound(stacking_context.begin(), stacking_context.end(), z_index,
+					[](float lhs, const Element* rhs) { return lhs < rhs->GetZIndex(); });
+		}
+
+		stacking_context.insert(it_insert, element);
+	}
+}
+
+void Element::BuildLocalStackingContext()
+{
+	stacking_context_dirty = false;
+	num_stacking_context_patches = 0;
+	stacking_context_unsorted.clear();
+
+	BuildStackingContext(&stacking_context_unsorted);
+	SortStackingContext(stacking_context, stacking_context_unsorted);
+}
+
 void Element::BuildStackingContext(ElementList* new_stacking_context)
 {
 	RMLUI_ZoneScoped;
@@ -2241,19 +2506,8 @@ void Element::BuildStackingContext(ElementList* new_stacking_context)
 			StackingOrderedChild& ordered_child = ordered_children.back();
 
 			ordered_child.element = child;
-			ordered_child.order = RenderOrder::Inline;
+			ordered_child.order = GetRenderOrder(child);
 			ordered_child.include_children = !child->local_stacking_context;
-
-			const Style::Display child_display = child->GetDisplay();
-
-			if (child->GetPosition() != Style::Position::Static)
-				ordered_child.order = RenderOrder::Positioned;
-			else if (child->GetFloat() != Style::Float::None)
-				ordered_child.order = RenderOrder::Floating;
-			else if (child_display == Style::Display::Block || child_display == Style::Display::Table || child_display == Style::Display::Flex)
-				ordered_child.order = RenderOrder::Block;
-			else
-				ordered_child.order = RenderOrder::Inline;
 		}
 	}
 
@@ -2332,6 +2586,148 @@ void Element::DirtyStackingContext()
 
 	if (stacking_context_parent)
 		stacking_context_parent->stacking_context_dirty = true;
+
+	DirtyHitTestGrid();
+}
+
+void Element::DirtyStackingContextChild(Element* child)
+{
+	// Patching is linear in the size of the stacking context, after this many patches we rather rebuild it once before it is next used.
+	static constexpr int MaxStackingContextPatches = 16;
+
+	// Find our stacking context parent, and whether our children are part of it at all, which is not the case if we or any ancestor in
+	// between are hidden.
+	Element* stacking_context_parent = this;
+	bool children_in_stacking_context = true;
+	while (stacking_context_parent && !stacking_context_parent->local_stacking_context)
+	{
+		children_in_stacking_context &= stacking_context_parent->visible;
+		stacking_context_parent = stacking_context_parent->parent;
+	}
+
+	DirtyHitTestGrid();
+
+	if (!stacking_context_parent || stacking_context_parent->stacking_context_dirty)
+		return;
+
+	// Table children are ordered across rows and groups, leave those to a full rebuild.
+	const Style::Display display = GetDisplay();
+	const bool table_children = (display == Style::Display::Table || display == Style::Display::TableRow ||
+		display == Style::Display::TableRowGroup || display == Style::Display::TableColumn || display == Style::Display::TableColumnGroup);
+
+	if (table_children || stacking_context_parent->num_stacking_context_patches >= MaxStackingContextPatches)
+	{
+		stacking_context_parent->stacking_context_dirty = true;
+		return;
+	}
+
+	stacking_context_parent->num_stacking_context_patches += 1;
+
+	// Each element is followed by its descendants in the unsorted stacking context, unless it establishes a local stacking context itself.
+	ElementList& unsorted = stacking_context_parent->stacking_context_unsorted;
+	auto is_descendant_of = [stacking_context_parent](Element* element, Element* ancestor) {
+		for (; element && element != stacking_context_parent; element = element->parent)
+		{
+			if (element == ancestor)
+				return true;
+		}
+		return false;
+	};
+
+	ElementList& sorted = stacking_context_parent->stacking_context;
+
+	// Remove the child's previous entries.
+	auto it_child = std::find(unsorted.begin(), unsorted.end(), child);
+	if (it_child != unsorted.end())
+	{
+		auto it_child_end = std::find_if(it_child + 1, unsorted.end(), [&](Element* element) { return !is_descendant_of(element, child); });
+		RemoveFromSortedStackingContext(sorted, it_child, it_child_end);
+		unsorted.erase(it_child, it_child_end);
+	}
+
+	// Insert the child's new entries among our other children, which are ordered by their render order and then by their position in the DOM.
+	if (child->parent == this && child->visible && children_in_stacking_context)
+	{
+		const RenderOrder child_order = GetRenderOrder(child);
+
+		// Look for the closest siblings of the same render order, the child is placed right after the entries of the preceding one, or
+		// otherwise right before the following one.
+		const auto it_child_dom = std::find_if(children.begin(), children.end(), [child](const ElementPtr& sibling) { return sibling.get() == child; });
+		auto is_same_order_sibling = [child_order](const ElementPtr& sibling) { return sibling->visible && GetRenderOrder(sibling.get()) == child_order; };
+
+		const auto it_previous = std::find_if(std::make_reverse_iterator(it_child_dom), children.rend(), is_same_order_sibling);
+		const auto it_next = (it_previous == children.rend() ? std::find_if(it_child_dom + 1, children.end(), is_same_order_sibling) : children.end());
+
+		auto it_insert = unsorted.end();
+		if (it_previous != children.rend())
+		{
+			Element* previous = it_previous->get();
+			it_insert = std::find(unsorted.begin(), unsorted.end(), previous);
+			if (it_insert != unsorted.end())
+				it_insert = std::find_if(it_insert + 1, unsorted.end(), [&](Element* element) { return !is_descendant_of(element, previous); });
+		}
+		else if (it_next != children.end())
+		{
+			it_insert = std::find(unsorted.begin(), unsorted.end(), it_next->get());
+		}
+		else
+		{
+			// No other children of this render order, place it before our first child of a later render order.
+			auto it_begin = unsorted.begin();
+			auto it_end = unsorted.end();
+			if (stacking_context_parent != this)
+			{
+				it_begin = std::find(unsorted.begin(), unsorted.end(), this);
+				if (it_begin == unsorted.end())
+				{
+					RMLUI_ERRORMSG("Element missing from its stacking context.");
+					stacking_context_parent->stacking_context_dirty = true;
+					return;
+				}
+				++it_begin;
+				it_end = std::find_if(it_begin, unsorted.end(), [&](Element* element) { return !is_descendant_of(element, this); });
+			}
+
+			it_insert = std::find_if(it_begin, it_end, [&](Element* element) { return element->parent == this && GetRenderOrder(element) > child_order; });
+		}
+
+		ElementList child_entries = {child};
+		if (!child->local_stacking_context)
+			child->BuildStackingContext(&child_entries);
+
+		const size_t insert_index = size_t(it_insert - unsorted.begin());
+		unsorted.insert(it_insert, child_entries.begin(), child_entries.end());
+		InsertIntoSortedStackingContext(sorted, unsorted, insert_index, insert_index + child_entries.size());
+	}
+}
+
+#ifdef RMLUI_TESTS_ENABLED
+bool Element::GetStackingContextForTesting(ElementList& current, ElementList& rebuilt)
+{
+	const bool up_to_date = !stacking_context_dirty;
+	if (stacking_context_dirty)
+		BuildLocalStackingContext();
+
+	current = stacking_context;
+
+	ElementList unsorted;
+	BuildStackingContext(&unsorted);
+	SortStackingContext(rebuilt, unsorted);
+
+	return up_to_date;
+}
+#endif
+
+void Element::DirtyHitTestGrid()
+{
+	if (owner_document)
+		owner_document->DirtyHitTestGrid();
+}
+
+void Element::DirtyRenderBounds()
+{
+	if (owner_document)
+		owner_document->DirtyRenderBounds();
 }
 
 void Element::DirtyStructure()
@@ -2625,7 +3021,11 @@ void Element::AdvanceAnimations()
 		for (auto& animation : animations)
 		{
 			Property property = animation.UpdateAndGetProperty(time, *this);
-			if (property.unit != Unit::UNKNOWN)
+			if (property.unit == Unit::UNKNOWN)
+				continue;
+
+			// The final value always goes through the style system, so that the computed values are consolidated when the animation ends.
+			if (animation.IsComplete() || !ApplyAnimatedProperty(animation.GetPropertyId(), property))
 				SetProperty(animation.GetPropertyId(), property);
 		}
 
@@ -2661,6 +3061,49 @@ void Element::AdvanceAnimations()
 
 
 
+bool Element::ApplyAnimatedProperty(PropertyId id, const Property& property)
+{
+	if (id != PropertyId::Transform && id != PropertyId::Opacity)
+		return false;
+
+	// Store the value as an inline property so that it is returned by GetProperty(), and is used if the element's values are computed again.
+	if (!meta->style.SetAnimatedProperty(id, property))
+		return false;
+
+	if (id == PropertyId::Opacity)
+	{
+		ApplyInheritedOpacity(property.Get<float>());
+	}
+	else
+	{
+		// The computed transform is read from the local property, only its dependents need to be notified.
+		PropertyIdSet changed_properties;
+		changed_properties.Insert(PropertyId::Transform);
+		OnPropertyChange(changed_properties);
+	}
+
+	return true;
+}
+
+void Element::ApplyInheritedOpacity(float opacity)
+{
+	if (meta->computed_values.opacity() == opacity)
+		return;
+
+	meta->computed_values.opacity(opacity);
+
+	PropertyIdSet changed_properties;
+	changed_properties.Insert(PropertyId::Opacity);
+	OnPropertyChange(changed_properties);
+
+	// Descendants specifying their own opacity are unaffected, along with their own descendants.
+	for (const ElementPtr& child : children)
+	{
+		if (!child->GetLocalProperty(PropertyId::Opacity))
+			child->ApplyInheritedOpacity(opacity);
+	}
+}
+
 void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 {
 	dirty_perspective |= perspective_dirty;
@@ -2813,6 +3256,8 @@ void Element::UpdateTransformState()
 	{
 		for (size_t i = 0; i < children.size(); i++)
 			children[i]->DirtyTransformState(false, true);
+
+		DirtyHitTestGrid();
 	}
 
 	// No reason to keep the transform state around if transform and perspective have been removed.
@@ -27,6 +27,8 @@
  */
 
 #include "ElementBackgroundBorder.h"
+#include "BoxShadowCache.h"
+#include "FrameProfiler.h"
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Context.h"
@@ -44,25 +46,42 @@ ElementBackgroundBorder::~ElementBackgroundBorder() {}
 
 void ElementBackgroundBorder::Render(Element* element)
 {
+	// Box-shadow textures are shared through the context, regenerate them if we have moved to another context.
+	if (shadow_context && shadow_context != element->GetContext())
+		background_dirty = true;
+
 	if (background_dirty || border_dirty)
 	{
 		for (size_t i = 0; i < size_t(BackgroundType::Count); i++)
 		{
 			if (geometries[i])
+			{
 				geometries[i]->geometry.Release(true);
+				geometries[i]->texture.reset();
+			}
 		}
 
+		shadow_context = nullptr;
 		GenerateGeometry(element);
 
 		background_dirty = false;
 		border_dirty = false;
 	}
 
+	// Opacity is applied when rendering, thus the geometry is kept intact while the opacity is animated.
+	const float opacity = element->GetComputedValues().opacity();
+
 	Geometry* shadow_geometry = GetGeometry(BackgroundType::BoxShadow);
 	if (shadow_geometry && *shadow_geometry)
+	{
+		shadow_geometry->SetOpacity(opacity);
 		shadow_geometry->Render(element->GetAbsoluteOffset(BoxArea::Border));
+	}
 	else if (Geometry* main_geometry = GetGeometry(BackgroundType::Main))
+	{
+		main_geometry->SetOpacity(opacity);
 		main_geometry->Render(element->GetAbsoluteOffset(BoxArea::Border));
+	}
 }
 
 void ElementBackgroundBorder::DirtyBackground()
@@ -107,32 +126,22 @@ Geometry* ElementBackgroundBorder::GetClipGeometry(Element* element, BoxArea cli
 
 void ElementBackgroundBorder::GenerateGeometry(Element* element)
 {
+	FrameProfiler::Count(FrameProfiler::Counter::GeometryGenerated);
+
 	const ComputedValues& computed = element->GetComputedValues();
 	const Property* p_box_shadow = element->GetLocalProperty(PropertyId::BoxShadow);
 
 	const Vector4f border_radius = computed.border_radius();
-	Colourb background_color = computed.background_color();
-	Colourb border_colors[4] = {
+	const Colourb background_color = computed.background_color();
+	const Colourb border_colors[4] = {
 		computed.border_top_color(),
 		computed.border_right_color(),
 		computed.border_bottom_color(),
 		computed.border_left_color(),
 	};
 
-	if (!p_box_shadow)
-	{
-		// Apply opacity except if we have a box shadow. In the latter case the background is rendered opaquely into the box-shadow texture, while
-		// opacity is applied to the entire box-shadow texture when that is rendered.
-		const float opacity = computed.opacity();
-		if (opacity < 1.f)
-		{
-			background_color.alpha = (byte)(opacity * (float)background_color.alpha);
-
-			for (int i = 0; i < 4; ++i)
-				border_colors[i].alpha = (byte)(opacity * (float)border_colors[i].alpha);
-		}
-	}
-
+	// Opacity is not applied to the generated geometry, but to the rendered geometry. With a box shadow, the background is rendered opaquely into
+	// the box-shadow texture, while opacity is applied to the entire box-shadow texture when that is rendered.
 	Geometry& main_geometry = GetOrCreateBackground(element, BackgroundType::Main).geometry;
 
 	for (int i = 0; i < element->GetNumBoxes(); i++)
@@ -147,15 +156,23 @@ void ElementBackgroundBorder::GenerateGeometry(Element* element)
 		RMLUI_ASSERT(p_box_shadow->value.GetType() == Variant::SHADOWLIST);
 		ShadowList shadow_list = p_box_shadow->value.Get<ShadowList>();
 
-		GenerateBoxShadow(element, std::move(shadow_list), border_radius, computed.opacity());
+		GenerateBoxShadow(element, std::move(shadow_list), border_radius, background_color, border_colors);
 	}
 }
 
-void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList shadow_list, const Vector4f border_radius, const float opacity)
+void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList shadow_list, const Vector4f border_radius, Colourb background_color,
+	const Colourb (&border_colors)[4])
 {
-	// Find the box-shadow texture dimension and offset required to cover all box-shadows and element boxes combined.
-	Vector2f element_offset_in_texture;
-	Vector2i texture_dimensions;
+	Context* context = element->GetContext();
+	if (!context)
+		return;
+
+	// Collect everything that affects the box-shadow texture, so that it can be shared by elements with identical box-shadows.
+	BoxShadowKey key;
+	key.border_radius = border_radius;
+	key.background_color = background_color;
+	for (int i = 0; i < 4; i++)
+		key.border_colors[i] = border_colors[i];
 
 	// Resolve all lengths to px units.
 	for (Shadow& shadow : shadow_list)
@@ -165,13 +182,22 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 		shadow.offset_x = NumericValue(element->ResolveLength(shadow.offset_x), Unit::PX);
 		shadow.offset_y = NumericValue(element->ResolveLength(shadow.offset_y), Unit::PX);
 	}
+	key.shadows = std::move(shadow_list);
+
+	key.boxes.resize(element->GetNumBoxes());
+	for (int i = 0; i < element->GetNumBoxes(); i++)
+		key.boxes[i].second = element->GetBox(i, key.boxes[i].first);
+
+	// Find the box-shadow texture dimension and offset required to cover all box-shadows and element boxes combined.
+	Vector2f element_offset_in_texture;
+	Vector2i texture_dimensions;
 
 	{
 		Vector2f extend_min;
 		Vector2f extend_max;
 
 		// Extend the render-texture to encompass box-shadow blur and spread.
-		for (const Shadow& shadow : shadow_list)
+		for (const Shadow& shadow : key.shadows)
 		{
 			if (!shadow.inset)
 			{
@@ -185,12 +211,8 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 		Rectanglef texture_region;
 
 		// Extend the render-texture further to cover all the element's boxes.
-		for (int i = 0; i < element->GetNumBoxes(); i++)
-		{
-			Vector2f offset;
-			const Box& box = element->GetBox(i, offset);
-			texture_region.Join(Rectanglef::FromPositionSize(offset, box.GetSize(BoxArea::Border)));
-		}
+		for (const auto& offset_box : key.boxes)
+			texture_region.Join(Rectanglef::FromPositionSize(offset_box.first, offset_box.second.GetSize(BoxArea::Border)));
 
 		texture_region.ExtendTopLeft(-extend_min);
 		texture_region.ExtendBottomRight(extend_max);
@@ -200,26 +222,20 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 		texture_dimensions = Vector2i(texture_region.Size());
 	}
 
-	Geometry& main_geometry = *GetGeometry(BackgroundType::Main);
-
 	// Callback for generating the box-shadow texture. Using a callback ensures that the texture can be regenerated at any time, for example if the
-	// device loses its GPU context and the client calls Rml::ReleaseTextures().
-	auto p_callback = [&main_geometry, element, border_radius, texture_dimensions, element_offset_in_texture, shadow_list](
-						  RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
-		Context* context = element->GetContext();
-		if (!context)
-		{
-			RMLUI_ERROR;
-			return false;
-		}
+	// device loses its GPU context and the client calls Rml::ReleaseTextures(). The texture may be shared with other elements, thus everything
+	// needed is captured by value instead of referring to the element.
+	auto p_callback = [context, key, texture_dimensions, element_offset_in_texture](RenderInterface* render_interface, const String& /*name*/,
+						  TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
 		RMLUI_ASSERT(context->GetRenderInterface() == render_interface);
 
+		Geometry main_geometry(render_interface);           // Render geometry for the element's backgrounds and borders.
 		Geometry geometry_padding(render_interface);        // Render geometry for inner box-shadow.
 		Geometry geometry_padding_border(render_interface); // Clipping mask for outer box-shadow.
 
 		bool has_inner_shadow = false;
 		bool has_outer_shadow = false;
-		for (const Shadow& shadow : shadow_list)
+		for (const Shadow& shadow : key.shadows)
 		{
 			if (shadow.inset)
 				has_inner_shadow = true;
@@ -227,16 +243,17 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 				has_outer_shadow = true;
 		}
 
-		// Generate the geometry for all the element's boxes and extend the render-texture further to cover all of them.
-		for (int i = 0; i < element->GetNumBoxes(); i++)
+		// Generate the geometry for all the element's boxes.
+		for (const auto& offset_box : key.boxes)
 		{
-			Vector2f offset;
-			const Box& box = element->GetBox(i, offset);
+			const Vector2f offset = offset_box.first;
+			const Box& box = offset_box.second;
 
+			GeometryUtilities::GenerateBackgroundBorder(&main_geometry, box, offset, key.border_radius, key.background_color, key.border_colors);
 			if (has_inner_shadow)
-				GeometryUtilities::GenerateBackground(&geometry_padding, box, offset, border_radius, Colourb(255), BoxArea::Padding);
+				GeometryUtilities::GenerateBackground(&geometry_padding, box, offset, key.border_radius, Colourb(255), BoxArea::Padding);
 			if (has_outer_shadow)
-				GeometryUtilities::GenerateBackground(&geometry_padding_border, box, offset, border_radius, Colourb(255), BoxArea::Border);
+				GeometryUtilities::GenerateBackground(&geometry_padding_border, box, offset, key.border_radius, Colourb(255), BoxArea::Border);
 		}
 
 		RenderState& render_state = context->GetRenderState();
@@ -248,15 +265,15 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 
 		main_geometry.Render(element_offset_in_texture);
 
-		for (int shadow_index = (int)shadow_list.size() - 1; shadow_index >= 0; shadow_index--)
+		for (int shadow_index = (int)key.shadows.size() - 1; shadow_index >= 0; shadow_index--)
 		{
-			const Shadow& shadow = shadow_list[shadow_index];
+			const Shadow& shadow = key.shadows[shadow_index];
 			const Vector2f shadow_offset = {shadow.offset_x.number, shadow.offset_y.number};
 			const bool inset = shadow.inset;
 			const float spread_distance = shadow.spread_distance.number;
 			const float blur_radius = shadow.blur_radius.number;
 
-			Vector4f spread_radii = border_radius;
+			Vector4f spread_radii = key.border_radius;
 			for (int i = 0; i < 4; i++)
 			{
 				float& radius = spread_radii[i];
@@ -272,10 +289,10 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 			Geometry shadow_geometry;
 
 			// Generate the shadow geometry. For outer box-shadows it is rendered normally, while for inner box-shadows it is used as a clipping mask.
-			for (int i = 0; i < element->GetNumBoxes(); i++)
+			for (const auto& offset_box : key.boxes)
 			{
-				Vector2f offset;
-				Box box = element->GetBox(i, offset);
+				Vector2f offset = offset_box.first;
+				Box box = offset_box.second;
 				const float signed_spread_distance = (inset ? -spread_distance : spread_distance);
 				offset -= Vector2f(signed_spread_distance);
 
@@ -296,6 +313,7 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 				blur = render_interface->CompileFilter("blur", Dictionary{{"radius", Variant(blur_radius)}});
 				if (blur)
 				{
+					render_state.FlushDrawList();
 					render_interface->PushLayer(RenderClear::Clear);
 					render_interface->AttachFilter(blur);
 				}
@@ -321,11 +339,13 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 
 			if (blur)
 			{
+				render_state.FlushDrawList();
 				render_interface->PopLayer(RenderTarget::Layer, BlendMode::Blend);
 				render_interface->ReleaseCompiledFilter(blur);
 			}
 		}
 
+		render_state.FlushDrawList();
 		TextureHandle shadow_texture = render_interface->PopLayer(RenderTarget::RenderTexture, BlendMode::Replace);
 
 		render_state.DisableScissorRegion();
@@ -337,20 +357,19 @@ void ElementBackgroundBorder::GenerateBoxShadow(Element* element, ShadowList sha
 		return true;
 	};
 
-	// Generate the geometry for the box-shadow texture.
+	// Generate the geometry for the box-shadow texture, which is shared with all elements using an identical box-shadow.
 	Background& shadow_background = GetOrCreateBackground(element, BackgroundType::BoxShadow);
 	Geometry& shadow_geometry = shadow_background.geometry;
-	Texture& shadow_texture = shadow_background.texture;
+	shadow_background.texture = context->GetBoxShadowCache().GetTexture(key, texture_dimensions, p_callback);
+	shadow_context = context;
 
 	Vector<Vertex>& vertices = shadow_geometry.GetVertices();
 	Vector<int>& indices = shadow_geometry.GetIndices();
 	vertices.resize(4);
 	indices.resize(6);
-	const byte alpha = byte(opacity * 255.f);
-	GeometryUtilities::GenerateQuad(vertices.data(), indices.data(), -element_offset_in_texture, Vector2f(texture_dimensions), Colourb(255, alpha));
+	GeometryUtilities::GenerateQuad(vertices.data(), indices.data(), -element_offset_in_texture, Vector2f(texture_dimensions), Colourb(255));
 
-	shadow_texture.Set("box-shadow", p_callback);
-	shadow_geometry.SetTexture(&shadow_texture);
+	shadow_geometry.SetTexture(shadow_background.texture.get());
 }
 
 Geometry* ElementBackgroundBorder::GetGeometry(BackgroundType type)
@@ -52,11 +52,13 @@ private:
 	struct Background {
 		Background(Element* element) : geometry(element) {}
 		Geometry geometry;
-		Texture texture;
+		// Texture shared with other elements, see BoxShadowCache.
+		SharedPtr<const Texture> texture;
 	};
 
 	void GenerateGeometry(Element* element);
-	void GenerateBoxShadow(Element* element, ShadowList shadow_list, Vector4f border_radius, float opacity);
+	void GenerateBoxShadow(Element* element, ShadowList shadow_list, Vector4f border_radius, Colourb background_color,
+		const Colourb (&border_colors)[4]);
 
 	Geometry* GetGeometry(BackgroundType type);
 	Background& GetOrCreateBackground(Element* element, BackgroundType type);
@@ -64,6 +66,9 @@ private:
 	bool background_dirty = false;
 	bool border_dirty = false;
 
+	// The context whose box-shadow cache provided our box-shadow texture.
+	Context* shadow_context = nullptr;
+
 	Array<UniquePtr<Background>, (size_t)BackgroundType::Count> geometries;
 };
 
@@ -37,6 +37,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "FrameProfiler.h"
 
 namespace Rml {
 
@@ -142,6 +143,8 @@ void ElementDecoration::ReloadDecoratorsData()
 	if (decorators_data_dirty)
 	{
 		decorators_data_dirty = false;
+		if (!decorators.empty())
+			FrameProfiler::Count(FrameProfiler::Counter::GeometryGenerated);
 
 		for (DecoratorHandle& decorator : decorators)
 		{
@@ -209,6 +212,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 			scissor_region.IntersectValid(Rectanglei(filter_rectangle));
 			render_state.SetScissorRegion(scissor_region);
 
+			render_state.FlushDrawList();
 			render_interface->PushLayer(RenderClear::Clone);
 
 			const int i0 = num_backgrounds;
@@ -218,6 +222,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 				decorator.decorator->RenderElement(element, decorator.decorator_data);
 			}
 
+			render_state.FlushDrawList();
 			render_interface->PopLayer(RenderTarget::Layer, BlendMode::Replace);
 		}
 	}
@@ -226,6 +231,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 	{
 		if (render_stage == RenderStage::Enter)
 		{
+			render_state.FlushDrawList();
 			render_interface->PushLayer(RenderClear::Clear);
 		}
 		else if (render_stage == RenderStage::Exit)
@@ -234,6 +240,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 
 			if (num_mask_images > 0)
 			{
+				render_state.FlushDrawList();
 				render_interface->PushLayer(RenderClear::Clear);
 
 				const int i0_mask = num_backgrounds + num_backdrop_filters + num_filters;
@@ -243,6 +250,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 					decorator.decorator->RenderElement(element, decorator.decorator_data);
 				}
 
+				render_state.FlushDrawList();
 				render_interface->PopLayer(RenderTarget::MaskImage, BlendMode::Replace);
 			}
 			
@@ -266,6 +274,7 @@ void ElementDecoration::RenderDecorators(RenderStage render_stage)
 				decorator.decorator->RenderElement(element, decorator.decorator_data);
 			}
 
+			render_state.FlushDrawList();
 			render_interface->PopLayer(RenderTarget::Layer, BlendMode::Blend);
 		}
 	}
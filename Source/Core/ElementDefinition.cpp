@@ -34,12 +34,35 @@ namespace Rml {
 
 ElementDefinition::ElementDefinition(const Vector< const StyleSheetNode* >& style_sheet_nodes)
 {
-	// Initialises the element definition from the list of style sheet nodes.
-	for (size_t i = 0; i < style_sheet_nodes.size(); ++i)
-		properties.Merge(style_sheet_nodes[i]->GetProperties());
+	// Initialises the element definition from the list of style sheet nodes. First find the property with the highest specificity for each
+	// id, where later nodes take precedence on equal specificity. Then insert the properties in order of increasing id, which lets the
+	// dictionary append them to its sorted storage.
+	static_assert(sizeof(PropertyId) == 1, "Assumes 8-bit property ids.");
+	Array<const Property*, 256> applied_properties = {};
+	int num_properties = 0;
 
-	for (auto& property : properties.GetProperties())
-		property_ids.Insert(property.first);
+	for (const StyleSheetNode* node : style_sheet_nodes)
+	{
+		for (const auto& pair : node->GetProperties().GetProperties())
+		{
+			const Property*& applied_property = applied_properties[(size_t)pair.first];
+			if (!applied_property)
+				num_properties += 1;
+			if (!applied_property || pair.second.specificity >= applied_property->specificity)
+				applied_property = &pair.second;
+		}
+	}
+
+	properties.Reserve(num_properties);
+
+	for (size_t i = 0; i < applied_properties.size(); i++)
+	{
+		if (const Property* property = applied_properties[i])
+		{
+			properties.SetProperty(PropertyId(i), *property);
+			property_ids.Insert(PropertyId(i));
+		}
+	}
 }
 
 const Property* ElementDefinition::GetProperty(PropertyId id) const
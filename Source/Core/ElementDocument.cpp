@@ -37,6 +37,7 @@
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "HitTestGrid.h"
 #include "LayoutEngine.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
@@ -55,6 +56,9 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 
 	position_dirty = false;
 
+	hit_test_grid_dirty = true;
+	render_bounds_generation = 0;
+
 	ForceLocalStackingContext();
 	SetOwnerDocument(this);
 
@@ -420,6 +424,12 @@ void ElementDocument::UpdateLayout()
 {
 	// Note: Carefully consider when to call this function for performance reasons.
 	// Ideally, only called once per update loop.
+	if (!layout_dirty && !dirty_layout_boundaries.empty())
+	{
+		if (!UpdateLayoutBoundaries())
+			layout_dirty = true;
+	}
+
 	if(layout_dirty)
 	{
 		RMLUI_ZoneScoped;
@@ -435,6 +445,56 @@ void ElementDocument::UpdateLayout()
 		// In particular, scrollbars being enabled may set the dirty flag, but this case is already handled within the layout engine.
 		layout_dirty = false;
 	}
+
+	dirty_layout_boundaries.clear();
+}
+
+// Formats the dirty relayout boundaries.
+bool ElementDocument::UpdateLayoutBoundaries()
+{
+	RMLUI_ZoneScoped;
+
+	Vector<ObserverPtr<Element>> boundaries;
+	std::swap(boundaries, dirty_layout_boundaries);
+
+	SmallUnorderedSet<Element*> pending_boundaries;
+	for (const ObserverPtr<Element>& boundary : boundaries)
+	{
+		if (Element* element = boundary.get())
+			pending_boundaries.insert(element);
+	}
+
+	SmallUnorderedSet<Element*> formatted_boundaries;
+	auto is_descendant_of_any = [this](Element* element, const SmallUnorderedSet<Element*>& ancestors) {
+		for (Element* ancestor = element->GetParentNode(); ancestor && ancestor != this; ancestor = ancestor->GetParentNode())
+		{
+			if (ancestors.find(ancestor) != ancestors.end())
+				return true;
+		}
+		return false;
+	};
+
+	for (const ObserverPtr<Element>& boundary : boundaries)
+	{
+		Element* element = boundary.get();
+		if (!element || element->GetOwnerDocument() != this || formatted_boundaries.find(element) != formatted_boundaries.end())
+			continue;
+
+		// Descendants of other dirty boundaries will be formatted along with their ancestor.
+		if (is_descendant_of_any(element, pending_boundaries) || is_descendant_of_any(element, formatted_boundaries))
+			continue;
+
+		// Format the boundary. If its outer size changed, its parent's layout is affected too, continue with the next boundary up the tree.
+		while (element && !LayoutEngine::FormatRelayoutBoundary(element))
+			element = LayoutEngine::FindRelayoutBoundary(element);
+
+		if (!element)
+			return false;
+
+		formatted_boundaries.insert(element);
+	}
+
+	return true;
 }
 
 // Updates the position of the document based on the style properties.
@@ -481,8 +541,74 @@ void ElementDocument::DirtyPosition()
 	position_dirty = true;
 }
 
+Element* ElementDocument::GetElementAtPoint(Vector2f point, const Element* ignore_element)
+{
+	if (!hit_test_grid_dirty && !hit_test_moved_elements.empty())
+	{
+		RMLUI_ZoneScopedN("UpdateHitTestGrid");
+
+		for (const ObserverPtr<Element>& element : hit_test_moved_elements)
+		{
+			if (element && !hit_test_grid->UpdateMovedSubtree(element.get()))
+			{
+				hit_test_grid_dirty = true;
+				break;
+			}
+		}
+		hit_test_moved_elements.clear();
+	}
+
+	if (hit_test_grid_dirty)
+	{
+		RMLUI_ZoneScopedN("BuildHitTestGrid");
+
+		if (!hit_test_grid)
+			hit_test_grid = MakeUnique<HitTestGrid>();
+
+		hit_test_grid_dirty = false;
+		hit_test_grid->Build(this);
+	}
+
+	return hit_test_grid->GetElementAtPoint(point, ignore_element);
+}
+
+void ElementDocument::DirtyHitTestGrid()
+{
+	hit_test_grid_dirty = true;
+	hit_test_moved_elements.clear();
+	render_bounds_generation += 1;
+}
+
+void ElementDocument::DirtyHitTestGridSubtree(Element* element)
+{
+	// Beyond this many moved elements we rather rebuild the whole grid.
+	static constexpr size_t MaxMovedElements = 32;
+
+	render_bounds_generation += 1;
+
+	if (hit_test_grid_dirty)
+		return;
+
+	for (const ObserverPtr<Element>& moved_element : hit_test_moved_elements)
+	{
+		if (moved_element.get() == element)
+			return;
+	}
+
+	if (hit_test_moved_elements.size() >= MaxMovedElements)
+		DirtyHitTestGrid();
+	else
+		hit_test_moved_elements.push_back(element->GetObserverPtr());
+}
+
+void ElementDocument::DirtyRenderBounds()
+{
+	render_bounds_generation += 1;
+}
+
 void ElementDocument::DirtyLayout()
 {
+	LayoutEngine::DirtyLayoutCache(this);
 	layout_dirty = true;
 }
 
@@ -491,6 +617,22 @@ bool ElementDocument::IsLayoutDirty()
 	return layout_dirty;
 }
 
+void ElementDocument::DirtyElementLayout(Element* element)
+{
+	if (layout_dirty)
+		return;
+
+	Element* boundary = LayoutEngine::FindRelayoutBoundary(element);
+	if (!boundary)
+	{
+		layout_dirty = true;
+		return;
+	}
+
+	if (dirty_layout_boundaries.empty() || dirty_layout_boundaries.back().get() != boundary)
+		dirty_layout_boundaries.push_back(boundary->GetObserverPtr());
+}
+
 void ElementDocument::DirtyVwAndVhProperties()
 {
 	GetStyle()->DirtyPropertiesWithUnitsRecursive(Unit::VW | Unit::VH);
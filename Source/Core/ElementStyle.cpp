@@ -43,8 +43,10 @@
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
+#include "AncestorFilter.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "FrameProfiler.h"
 #include "ComputeProperty.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
@@ -175,6 +177,7 @@ void ElementStyle::UpdateDefinition()
 	if (definition_dirty)
 	{
 		RMLUI_ZoneScoped;
+		FrameProfiler::Count(FrameProfiler::Counter::DefinitionsUpdated);
 
 		definition_dirty = false;
 
@@ -340,6 +343,19 @@ bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 	return true;
 }
 
+bool ElementStyle::SetAnimatedProperty(PropertyId id, const Property& property)
+{
+	Property new_property = property;
+
+	new_property.definition = StyleSheetSpecification::GetProperty(id);
+	if (!new_property.definition)
+		return false;
+
+	inline_properties.SetProperty(id, new_property);
+
+	return true;
+}
+
 // Removes a local property override on the element.
 void ElementStyle::RemoveProperty(PropertyId id)
 {
@@ -571,6 +587,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		return PropertyIdSet();
 
 	RMLUI_ZoneScopedC(0xFF7F50);
+	FrameProfiler::Count(FrameProfiler::Counter::ElementsUpdated);
 
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
@@ -581,6 +598,25 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 	const float font_size_before = values.font_size();
 	const Style::LineHeight line_height_before = values.line_height();
 
+	// Siblings with the same definition and no inline properties have identical computed values, thus we can copy them from a previously
+	// updated sibling instead of computing them again.
+	const bool can_share_values = (inline_properties.GetNumProperties() == 0);
+	if (const Style::ComputedValues* shared_values = (can_share_values ? AncestorFilter::FindSharedComputedValues(element, definition.get()) : nullptr))
+	{
+		values.CopyAll(*shared_values);
+
+		// Dirty the same dependent properties as below in case the copied values changed.
+		if (font_size_before != values.font_size())
+		{
+			DirtyPropertiesWithUnits(Unit::EM);
+			dirty_properties.Insert(PropertyId::LineHeight);
+		}
+		if (line_height_before.value != values.line_height().value || line_height_before.inherit_value != values.line_height().inherit_value)
+			dirty_properties.Insert(PropertyId::VerticalAlign);
+
+		return ConsumeDirtyProperties();
+	}
+
 	// The next flag is just a small optimization, if the element was just created we don't need to copy all the default values.
 	if (!values_are_default_initialized)
 	{
@@ -951,7 +987,15 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 			GetFontEngineInterface()->GetFontFaceHandle(values.font_family(), values.font_style(), values.font_weight(), (int)values.font_size()));
 	}
 
-	// Next, pass inheritable dirty properties onto our children
+	if (can_share_values)
+		AncestorFilter::AddSharedComputedValues(element, definition, values);
+
+	return ConsumeDirtyProperties();
+}
+
+PropertyIdSet ElementStyle::ConsumeDirtyProperties()
+{
+	// Pass inheritable dirty properties onto our children
 	PropertyIdSet dirty_inherited_properties = (dirty_properties & StyleSheetSpecification::GetRegisteredInheritedProperties());
 
 	if (!dirty_inherited_properties.Empty())
@@ -94,6 +94,11 @@ public:
 	/// @param[in] name The name of the new property.
 	/// @param[in] property The parsed property to set.
 	bool SetProperty(PropertyId id, const Property& property);
+	/// Sets a local property override on the element without dirtying it, for animated values which the element applies to its computed
+	/// values directly.
+	/// @param[in] name The name of the new property.
+	/// @param[in] property The parsed property to set.
+	bool SetAnimatedProperty(PropertyId id, const Property& property);
 	/// Removes a local property override on the element; its value will revert to that defined in
 	/// the style sheet.
 	/// @param[in] name The name of the local property definition to remove.
@@ -151,6 +156,8 @@ private:
 	void DirtyChildDefinitions();
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
+	// Passes inherited dirty properties onto the children, then clears and returns the dirty properties.
+	PropertyIdSet ConsumeDirtyProperties();
 
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/Property.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "FrameProfiler.h"
 #include "TransformState.h"
 
 namespace Rml {
@@ -142,11 +143,17 @@ void ElementText::OnRender()
 	if (render)
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
+		{
+			geometry[i].SetOpacity(opacity);
 			geometry[i].Render(translation);
+		}
 	}
 
 	if (decoration_property != Style::TextDecoration::None)
+	{
+		decoration.SetOpacity(opacity);
 		decoration.Render(translation);
+	}
 }
 
 // Generates a token of text from this element, returning only the width.
@@ -309,6 +316,8 @@ void ElementText::ClearLines()
 	lines.clear();
 	generated_decoration = Style::TextDecoration::None;
 	decoration.Release(true);
+
+	DirtyRenderBounds();
 }
 
 // Adds a new line into the text element.
@@ -326,6 +335,32 @@ void ElementText::AddLine(Vector2f line_position, const String& line)
 	lines.emplace_back(line, baseline_position);
 
 	geometry_dirty = true;
+	DirtyRenderBounds();
+}
+
+Rectanglef ElementText::GetTextBounds()
+{
+	FontFaceHandle font_face_handle = GetFontFaceHandle();
+	if (font_face_handle == 0 || lines.empty())
+		return Rectanglef::FromPosition(Vector2f(0));
+
+	const float line_height = (float)GetFontEngineInterface()->GetLineHeight(font_face_handle);
+
+	Rectanglef bounds = Rectanglef::CreateInvalid();
+	for (Line& line : lines)
+	{
+		// Lines are only measured when their geometry is generated, which is not the case for text that has not been rendered yet.
+		if (line.width < 0)
+			line.width = GetFontEngineInterface()->GetStringWidth(font_face_handle, line.text);
+
+		const Rectanglef line_bounds = Rectanglef::FromPositionSize(line.position - Vector2f(0, line_height), Vector2f((float)line.width, line_height));
+		if (bounds.Valid())
+			bounds.Join(line_bounds);
+		else
+			bounds = line_bounds;
+	}
+
+	return bounds;
 }
 
 // Prevents the element from dirtying its document's layout when its text is changed.
@@ -347,23 +382,16 @@ void ElementText::OnPropertyChange(const PropertyIdSet& changed_properties)
 	if (changed_properties.Contains(PropertyId::Color) ||
 		changed_properties.Contains(PropertyId::Opacity))
 	{
-		const float new_opacity = computed.opacity();
-		const bool opacity_changed = opacity != new_opacity;
+		// The opacity is applied to the geometry when rendered, thus changing it does not require the geometry to be regenerated.
+		opacity = computed.opacity();
 
-		Colourb new_colour = computed.color();
-		new_colour.alpha = byte(new_opacity * float(new_colour.alpha));
+		const Colourb new_colour = computed.color();
 		colour_changed = colour != new_colour;
 
 		if (colour_changed)
 		{
 			colour = new_colour;
 		}
-		if (opacity_changed)
-		{
-			opacity = new_opacity;
-			font_effects_dirty = true;
-			geometry_dirty = true;
-		}
 	}
 
 	if (changed_properties.Contains(PropertyId::FontFamily) ||
@@ -454,6 +482,7 @@ bool ElementText::UpdateFontEffects()
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
+	FrameProfiler::Count(FrameProfiler::Counter::GeometryGenerated);
 
 	// Release the old geometry ...
 	for (size_t i = 0; i < geometry.size(); ++i)
@@ -471,7 +500,7 @@ void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
 
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, Line& line)
 {
-	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, opacity, geometry);
+	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, 1.f, geometry);
 	for (size_t i = 0; i < geometry.size(); ++i)
 		geometry[i].SetHostElement(this);
 }
@@ -33,12 +33,16 @@
 #include "../../../Include/RmlUi/Core/Event.h"
 #include "../../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../../Include/RmlUi/Core/Factory.h"
+#include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Property.h"
 #include "../../../Include/RmlUi/Core/Elements/DataFormatter.h"
 #include "../../../Include/RmlUi/Core/Elements/ElementDataGridRow.h"
 
 namespace Rml {
 
+// The number of rows instanced above and below the visible scroll window of virtualized rows.
+static const int NUM_OVERSCAN_ROWS = 4;
+
 ElementDataGrid::ElementDataGrid(const String& tag) : Element(tag)
 {
 	XMLAttributes attributes;
@@ -66,15 +70,53 @@ ElementDataGrid::ElementDataGrid(const String& tag) : Element(tag)
 	SetProperty(PropertyId::OverflowY, Property(Style::Overflow::Auto));
 
 	new_data_source = "";
+
+	virtualized = false;
+	virtual_data_source = nullptr;
+	num_virtual_rows = 0;
+	virtual_row_height = 0;
 }
 
 ElementDataGrid::~ElementDataGrid()
 {
+	if (virtual_data_source)
+	{
+		virtual_data_source->DetachListener(this);
+		virtual_data_source = nullptr;
+	}
+}
+
+void ElementDataGrid::SetDataSource(const String& _data_source_name)
+{
+	new_data_source = _data_source_name;
+}
+
+void ElementDataGrid::SetVirtualized(bool _virtualized)
+{
+	if (virtualized == _virtualized)
+		return;
+
+	// Remove the rows of the current mode, the data source is applied again in the new mode on the next update.
+	if (virtualized)
+	{
+		SetVirtualDataSource("");
+	}
+	else
+	{
+		root->SetDataSource("");
+		if (!root->children.empty())
+			root->RemoveChildren();
+	}
+
+	virtualized = _virtualized;
+
+	if (new_data_source.empty())
+		new_data_source = data_source_name;
 }
 
-void ElementDataGrid::SetDataSource(const String& data_source_name)
+bool ElementDataGrid::IsVirtualized() const
 {
-	new_data_source = data_source_name;
+	return virtualized;
 }
 
 // Adds a column to the table.
@@ -140,6 +182,8 @@ void ElementDataGrid::AddColumn(const String& fields, const String& formatter, f
 	if (DispatchEvent(EventId::Columnadd, parameters))
 	{
 		root->RefreshRows();
+		// The virtualized rows were instanced with the previous columns, so they are instanced again on the next update.
+		ClearVirtualRows();
 		DirtyLayout();
 	}
 }
@@ -211,12 +255,25 @@ void ElementDataGrid::RemoveRows(int index, int num_rows)
 // Returns the number of rows in the table
 int ElementDataGrid::GetNumRows() const
 {
+	if (virtualized)
+		return num_virtual_rows;
+
 	return body->GetNumChildren();
 }
 
 // Returns the row at the given index in the table.
 ElementDataGridRow* ElementDataGrid::GetRow(int index) const
 {
+	if (virtualized)
+	{
+		for (ElementDataGridRow* row : virtual_rows)
+		{
+			if (row->child_index == index)
+				return row;
+		}
+		return nullptr;
+	}
+
 	// We need to add two to the index, to skip the header row.
 	ElementDataGridRow* row = rmlui_dynamic_cast< ElementDataGridRow* >(body->GetChild(index));
 	return row;
@@ -226,17 +283,317 @@ void ElementDataGrid::OnUpdate()
 {
 	if (!new_data_source.empty())
 	{
-		root->SetDataSource(new_data_source);
+		if (virtualized)
+			SetVirtualDataSource(new_data_source);
+		else
+			root->SetDataSource(new_data_source);
+
+		data_source_name = new_data_source;
 		new_data_source = "";
 	}
 
-	bool any_new_children = root->UpdateChildren();
+	bool any_new_children = (virtualized ? UpdateVirtualRows() : root->UpdateChildren());
 	if (any_new_children)
 	{
 		DispatchEvent(EventId::Rowupdate, Dictionary());
 	}
 }
 
+void ElementDataGrid::OnAttributeChange(const ElementAttributes& changed_attributes)
+{
+	Element::OnAttributeChange(changed_attributes);
+
+	if (changed_attributes.find("virtualized") != changed_attributes.end())
+		SetVirtualized(HasAttribute("virtualized"));
+}
+
+void ElementDataGrid::OnDataSourceDestroy(DataSource* /*data_source*/)
+{
+	SetVirtualDataSource("");
+}
+
+void ElementDataGrid::OnRowAdd(DataSource* data_source, const String& table, int first_row_added, int num_rows_added)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	num_virtual_rows += num_rows_added;
+
+	// Move the instanced rows below the added rows down, their contents are still valid.
+	for (ElementDataGridRow* row : virtual_rows)
+	{
+		if (row->child_index >= first_row_added)
+		{
+			row->child_index += num_rows_added;
+			PositionVirtualRow(row);
+		}
+	}
+
+	Dictionary parameters;
+	parameters["first_row_added"] = first_row_added;
+	parameters["num_rows_added"] = num_rows_added;
+
+	DispatchEvent(EventId::Rowadd, parameters);
+}
+
+void ElementDataGrid::OnRowRemove(DataSource* data_source, const String& table, int first_row_removed, int num_rows_removed)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	num_virtual_rows -= num_rows_removed;
+
+	for (ElementDataGridRow* row : virtual_rows)
+	{
+		if (row->child_index >= first_row_removed + num_rows_removed)
+		{
+			row->child_index -= num_rows_removed;
+			PositionVirtualRow(row);
+		}
+		else if (row->child_index >= first_row_removed)
+		{
+			row->child_index = -1;
+			row->SetProperty(PropertyId::Display, Property(Style::Display::None));
+		}
+	}
+
+	Dictionary parameters;
+	parameters["first_row_removed"] = first_row_removed;
+	parameters["num_rows_removed"] = num_rows_removed;
+
+	DispatchEvent(EventId::Rowremove, parameters);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const String& table, int first_row_changed, int num_rows_changed)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	for (ElementDataGridRow* row : virtual_rows)
+	{
+		if (row->child_index >= first_row_changed && row->child_index < first_row_changed + num_rows_changed)
+			row->dirty_cells = true;
+	}
+
+	Dictionary parameters;
+	parameters["first_row_changed"] = first_row_changed;
+	parameters["num_rows_changed"] = num_rows_changed;
+
+	DispatchEvent(EventId::Rowchange, parameters);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const String& table)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	const int num_rows_removed = num_virtual_rows;
+	num_virtual_rows = virtual_data_source->GetNumRows(virtual_data_table);
+
+	for (ElementDataGridRow* row : virtual_rows)
+		row->dirty_cells = true;
+
+	Dictionary parameters;
+	parameters["first_row_removed"] = 0;
+	parameters["num_rows_removed"] = num_rows_removed;
+	DispatchEvent(EventId::Rowremove, parameters);
+
+	parameters.clear();
+	parameters["first_row_added"] = 0;
+	parameters["num_rows_added"] = num_virtual_rows;
+	DispatchEvent(EventId::Rowadd, parameters);
+}
+
+void ElementDataGrid::SetVirtualDataSource(const String& _data_source_name)
+{
+	if (virtual_data_source)
+	{
+		virtual_data_source->DetachListener(this);
+		virtual_data_source = nullptr;
+	}
+
+	ClearVirtualRows();
+	num_virtual_rows = 0;
+
+	if (ParseDataSource(virtual_data_source, virtual_data_table, _data_source_name))
+	{
+		virtual_data_source->AttachListener(this);
+		num_virtual_rows = virtual_data_source->GetNumRows(virtual_data_table);
+
+		// The rows are absolutely positioned within the body, which is sized to fit all the rows.
+		body->SetProperty(PropertyId::Position, Property(Style::Position::Relative));
+	}
+	else
+	{
+		body->RemoveProperty(PropertyId::Position);
+		body->RemoveProperty(PropertyId::Height);
+	}
+
+	DirtyLayout();
+}
+
+bool ElementDataGrid::UpdateVirtualRows()
+{
+	if (!virtual_data_source)
+		return false;
+
+	// Measure the row height from a row that has been laid out, otherwise start from an estimate.
+	float row_height = virtual_row_height;
+	for (ElementDataGridRow* row : virtual_rows)
+	{
+		if (row->child_index >= 0 && !row->dirty_cells)
+		{
+			const float height = row->GetBox().GetSize(BoxArea::Margin).y;
+			if (height > 0)
+			{
+				row_height = height;
+				break;
+			}
+		}
+	}
+	if (row_height <= 0)
+		row_height = Math::Max(GetLineHeight(), 1.f);
+
+	if (row_height != virtual_row_height)
+	{
+		virtual_row_height = row_height;
+		for (ElementDataGridRow* row : virtual_rows)
+		{
+			if (row->child_index >= 0)
+				PositionVirtualRow(row);
+		}
+	}
+
+	const Property body_height(float(num_virtual_rows) * virtual_row_height, Unit::PX);
+	const Property* current_body_height = body->GetLocalProperty(PropertyId::Height);
+	if (!current_body_height || *current_body_height != body_height)
+		body->SetProperty(PropertyId::Height, body_height);
+
+	// Find the rows within the visible scroll window, relative to the top of the body.
+	const float window_top = GetAbsoluteOffset(BoxArea::Padding).y - body->GetAbsoluteOffset(BoxArea::Content).y;
+	const float window_bottom = window_top + GetClientHeight();
+	const int first_row = Math::Clamp(Math::RoundDownToInteger(window_top / virtual_row_height) - NUM_OVERSCAN_ROWS, 0, num_virtual_rows);
+	const int last_row = Math::Clamp(Math::RoundUpToInteger(window_bottom / virtual_row_height) + NUM_OVERSCAN_ROWS, first_row, num_virtual_rows);
+
+	// Keep the rows already instanced within the window, and free the rest for recycling.
+	RowList window_rows(last_row - first_row, nullptr);
+	RowList free_rows;
+	for (ElementDataGridRow* row : virtual_rows)
+	{
+		if (row->child_index >= first_row && row->child_index < last_row)
+			window_rows[row->child_index - first_row] = row;
+		else
+			free_rows.push_back(row);
+	}
+
+	for (int i = 0; i < (int)window_rows.size(); i++)
+	{
+		if (window_rows[i])
+			continue;
+
+		ElementDataGridRow* row = nullptr;
+		if (free_rows.empty())
+		{
+			row = AddVirtualRow();
+		}
+		else
+		{
+			row = free_rows.back();
+			free_rows.pop_back();
+		}
+
+		if (row->child_index < 0)
+			row->SetProperty(PropertyId::Display, Property(Style::Display::InlineBlock));
+
+		row->child_index = first_row + i;
+		row->dirty_cells = true;
+		PositionVirtualRow(row);
+
+		window_rows[i] = row;
+	}
+
+	for (ElementDataGridRow* row : free_rows)
+	{
+		if (row->child_index >= 0)
+		{
+			row->child_index = -1;
+			row->SetProperty(PropertyId::Display, Property(Style::Display::None));
+		}
+	}
+
+	// Fetch the dirty rows from the data source, with one query for each consecutive run of dirty rows. Queries are limited to the rows the
+	// data source currently has, in case it lost rows without notifying us.
+	int num_rows_available = -1;
+	bool any_rows_loaded = false;
+	for (int i = 0; i < (int)window_rows.size();)
+	{
+		if (!window_rows[i]->dirty_cells)
+		{
+			i++;
+			continue;
+		}
+
+		int num_rows_to_load = 1;
+		while (i + num_rows_to_load < (int)window_rows.size() && window_rows[i + num_rows_to_load]->dirty_cells)
+			num_rows_to_load++;
+
+		if (num_rows_available < 0)
+			num_rows_available = virtual_data_source->GetNumRows(virtual_data_table);
+
+		const int num_rows_to_query = Math::Clamp(num_rows_available - (first_row + i), 0, num_rows_to_load);
+		DataQuery query(virtual_data_source, virtual_data_table, column_fields, first_row + i, num_rows_to_query);
+		for (int j = 0; j < num_rows_to_load; j++)
+		{
+			if (!query.NextRow())
+			{
+				Log::Message(Log::LT_WARNING, "Failed to load row %d from data source %s", first_row + i + j, virtual_data_table.c_str());
+
+				// Clear the remaining rows, which may have been recycled from other rows, rather than querying them again every update.
+				for (int k = j; k < num_rows_to_load; k++)
+					window_rows[i + k]->ClearCells();
+				break;
+			}
+
+			window_rows[i + j]->Load(query);
+		}
+
+		i += num_rows_to_load;
+		any_rows_loaded = true;
+	}
+
+	return any_rows_loaded;
+}
+
+ElementDataGridRow* ElementDataGrid::AddVirtualRow()
+{
+	XMLAttributes attributes;
+	ElementPtr element = Factory::InstanceElement(this, "#rmlctl_datagridrow", "datagridrow", attributes);
+	ElementDataGridRow* new_row = rmlui_dynamic_cast< ElementDataGridRow* >(element.get());
+
+	// The virtualized rows have no parent row, their child index is the index of the row in the data source.
+	new_row->Initialise(this, nullptr, -1, header, 0);
+	new_row->SetProperty(PropertyId::Position, Property(Style::Position::Absolute));
+	new_row->SetProperty(PropertyId::Left, Property(0.f, Unit::PX));
+
+	body->AppendChild(std::move(element));
+	virtual_rows.push_back(new_row);
+
+	return new_row;
+}
+
+void ElementDataGrid::PositionVirtualRow(ElementDataGridRow* row)
+{
+	row->SetProperty(PropertyId::Top, Property(float(row->child_index) * virtual_row_height, Unit::PX));
+}
+
+void ElementDataGrid::ClearVirtualRows()
+{
+	for (ElementDataGridRow* row : virtual_rows)
+		body->RemoveChild(row);
+
+	virtual_rows.clear();
+}
+
 
 void ElementDataGrid::OnResize()
 {
@@ -225,9 +225,11 @@ int ElementDataGridRow::GetParentRelativeIndex()
 // Returns the index of this row, relative to the table rather than its parent.
 int ElementDataGridRow::GetTableRelativeIndex()
 {
+	// Rows without a parent row are either the header or root rows with a child index of -1, or virtualized rows where
+	// the child index is the index in the table.
 	if (!parent_row)
 	{
-		return -1;
+		return child_index;
 	}
 
 	if (table_relative_index_dirty)
@@ -551,6 +553,21 @@ void ElementDataGridRow::Load(const DataQuery& row_information)
 	dirty_cells = false;
 }
 
+// Removes the cell contents, and marks the row as loaded.
+void ElementDataGridRow::ClearCells()
+{
+	for (int i = 0; i < parent_grid->GetNumColumns(); i++)
+	{
+		if (Element* cell = GetChild(i))
+		{
+			while (cell->GetNumChildren(true) > 0)
+				cell->RemoveChild(cell->GetChild(0));
+		}
+	}
+
+	dirty_cells = false;
+}
+
 // Instantiates the children that haven't been fully loaded yet.
 void ElementDataGridRow::LoadChildren(float time_slice)
 {
@@ -35,6 +35,7 @@
 #include "../../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../../Include/RmlUi/Core/URL.h"
 #include "../TextureDatabase.h"
+#include "../TextureLoader.h"
 
 namespace Rml {
 
@@ -57,6 +58,9 @@ bool ElementImage::GetIntrinsicDimensions(Vector2f& _dimensions, float& _ratio)
 	if (texture_dirty)
 		LoadTexture();
 
+	// Let us know if the texture is loaded in the background.
+	TextureLoader::RequesterScope texture_requester(this);
+
 	// Calculate the x dimension.
 	if (HasAttribute("width"))
 		dimensions.x = GetAttribute<float>("width", -1);
@@ -90,7 +94,8 @@ void ElementImage::OnRender()
 	if (geometry_dirty)
 		GenerateGeometry();
 
-	// Render the geometry beginning at this element's content region.
+	// Render the geometry beginning at this element's content region. Opacity is applied here so that it does not regenerate the geometry.
+	geometry.SetOpacity(GetComputedValues().opacity());
 	geometry.Render(GetAbsoluteOffset(BoxArea::Content).Round());
 }
 
@@ -137,8 +142,7 @@ void ElementImage::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
     Element::OnPropertyChange(changed_properties);
 
-    if (changed_properties.Contains(PropertyId::ImageColor) ||
-        changed_properties.Contains(PropertyId::Opacity)) {
+    if (changed_properties.Contains(PropertyId::ImageColor)) {
         GenerateGeometry();
     }
 }
@@ -173,6 +177,15 @@ void ElementImage::OnStyleSheetChange()
 	}
 }
 
+void ElementImage::OnTextureLoad()
+{
+	Element::OnTextureLoad();
+
+	geometry_dirty = true;
+	if (rect_source == RectSource::None && (!HasAttribute("width") || !HasAttribute("height")))
+		DirtyLayout();
+}
+
 void ElementImage::GenerateGeometry()
 {
 	// Release the old geometry before specifying the new vertices.
@@ -198,12 +211,7 @@ void ElementImage::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
-	const ComputedValues& computed = GetComputedValues();
-
-	float opacity = computed.opacity();
-	Colourb quad_colour = computed.image_color();
-    quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
-	
+	const Colourb quad_colour = GetComputedValues().image_color();
 	Vector2f quad_size = GetBox().GetSize(BoxArea::Content).Round();
 
 	GeometryUtilities::GenerateQuad(&vertices[0], &indices[0], Vector2f(0, 0), quad_size, quad_colour, texcoords[0], texcoords[1]);
@@ -88,6 +88,9 @@ protected:
 	/// The sprite may have changed when the style sheet is recompiled.
 	void OnStyleSheetChange() override;
 
+	/// Our intrinsic dimensions and texture coordinates depend on a texture loaded in the background.
+	void OnTextureLoad() override;
+
 	/// Checks for changes to the image's source or dimensions.
 	/// @param[in] changed_attributes A list of attributes changed on the element.
 	void OnAttributeChange(const ElementAttributes& changed_attributes) override;
@@ -88,11 +88,12 @@ bool ElementProgress::GetIntrinsicDimensions(Vector2f& dimensions, float& /*rati
 
 void ElementProgress::OnRender()
 {
-	// Some properties may change geometry without dirtying the layout, eg. opacity.
+	// Some properties may change geometry without dirtying the layout, eg. image color.
 	if (geometry_dirty)
 		GenerateGeometry();
 
-	// Render the geometry at the fill element's content region.
+	// Render the geometry at the fill element's content region. Opacity is applied here so that it does not regenerate the geometry.
+	geometry.SetOpacity(GetComputedValues().opacity());
 	geometry.Render(fill->GetAbsoluteOffset());
 }
 
@@ -145,8 +146,7 @@ void ElementProgress::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
     Element::OnPropertyChange(changed_properties);
 
-    if (changed_properties.Contains(PropertyId::ImageColor) ||
-        changed_properties.Contains(PropertyId::Opacity)) {
+    if (changed_properties.Contains(PropertyId::ImageColor)) {
 		geometry_dirty = true;
     }
 
@@ -155,6 +155,12 @@ void ElementProgress::OnPropertyChange(const PropertyIdSet& changed_properties)
 	}
 }
 
+void ElementProgress::OnTextureLoad()
+{
+	Element::OnTextureLoad();
+	geometry_dirty = true;
+}
+
 void ElementProgress::OnResize()
 {
 	const Vector2f element_size = GetBox().GetSize();
@@ -249,13 +255,7 @@ void ElementProgress::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
-	Colourb quad_colour;
-	{
-		const ComputedValues& computed = GetComputedValues();
-		const float opacity = computed.opacity();
-		quad_colour = computed.image_color();
-		quad_colour.alpha = (byte)(opacity * (float)quad_colour.alpha);
-	}
+	const Colourb quad_colour = GetComputedValues().image_color();
 
 
 	switch (direction) 
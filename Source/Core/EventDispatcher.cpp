@@ -47,6 +47,18 @@ struct CompareIdPhase {
 	bool operator()(EventListenerEntry a, EventListenerEntry b) const { return std::tie(a.id, a.in_capture_phase) < std::tie(b.id, b.in_capture_phase); }
 };
 
+// Incremented whenever listeners are attached or detached, or the element hierarchy changes. Invalidates the ancestry
+// listener summaries of all dispatchers. Starts above the initial generation of new dispatchers, and is wide enough to never wrap
+// around to it, or to the generation of any other out-of-date summary.
+static uint64_t listener_summary_generation = 1;
+
+// Each event id is mapped to a single bit of the listener summaries, any ids which do not fit share the last bit.
+static uint64_t GetListenerBit(EventId id)
+{
+	const uint32_t index = std::min((uint32_t)id, 63u);
+	return uint64_t(1) << index;
+}
+
 
 
 EventDispatcher::EventDispatcher(Element* _element)
@@ -71,6 +83,8 @@ void EventDispatcher::AttachEvent(const EventId id, EventListener* listener, con
 	if (matching_entry_it == range.second)
 	{
 		listeners.emplace(range.second, entry);
+		listener_bits |= GetListenerBit(id);
+		DirtyListenerSummaries();
 		listener->OnAttach(element);
 	}
 }
@@ -82,6 +96,7 @@ void EventDispatcher::DetachEvent(const EventId id, EventListener* listener, con
 	if (listenerIt != listeners.cend())
 	{
 		listeners.erase(listenerIt);
+		UpdateListenerBits();
 		listener->OnDetach(element);
 	}
 }
@@ -93,6 +108,7 @@ void EventDispatcher::DetachAllEvents()
 		event.listener->OnDetach(element);
 
 	listeners.clear();
+	UpdateListenerBits();
 
 	for (int i = 0; i < element->GetNumChildren(true); ++i)
 		element->GetChild(i)->GetEventDispatcher()->DetachAllEvents();
@@ -126,23 +142,72 @@ struct CollectedListener {
 	}
 };
 
+/*
+	DispatchBuffers
+
+	The collected listeners and default action elements are reused between dispatches to avoid allocations in the common
+	case. Events may be dispatched from within listeners, thus one set of buffers is kept for each level of nested dispatches.
+*/
+struct DispatchBuffers {
+	Vector<CollectedListener> listeners;
+	Vector<ObserverPtr<Element>> default_action_elements;
+};
+
+static Vector<UniquePtr<DispatchBuffers>> dispatch_buffers;
+static size_t dispatch_depth = 0;
+
+class DispatchBuffersScope {
+public:
+	DispatchBuffersScope()
+	{
+		if (dispatch_depth >= dispatch_buffers.size())
+			dispatch_buffers.push_back(MakeUnique<DispatchBuffers>());
+		buffers = dispatch_buffers[dispatch_depth].get();
+		dispatch_depth += 1;
+	}
+	~DispatchBuffersScope()
+	{
+		// Release the observer pointers while keeping the capacity for the next dispatch.
+		buffers->listeners.clear();
+		buffers->default_action_elements.clear();
+		dispatch_depth -= 1;
+	}
+
+	DispatchBuffers& Get() { return *buffers; }
+
+private:
+	DispatchBuffers* buffers;
+};
+
 
 bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, const String& type, const Dictionary& parameters, const bool interruptible, const bool bubbles, const DefaultActionPhase default_action_phase)
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
-	Vector<CollectedListener> listeners;
-	Vector<ObserverPtr<Element>> default_action_elements;
+	// Return early when nothing can receive the event, which is common for frequent events such as mousemove.
+	const bool has_listeners = target_element->GetEventDispatcher()->MayHaveListenersInAncestry(id);
+	if (!has_listeners && default_action_phase == DefaultActionPhase::None)
+		return true;
+
+	DispatchBuffersScope buffers_scope;
+	Vector<CollectedListener>& listeners = buffers_scope.Get().listeners;
+	Vector<ObserverPtr<Element>>& default_action_elements = buffers_scope.Get().default_action_elements;
 
 	const EventPhase phases_to_execute = EventPhase((int)EventPhase::Capture | (int)EventPhase::Target | (bubbles ? (int)EventPhase::Bubble : 0));
-	
+
+	// Without any listeners, the ancestors only need to be visited when they can execute default actions.
+	const bool walk_ancestors = (has_listeners || ((int)default_action_phase & (int)EventPhase::Bubble));
+
 	// Walk the DOM tree from target to root, collecting all possible listeners and elements with default actions in the process.
 	int dom_distance_from_target = 0;
 	Element* walk_element = target_element;
 	while (walk_element)
 	{
-		EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
-		dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		if (has_listeners)
+		{
+			EventDispatcher* dispatcher = walk_element->GetEventDispatcher();
+			dispatcher->CollectListeners(dom_distance_from_target, id, phases_to_execute, listeners);
+		}
 
 		if(dom_distance_from_target == 0)
 		{
@@ -154,6 +219,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 			default_action_elements.push_back(walk_element->GetObserverPtr());
 		}
 
+		if (!walk_ancestors)
+			break;
+
 		walk_element = walk_element->GetParentNode();
 		dom_distance_from_target += 1;
 	}
@@ -217,8 +285,43 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 }
 
 
+void EventDispatcher::DirtyListenerSummaries()
+{
+	listener_summary_generation += 1;
+}
+
+bool EventDispatcher::MayHaveListenersInAncestry(const EventId id)
+{
+	return (GetAncestryListenerBits() & GetListenerBit(id)) != 0;
+}
+
+uint64_t EventDispatcher::GetAncestryListenerBits()
+{
+	if (ancestry_generation != listener_summary_generation)
+	{
+		ancestry_listener_bits = listener_bits;
+		if (Element* parent = element->GetParentNode())
+			ancestry_listener_bits |= parent->GetEventDispatcher()->GetAncestryListenerBits();
+		ancestry_generation = listener_summary_generation;
+	}
+
+	return ancestry_listener_bits;
+}
+
+void EventDispatcher::UpdateListenerBits()
+{
+	listener_bits = 0;
+	for (const EventListenerEntry& entry : listeners)
+		listener_bits |= GetListenerBit(entry.id);
+
+	DirtyListenerSummaries();
+}
+
 void EventDispatcher::CollectListeners(int dom_distance_from_target, const EventId event_id, const EventPhase event_executes_in_phases, Vector<CollectedListener>& collect_listeners)
 {
+	if (!(listener_bits & GetListenerBit(event_id)))
+		return;
+
 	// Find all the entries with a matching id, given that listeners are sorted by id first.
 	Listeners::iterator begin, end;
 	std::tie(begin, end) = std::equal_range(listeners.begin(), listeners.end(), EventListenerEntry(event_id, nullptr, false), CompareId());
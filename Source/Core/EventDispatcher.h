@@ -90,6 +90,9 @@ public:
 	/// @return True if the event was not consumed (ie, was prevented from propagating by an element), false if it was.
 	static bool DispatchEvent(Element* target_element, EventId id, const String& type, const Dictionary& parameters, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase);
 
+	/// Invalidates the cached listener summaries of all dispatchers, must be called whenever the element hierarchy changes.
+	static void DirtyListenerSummaries();
+
 	/// Returns event types with number of listeners for debugging.
 	/// @return Summary of attached listeners.
 	String ToString() const;
@@ -102,6 +105,20 @@ private:
 	typedef Vector< EventListenerEntry > Listeners;
 	Listeners listeners;
 
+	// Summary of the listeners attached to this dispatcher, with one bit per event id as given by GetListenerBit().
+	uint64_t listener_bits = 0;
+
+	// Summary of the listeners attached to this dispatcher and all its ancestors. Only valid while 'ancestry_generation'
+	// matches the global generation, which is incremented whenever listeners are attached or the hierarchy changes.
+	uint64_t ancestry_listener_bits = 0;
+	uint64_t ancestry_generation = 0;
+
+	// Returns true if this element or any of its ancestors may have listeners attached to the given event.
+	bool MayHaveListenersInAncestry(EventId id);
+	uint64_t GetAncestryListenerBits();
+
+	void UpdateListenerBits();
+
 	// Collect all the listeners from this dispatcher that are allowed to execute given the input arguments.
 	void CollectListeners(int dom_distance_from_target, EventId event_id, EventPhase phases_to_execute, Vector<CollectedListener>& collect_listeners);
 };
@@ -28,9 +28,12 @@
 
 #include "EventInstancerDefault.h"
 #include "../../Include/RmlUi/Core/Event.h"
+#include "Pool.h"
 
 namespace Rml {
 
+static Pool< Event > pool_event(50, true);
+
 EventInstancerDefault::EventInstancerDefault()
 {
 }
@@ -41,13 +44,13 @@ EventInstancerDefault::~EventInstancerDefault()
 
 EventPtr EventInstancerDefault::InstanceEvent(Element* target, EventId id, const String& type, const Dictionary& parameters, bool interruptible)
 {
-	return EventPtr(new Event(target, id, type, parameters, interruptible));
+	return EventPtr(pool_event.AllocateAndConstruct(target, id, type, parameters, interruptible));
 }
 
 // Releases an event instanced by this instancer.
 void EventInstancerDefault::ReleaseEvent(Event* event)
 {
-	delete event;
+	pool_event.DestroyAndDeallocate(event);
 }
 
 void EventInstancerDefault::Release()
@@ -110,7 +110,18 @@ float FontFaceHandleDefault::GetUnderline(float& thickness) const
 // Returns the width a string will take up if rendered with this handle.
 int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_character)
 {
+	// The prior character only affects the width through kerning.
+	if (!has_kerning)
+		prior_character = Character::Null;
+
 	int width = 0;
+	if (string_width_cache.Find(string, prior_character, width))
+		return width;
+
+	// Widths using the replacement character may change when fallback font faces are added, thus they are not cached.
+	bool cacheable = true;
+
+	Character previous_character = prior_character;
 	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 	{
 		Character character = *it_string;
@@ -119,15 +130,21 @@ int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_
 		if (!glyph)
 			continue;
 
+		if (character == Character::Replacement && *it_string != Character::Replacement)
+			cacheable = false;
+
 		// Adjust the cursor for the kerning between this character and the previous one.
-		width += GetKerning(prior_character, character);
+		width += GetKerning(previous_character, character);
 
 		// Adjust the cursor for this character's advance.
 		width += glyph->advance;
 
-		prior_character = character;
+		previous_character = character;
 	}
 
+	if (cacheable)
+		string_width_cache.Insert(string, prior_character, width);
+
 	return width;
 }
 
@@ -196,14 +213,8 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 }
 
 // Generates the texture data for a layer (for the texture database).
-bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id, int handle_version) const
+bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id) const
 {
-	if (handle_version != version)
-	{
-		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
-		return false;
-	}
-
 	auto it = std::find_if(layers.begin(), layers.end(), [font_effect](const EffectLayerPair& pair) { return pair.font_effect == font_effect; });
 
 	if (it == layers.end())
@@ -225,6 +236,13 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 	RMLUI_ASSERT(layer_configuration_index >= 0);
 	RMLUI_ASSERT(layer_configuration_index < (int) layer_configurations.size());
 
+	// Make sure all the glyphs of the string are added to the layers before generating its geometry.
+	for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
+	{
+		Character character = *it_string;
+		GetOrAppendGlyph(character);
+	}
+
 	UpdateLayersOnDirty();
 
 	// Fetch the requested configuration and generate the geometry for each one.
@@ -302,26 +320,26 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 
 bool FontFaceHandleDefault::UpdateLayersOnDirty()
 {
-	bool result = false;
+	if (new_glyphs.empty() || !base_layer)
+		return false;
 
-	// If we are dirty, regenerate all the layers and increment the version
-	if(is_layers_dirty && base_layer)
+	// Add the new glyphs to all the layers. Only if any existing glyphs moved within their textures, increment the version so
+	// that previously generated string geometry is regenerated.
+	// Note: The layers need to be updated in the order in which they were created, otherwise we may end up cloning a layer
+	// which has not yet been updated. This means trouble!
+	bool texcoords_moved = false;
+	for (auto& pair : layers)
 	{
-		is_layers_dirty = false;
-		++version;
+		if (pair.layer->AddGlyphs(this, new_glyphs))
+			texcoords_moved = true;
+	}
 
-		// Regenerate all the layers.
-		// Note: The layer regeneration needs to happen in the order in which the layers were created,
-		// otherwise we may end up cloning a layer which has not yet been regenerated. This means trouble!
-		for (auto& pair : layers)
-		{
-			GenerateLayer(pair.layer.get());
-		}
+	new_glyphs.clear();
 
-		result = true;
-	}
+	if (texcoords_moved)
+		++version;
 
-	return result;
+	return true;
 }
 
 int FontFaceHandleDefault::GetVersion() const 
@@ -405,7 +423,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 				return nullptr;
 			}
 
-			is_layers_dirty = true;
+			new_glyphs.push_back(character);
 		}
 		else if (look_in_fallback_fonts)
 		{
@@ -423,7 +441,7 @@ const FontGlyph* FontFaceHandleDefault::GetOrAppendGlyph(Character& character, b
 					auto pair = glyphs.emplace(character, glyph->WeakCopy());
 					it_glyph = pair.first;
 					if(pair.second)
-						is_layers_dirty = true;
+						new_glyphs.push_back(character);
 					break;
 				}
 			}
@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/FontEffect.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
+#include "../../../Include/RmlUi/Core/StringWidthCache.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "FontTypes.h"
 
@@ -84,8 +85,7 @@ public:
 	/// @param[out] texture_dimensions The dimensions of the texture.
 	/// @param[in] font_effect The font effect used for the layer.
 	/// @param[in] texture_id The index of the texture within the layer to generate.
-	/// @param[in] handle_version The version of the handle data. Function returns false if out of date.
-	bool GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id, int handle_version) const;
+	bool GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id) const;
 
 	/// Generates the geometry required to render a single line of text.
 	/// @param[out] geometry An array of geometries to generate the geometry into.
@@ -97,7 +97,7 @@ public:
 	/// @return The width, in pixels, of the string geometry.
 	int GenerateString(GeometryList& geometry, const String& string, Vector2f position, Colourb colour, float opacity, int layer_configuration = 0);
 
-	/// Version is changed whenever the layers are dirtied, requiring regeneration of string geometry.
+	/// Version is changed whenever glyphs move within the layer textures, requiring regeneration of string geometry.
 	int GetVersion() const;
 
 private:
@@ -116,7 +116,7 @@ private:
 	/// @return The font glyph for the returned code point.
 	const FontGlyph* GetOrAppendGlyph(Character& character, bool look_in_fallback_fonts = true);
 
-	// Regenerate layers if dirty, such as after adding new glyphs.
+	// Add any newly appended glyphs to the layers.
 	bool UpdateLayersOnDirty();
 
 	// Create a new layer from the given font effect if it does not already exist.
@@ -149,9 +149,14 @@ private:
 	KerningPairs kerning_pair_cache;
 
 	bool has_kerning = false;
-	bool is_layers_dirty = false;
 	int version = 0;
 
+	// Widths of recently measured strings, such as the words of text being formatted.
+	StringWidthCache string_width_cache;
+
+	// Glyphs appended since the layers were last updated.
+	Vector<Character> new_glyphs;
+
 	// All configurations currently in use on this handle. New configurations will be generated as required.
 	LayerConfigurationList layer_configurations;
 
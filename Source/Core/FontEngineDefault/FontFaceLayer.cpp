@@ -34,6 +34,20 @@
 
 namespace Rml {
 
+static constexpr int max_texture_dimensions = 1024;
+
+// Allocates RGBA texture data of the given dimensions, initialized to transparent white.
+static UniquePtr<byte[]> AllocateTextureData(Vector2i dimensions)
+{
+	const int num_pixels = dimensions.x * dimensions.y;
+	UniquePtr<byte[]> texture_data(new byte[num_pixels * 4]);
+
+	for (int i = 0; i < num_pixels; i++)
+		((unsigned int*)(texture_data.get()))[i] = 0x00ffffff;
+
+	return texture_data;
+}
+
 FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colour(255, 255, 255)
 {
 	effect = _effect;
@@ -44,208 +58,202 @@ FontFaceLayer::FontFaceLayer(const SharedPtr<const FontEffect>& _effect) : colou
 FontFaceLayer::~FontFaceLayer()
 {}
 
-bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone, bool clone_glyph_origins)
+bool FontFaceLayer::Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* _clone, bool _clone_glyph_origins)
 {
 	// Clear the old layout if it exists.
-	{
-		// @performance: We could be much smarter about this, e.g. such as adding new glyphs to the existing texture layout and textures.
-		// Right now we re-generate the whole thing, including textures.
-		texture_layout = TextureLayout{};
-		character_boxes.clear();
-		textures.clear();
-	}
+	texture_layout = TextureLayout(max_texture_dimensions);
+	character_boxes.clear();
+	textures.clear();
+	++texcoords_version;
+
+	clone = _clone;
+	clone_glyph_origins = _clone_glyph_origins;
 
 	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
 	// Generate the new layout.
 	if (clone)
 	{
-		// Clone the geometry and textures from the clone layer.
-		character_boxes = clone->character_boxes;
+		// Clone the geometry from the clone layer, its textures are used directly.
+		character_boxes.reserve(glyphs.size());
+		for (auto& pair : glyphs)
+			CloneCharacterBox(pair.first, pair.second);
 
-		// Copy the cloned layer's textures.
-		for (size_t i = 0; i < clone->textures.size(); ++i)
-			textures.push_back(clone->textures[i]);
+		clone_texcoords_version = clone->texcoords_version;
+	}
+	else
+	{
+		Vector<Character> characters;
+		characters.reserve(glyphs.size());
+		for (auto& pair : glyphs)
+			characters.push_back(pair.first);
 
-		// Request the effect (if we have one) and adjust the origins as appropriate.
-		if (effect && !clone_glyph_origins)
-		{
-			for (auto& pair : glyphs)
-			{
-				Character character = pair.first;
-				const FontGlyph& glyph = pair.second;
+		AddGlyphs(handle, characters);
+	}
 
-				auto it = character_boxes.find(character);
-				if (it == character_boxes.end())
-				{
-					// This can happen if the layers have been dirtied in FontHandleDefault. We will
-					// probably be regenerated soon, just skip the character for now.
-					continue;
-				}
+	return true;
+}
 
-				TextureBox& box = it->second;
+bool FontFaceLayer::AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters)
+{
+	const FontGlyphMap& glyphs = handle->GetGlyphs();
 
-				Vector2i glyph_origin = Vector2i(box.origin);
-				Vector2i glyph_dimensions = Vector2i(box.dimensions);
+	if (clone)
+	{
+		// If the cloned layer moved its existing glyphs, copy all the boxes again.
+		if (clone_texcoords_version != clone->texcoords_version)
+		{
+			Generate(handle, clone, clone_glyph_origins);
+			return true;
+		}
 
-				if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					box.origin = Vector2f(glyph_origin);
-				else
-					box.texture_index = -1;
-			}
+		for (Character character : characters)
+		{
+			auto it = glyphs.find(character);
+			if (it != glyphs.end() && character_boxes.find(character) == character_boxes.end())
+				CloneCharacterBox(character, it->second);
 		}
+
+		return false;
 	}
-	else
+
+	// Initialise the texture layout rectangles for the new glyphs.
+	Vector<TextureLayoutRectangle> rectangles;
+	Vector<Character> rectangle_characters;
+	rectangles.reserve(characters.size());
+	rectangle_characters.reserve(characters.size());
+
+	for (Character character : characters)
 	{
-		// Initialise the texture layout for the glyphs.
-		character_boxes.reserve(glyphs.size());
-		for (auto& pair : glyphs)
+		auto it = glyphs.find(character);
+		if (it == glyphs.end() || character_boxes.find(character) != character_boxes.end())
+			continue;
+
+		const FontGlyph& glyph = it->second;
+
+		Vector2i glyph_origin(0, 0);
+		Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+
+		// Adjust glyph origin / dimensions for the font effect.
+		if (effect)
 		{
-			Character character = pair.first;
-			const FontGlyph& glyph = pair.second;
+			if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+				continue;
+		}
 
-			Vector2i glyph_origin(0, 0);
-			Vector2i glyph_dimensions = glyph.bitmap_dimensions;
+		TextureBox box;
+		box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
+		box.dimensions = Vector2f(glyph_dimensions);
 
-			// Adjust glyph origin / dimensions for the font effect.
-			if (effect)
-			{
-				if (!effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
-					continue;
-			}
+		RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
 
-			TextureBox box;
-			box.origin = Vector2f(float(glyph_origin.x + glyph.bearing.x), float(glyph_origin.y - glyph.bearing.y));
-			box.dimensions = Vector2f(glyph_dimensions);
-			
-			RMLUI_ASSERT(box.dimensions.x >= 0 && box.dimensions.y >= 0);
+		character_boxes[character] = box;
 
-			character_boxes[character] = box;
+		TextureLayoutRectangle rectangle;
+		rectangle.dimensions = glyph_dimensions;
+		rectangles.push_back(rectangle);
+		rectangle_characters.push_back(character);
+	}
 
-			// Add the character's dimensions into the texture layout engine.
-			texture_layout.AddRectangle((int)character, glyph_dimensions);
-		}
+	if (rectangles.empty())
+		return false;
 
-		constexpr int max_texture_dimensions = 1024;
+	const int num_textures_before = texture_layout.GetNumTextures();
+	Vector<Vector2i> texture_dimensions_before(num_textures_before);
+	for (int i = 0; i < num_textures_before; i++)
+		texture_dimensions_before[i] = texture_layout.GetTextureDimensions(i);
 
-		// Generate the texture layout; this will position the glyph rectangles efficiently and
-		// allocate the texture data ready for writing.
-		if (!texture_layout.GenerateLayout(max_texture_dimensions))
-			return false;
+	// Position the new glyph rectangles in the layout, existing rectangles remain in place.
+	if (!texture_layout.AddRectangles(rectangles))
+		Log::Message(Log::LT_WARNING, "Font glyphs exceed the maximum font texture dimensions, some glyphs will not be rendered.");
 
+	for (size_t i = 0; i < rectangles.size(); i++)
+	{
+		const TextureLayoutRectangle& rectangle = rectangles[i];
+		TextureBox& box = character_boxes[rectangle_characters[i]];
 
-		// Iterate over each rectangle in the layout, copying the glyph data into the rectangle as
-		// appropriate and generating geometry.
-		for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-		{
-			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-			const TextureLayoutTexture& texture = texture_layout.GetTexture(rectangle.GetTextureIndex());
-			Character character = (Character)rectangle.GetId();
-			RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-			TextureBox& box = character_boxes[character];
-
-			// Set the character's texture index.
-			box.texture_index = rectangle.GetTextureIndex();
-
-			// Generate the character's texture coordinates.
-			box.texcoords[0].x = float(rectangle.GetPosition().x) / float(texture.GetDimensions().x);
-			box.texcoords[0].y = float(rectangle.GetPosition().y) / float(texture.GetDimensions().y);
-			box.texcoords[1].x = float(rectangle.GetPosition().x + rectangle.GetDimensions().x) / float(texture.GetDimensions().x);
-			box.texcoords[1].y = float(rectangle.GetPosition().y + rectangle.GetDimensions().y) / float(texture.GetDimensions().y);
-		}
+		box.texture_index = rectangle.texture_index;
+		box.texture_position = rectangle.position;
+		if (box.texture_index >= 0)
+			UpdateTexcoords(box);
+	}
+
+	// Textures which have been enlarged must be generated again, and their existing glyphs have new texture coordinates.
+	bool texcoords_moved = false;
+	Vector<bool> texture_resized(num_textures_before, false);
 
-		const FontEffect* effect_ptr = effect.get();
-		const int handle_version = handle->GetVersion();
+	for (int i = 0; i < num_textures_before; i++)
+	{
+		if (texture_layout.GetTextureDimensions(i) == texture_dimensions_before[i])
+			continue;
 
-		// Generate the textures.
-		for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+		for (auto& pair : character_boxes)
 		{
-			const int texture_id = i;
-
-			TextureCallback texture_callback = [handle, effect_ptr, texture_id, handle_version](RenderInterface* render_interface,
-												   const String& /*name*/, TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
-				UniquePtr<const byte[]> data;
-				if (!handle->GenerateLayerTexture(data, out_dimensions, effect_ptr, texture_id, handle_version) || !data)
-					return false;
-				if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
-					return false;
-				return true;
-			};
-
-			Texture texture;
-			texture.Set("font-face-layer", texture_callback);
-			textures.push_back(texture);
+			if (pair.second.texture_index == i)
+				UpdateTexcoords(pair.second);
 		}
+
+		SetTexture(handle, i);
+		texture_resized[i] = true;
+		texcoords_moved = true;
 	}
 
-	return true;
+	for (int i = num_textures_before; i < texture_layout.GetNumTextures(); i++)
+	{
+		textures.push_back(MakeUnique<Texture>());
+		SetTexture(handle, i);
+	}
+
+	// Upload the new glyphs placed within the free space of unchanged textures. New and resized textures, as well as textures which have
+	// not yet been used, are generated in full on first use.
+	for (size_t i = 0; i < rectangles.size(); i++)
+	{
+		const TextureLayoutRectangle& rectangle = rectangles[i];
+		if (rectangle.texture_index < 0 || rectangle.texture_index >= num_textures_before || texture_resized[rectangle.texture_index] ||
+			!textures[rectangle.texture_index]->IsLoaded() || rectangle.dimensions.x <= 0 || rectangle.dimensions.y <= 0)
+			continue;
+
+		const Character character = rectangle_characters[i];
+		UniquePtr<byte[]> region_data = AllocateTextureData(rectangle.dimensions);
+		CopyGlyph(region_data.get(), rectangle.dimensions.x * 4, character_boxes[character], glyphs.find(character)->second);
+
+		textures[rectangle.texture_index]->UpdateRegion(region_data.get(), rectangle.position, rectangle.dimensions);
+	}
+
+	if (texcoords_moved)
+		++texcoords_version;
+
+	return texcoords_moved;
 }
 
 // Generates the texture data for a layer (for the texture database).
 bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, int texture_id, const FontGlyphMap& glyphs)
 {
 	if (texture_id < 0 ||
-		texture_id > texture_layout.GetNumTextures())
+		texture_id >= texture_layout.GetNumTextures())
 		return false;
 
 	// Generate the texture data.
-	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
-	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
+	texture_dimensions = texture_layout.GetTextureDimensions(texture_id);
+	UniquePtr<byte[]> data = AllocateTextureData(texture_dimensions);
+	const int stride = texture_dimensions.x * 4;
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
+	for (auto& pair : character_boxes)
 	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
-
-		TextureBox& box = character_boxes[character];
-
+		const TextureBox& box = pair.second;
 		if (box.texture_index != texture_id)
 			continue;
 
-		auto it = glyphs.find((Character)rectangle.GetId());
+		auto it = glyphs.find(pair.first);
 		if (it == glyphs.end())
 			continue;
 
-		const FontGlyph& glyph = it->second;
-
-		if (effect == nullptr)
-		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
-				const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
-
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
-				{
-					switch (glyph.color_format)
-					{
-					case ColorFormat::A8:
-					{
-						for (int k = 0; k < num_bytes_per_line; ++k)
-							destination[k * 4 + 3] = source[k];
-					}
-					break;
-					case ColorFormat::RGBA8:
-					{
-						memcpy(destination, source, num_bytes_per_line);
-					}
-					break;
-					}
-
-					destination += rectangle.GetTextureStride();
-					source += num_bytes_per_line;
-				}
-			}
-		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(box.dimensions), rectangle.GetTextureStride(), glyph);
-		}
+		byte* destination = data.get() + box.texture_position.y * stride + box.texture_position.x * 4;
+		CopyGlyph(destination, stride, box, it->second);
 	}
 
+	texture_data = std::move(data);
+
 	return true;
 }
 
@@ -256,17 +264,23 @@ const FontEffect* FontFaceLayer::GetFontEffect() const
 }
 
 // Returns on the layer's textures.
-const Texture* FontFaceLayer::GetTexture(int index)
+const Texture* FontFaceLayer::GetTexture(int index) const
 {
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return &(textures[index]);
+	if (clone)
+		return clone->GetTexture(index);
+
+	return textures[index].get();
 }
 
 // Returns the number of textures employed by this layer.
 int FontFaceLayer::GetNumTextures() const
 {
+	if (clone)
+		return clone->GetNumTextures();
+
 	return (int)textures.size();
 }
 
@@ -276,4 +290,91 @@ Colourb FontFaceLayer::GetColour() const
 	return colour;
 }
 
+void FontFaceLayer::CloneCharacterBox(Character character, const FontGlyph& glyph)
+{
+	auto it = clone->character_boxes.find(character);
+	if (it == clone->character_boxes.end())
+		return;
+
+	TextureBox box = it->second;
+
+	// Request the effect (if we have one) and adjust the origins as appropriate.
+	if (effect && !clone_glyph_origins)
+	{
+		Vector2i glyph_origin = Vector2i(box.origin);
+		Vector2i glyph_dimensions = Vector2i(box.dimensions);
+
+		if (effect->GetGlyphMetrics(glyph_origin, glyph_dimensions, glyph))
+			box.origin = Vector2f(glyph_origin);
+		else
+			box.texture_index = -1;
+	}
+
+	character_boxes[character] = box;
+}
+
+void FontFaceLayer::UpdateTexcoords(TextureBox& box) const
+{
+	const Vector2f texture_dimensions = Vector2f(texture_layout.GetTextureDimensions(box.texture_index));
+	const Vector2f position = Vector2f(box.texture_position);
+
+	box.texcoords[0] = position / texture_dimensions;
+	box.texcoords[1] = (position + box.dimensions) / texture_dimensions;
+}
+
+void FontFaceLayer::SetTexture(const FontFaceHandleDefault* handle, const int texture_id)
+{
+	const FontEffect* effect_ptr = effect.get();
+
+	TextureCallback texture_callback = [handle, effect_ptr, texture_id](RenderInterface* render_interface, const String& /*name*/,
+										   TextureHandle& out_texture_handle, Vector2i& out_dimensions) -> bool {
+		UniquePtr<const byte[]> data;
+		if (!handle->GenerateLayerTexture(data, out_dimensions, effect_ptr, texture_id) || !data)
+			return false;
+		if (!render_interface->GenerateTexture(out_texture_handle, data.get(), out_dimensions))
+			return false;
+		return true;
+	};
+
+	textures[texture_id]->Set("font-face-layer", texture_callback);
+}
+
+void FontFaceLayer::CopyGlyph(byte* destination, const int stride, const TextureBox& box, const FontGlyph& glyph) const
+{
+	if (effect == nullptr)
+	{
+		// Copy the glyph's bitmap data into its allocated texture.
+		if (glyph.bitmap_data)
+		{
+			const byte* source = glyph.bitmap_data;
+			const int num_bytes_per_line = glyph.bitmap_dimensions.x * (glyph.color_format == ColorFormat::RGBA8 ? 4 : 1);
+
+			for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			{
+				switch (glyph.color_format)
+				{
+				case ColorFormat::A8:
+				{
+					for (int k = 0; k < num_bytes_per_line; ++k)
+						destination[k * 4 + 3] = source[k];
+				}
+				break;
+				case ColorFormat::RGBA8:
+				{
+					memcpy(destination, source, num_bytes_per_line);
+				}
+				break;
+				}
+
+				destination += stride;
+				source += num_bytes_per_line;
+			}
+		}
+	}
+	else
+	{
+		effect->GenerateGlyphTexture(destination, Vector2i(box.dimensions), stride, glyph);
+	}
+}
+
 } // namespace Rml
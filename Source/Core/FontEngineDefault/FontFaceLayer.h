@@ -55,11 +55,19 @@ public:
 
 	/// Generates or re-generates the character and texture data for the layer.
 	/// @param[in] handle The handle generating this layer.
-	/// @param[in] effect The effect to initialise the layer with.
 	/// @param[in] clone The layer to optionally clone geometry and texture data from.
+	/// @param[in] clone_glyph_origins True to use the glyph origins of the cloned layer, otherwise they are adjusted by this layer's effect.
 	/// @return True if the layer was generated successfully, false if not.
 	bool Generate(const FontFaceHandleDefault* handle, const FontFaceLayer* clone = nullptr, bool clone_glyph_origins = false);
 
+	/// Adds glyphs recently appended to the handle to this layer. The glyphs are placed within the free space of the existing textures
+	/// where possible, in which case only their regions of the textures are updated.
+	/// @note Cloned layers must be updated after the layer they are cloned from.
+	/// @param[in] handle The handle generating this layer.
+	/// @param[in] characters The characters of the new glyphs.
+	/// @return True if the texture coordinates of existing glyphs changed, invalidating any geometry previously generated by the layer.
+	bool AddGlyphs(const FontFaceHandleDefault* handle, const Vector<Character>& characters);
+
 	/// Generates the texture data for a layer (for the texture database).
 	/// @param[out] texture_data The pointer to be set to the generated texture data.
 	/// @param[out] texture_dimensions The dimensions of the texture.
@@ -105,7 +113,7 @@ public:
 	const FontEffect* GetFontEffect() const;
 
 	/// Returns one of the layer's textures.
-	const Texture* GetTexture(int index);
+	const Texture* GetTexture(int index) const;
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
 
@@ -113,8 +121,6 @@ public:
 	Colourb GetColour() const;
 
 private:
-
-
 	struct TextureBox
 	{
 		TextureBox() : texture_index(-1) { }
@@ -128,16 +134,36 @@ private:
 
 		// The texture this character renders from.
 		int texture_index;
+		// The position, in pixels, of the character within its texture.
+		Vector2i texture_position;
 	};
 
+	// Adds the box of a character by copying it from the cloned layer.
+	void CloneCharacterBox(Character character, const FontGlyph& glyph);
+	// Sets the texture coordinates of a box from its position within its texture.
+	void UpdateTexcoords(TextureBox& box) const;
+	// Sets the texture at the given index to be generated from the layer on first use.
+	void SetTexture(const FontFaceHandleDefault* handle, int texture_id);
+	// Writes the glyph's image into the given texture data, located at the top-left corner of the character's box.
+	void CopyGlyph(byte* destination, int stride, const TextureBox& box, const FontGlyph& glyph) const;
+
 	using CharacterMap = UnorderedMap<Character, TextureBox>;
-	using TextureList = Vector<Texture>;
+	using TextureList = Vector<UniquePtr<Texture>>;
 
 	SharedPtr<const FontEffect> effect;
 
+	// The layer to clone geometry and textures from, if any.
+	const FontFaceLayer* clone = nullptr;
+	bool clone_glyph_origins = false;
+
+	// Incremented whenever the texture coordinates of existing boxes change. Cloned layers use this to detect when they are out of date.
+	int texcoords_version = 0;
+	int clone_texcoords_version = 0;
+
 	TextureLayout texture_layout;
 
 	CharacterMap character_boxes;
+	// Stored by pointer, since the textures are referenced by generated geometry and must not move as new textures are added.
 	TextureList textures;
 	Colourb colour;
 };
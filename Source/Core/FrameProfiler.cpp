@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FrameProfiler.h"
+
+namespace Rml {
+
+FrameProfiler* FrameProfiler::active_profiler = nullptr;
+
+FrameProfiler::PhaseScope::PhaseScope(FrameProfiler& profiler, Phase phase) :
+	profiler(profiler), previous_profiler(active_profiler), phase(phase), start_time(std::chrono::steady_clock::now())
+{
+	active_profiler = &profiler;
+}
+
+FrameProfiler::PhaseScope::~PhaseScope()
+{
+	const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+	profiler.durations[(int)phase].fetch_add(int64_t(duration.count()), std::memory_order_relaxed);
+	active_profiler = previous_profiler;
+}
+
+FrameProfiler::FrameProfiler()
+{
+	for (int i = 0; i < (int)Counter::Count; i++)
+	{
+		counters[i].store(0, std::memory_order_relaxed);
+		finished_counters[i].store(0, std::memory_order_relaxed);
+	}
+	for (int i = 0; i < (int)Phase::Count; i++)
+	{
+		durations[i].store(0, std::memory_order_relaxed);
+		finished_durations[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+void FrameProfiler::NextFrame()
+{
+	for (int i = 0; i < (int)Counter::Count; i++)
+		finished_counters[i].store(counters[i].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+	for (int i = 0; i < (int)Phase::Count; i++)
+		finished_durations[i].store(durations[i].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+FrameStatistics FrameProfiler::GetStatistics() const
+{
+	auto counter = [this](Counter id) { return finished_counters[(int)id].load(std::memory_order_relaxed); };
+	auto seconds = [this](Phase id) { return double(finished_durations[(int)id].load(std::memory_order_relaxed)) * 1e-9; };
+
+	FrameStatistics statistics;
+	statistics.data_model_time = seconds(Phase::DataModels);
+	statistics.style_time = seconds(Phase::Style);
+	statistics.layout_time = seconds(Phase::Layout);
+	statistics.render_time = seconds(Phase::Render);
+	statistics.num_elements_updated = counter(Counter::ElementsUpdated);
+	statistics.num_definitions_updated = counter(Counter::DefinitionsUpdated);
+	statistics.num_elements_formatted = counter(Counter::ElementsFormatted);
+	statistics.num_geometry_generated = counter(Counter::GeometryGenerated);
+	statistics.num_draw_calls = counter(Counter::DrawCalls);
+	statistics.num_textures_generated = counter(Counter::TexturesGenerated);
+	return statistics;
+}
+
+} // namespace Rml
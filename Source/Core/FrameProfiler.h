@@ -0,0 +1,92 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMEPROFILER_H
+#define RMLUI_CORE_FRAMEPROFILER_H
+
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Rml {
+
+/**
+    Collects the phase timings and work counters of a context's frames, see Context::GetFrameStatistics().
+
+    The context activates its profiler while it is being updated or rendered, and any work counted in the meantime is attributed to it. The
+    counters are relaxed atomics, thus counting never blocks and stays cheap, and the statistics can safely be read from any thread.
+ */
+
+class FrameProfiler : NonCopyMoveable {
+public:
+	enum class Phase { DataModels, Style, Layout, Render, Count };
+	enum class Counter { ElementsUpdated, DefinitionsUpdated, ElementsFormatted, GeometryGenerated, DrawCalls, TexturesGenerated, Count };
+
+	/// Counts work done on behalf of the context currently being updated or rendered, if any.
+	static void Count(Counter counter)
+	{
+		if (FrameProfiler* profiler = active_profiler)
+			profiler->counters[(int)counter].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// Activates the profiler and adds the time spent during its lifetime to the given phase.
+	class PhaseScope : NonCopyMoveable {
+	public:
+		PhaseScope(FrameProfiler& profiler, Phase phase);
+		~PhaseScope();
+
+	private:
+		FrameProfiler& profiler;
+		FrameProfiler* previous_profiler;
+		Phase phase;
+		std::chrono::steady_clock::time_point start_time;
+	};
+
+	FrameProfiler();
+
+	/// Finishes the current frame, making its statistics available, and starts a new one.
+	void NextFrame();
+
+	/// Returns the statistics of the most recently finished frame.
+	FrameStatistics GetStatistics() const;
+
+private:
+	static FrameProfiler* active_profiler;
+
+	// Counts and phase durations in nanoseconds of the current frame, and the ones of the previous frame.
+	std::atomic<int> counters[(int)Counter::Count];
+	std::atomic<int64_t> durations[(int)Phase::Count];
+	std::atomic<int> finished_counters[(int)Counter::Count];
+	std::atomic<int64_t> finished_durations[(int)Phase::Count];
+};
+
+} // namespace Rml
+#endif
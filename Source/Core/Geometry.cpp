@@ -32,12 +32,20 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameProfiler.h"
 #include "GeometryDatabase.h"
 #include <utility>
 
 
 namespace Rml {
 
+// Submits any batched geometry of the context being rendered, so that it is rendered before the following calls to the render interface.
+static void FlushDrawList(RenderInterface* render_interface)
+{
+	if (Context* context = render_interface->GetContext())
+		context->GetRenderState().FlushDrawList();
+}
+
 Geometry::Geometry(Element* host_element) : host_element(host_element)
 {
 	database_handle = GeometryDatabase::Insert(this);
@@ -70,8 +78,10 @@ void Geometry::MoveFrom(Geometry& other)
 	indices = std::move(other.indices);
 
 	texture = std::exchange(other.texture, nullptr);
+	opacity = std::exchange(other.opacity, 1.f);
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
+	compiled_texture_handle = std::exchange(other.compiled_texture_handle, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
 }
 
@@ -103,12 +113,38 @@ void Geometry::Render(Vector2f translation)
 	if (!render_interface)
 		return;
 
+	// Fully transparent geometry has no visible effect.
+	if (opacity <= 0.f)
+		return;
+
 	translation = translation.Round();
 
+	// Render nothing while the texture is being loaded in the background, unless there is a placeholder.
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+	const bool texture_loading = (texture && texture->IsLoading(render_interface));
+	if (texture_loading && !texture_handle)
+		return;
+
+	ReleaseIfTextureChanged(texture_handle);
+
+	// While rendering a context, batch the geometry into the context's draw list if supported by the render interface.
+	if (Context* context = render_interface->GetContext())
+	{
+		RenderState& render_state = context->GetRenderState();
+		if (render_state.SupportsDrawLists())
+		{
+			if (!vertices.empty() && !indices.empty())
+				render_state.AddToDrawList(vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size(), texture_handle, translation,
+					opacity);
+			return;
+		}
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
+		FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
@@ -121,15 +157,20 @@ void Geometry::Render(Vector2f translation)
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
-		if (!compile_attempted)
+		// Don't compile the geometry with the placeholder texture.
+		if (!compile_attempted && !texture_loading)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+			Vector<Vertex> opacity_vertices;
+			compiled_geometry = render_interface->CompileGeometry(GetRenderVertices(opacity_vertices), (int)vertices.size(), &indices[0],
+				(int)indices.size(), texture_handle);
+			compiled_texture_handle = texture_handle;
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
 			if (compiled_geometry)
 			{	
+				FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
 				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 				return;
 			}
@@ -137,8 +178,10 @@ void Geometry::Render(Vector2f translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
-			texture ? texture->GetHandle(render_interface) : 0, translation);
+		FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
+		Vector<Vertex> opacity_vertices;
+		render_interface->RenderGeometry(GetRenderVertices(opacity_vertices), (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle,
+			translation);
 	}
 }
 
@@ -148,6 +191,9 @@ void Geometry::Render(CompiledShaderHandle shader_handle, Vector2f translation)
 	if (!render_interface)
 		return;
 
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+	ReleaseIfTextureChanged(texture_handle);
+
 	if (!compile_attempted)
 	{
 		if (vertices.empty() || indices.empty())
@@ -156,13 +202,17 @@ void Geometry::Render(CompiledShaderHandle shader_handle, Vector2f translation)
 		RMLUI_ZoneScoped;
 
 		compile_attempted = true;
-		compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
-			texture ? texture->GetHandle(render_interface) : 0);
+		Vector<Vertex> opacity_vertices;
+		compiled_geometry = render_interface->CompileGeometry(GetRenderVertices(opacity_vertices), (int)vertices.size(), &indices[0],
+			(int)indices.size(), texture_handle);
+		compiled_texture_handle = texture_handle;
 	}
 
 	if (compiled_geometry)
 	{
+		FlushDrawList(render_interface);
 		translation = translation.Round();
+		FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
 		render_interface->RenderShader(shader_handle, compiled_geometry, translation);
 	}
 }
@@ -173,6 +223,9 @@ void Geometry::RenderToClipMask(ClipMaskOperation clip_mask, Vector2f translatio
 	if (!render_interface)
 		return;
 
+	const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+	ReleaseIfTextureChanged(texture_handle);
+
 	if (!compile_attempted)
 	{
 		if (vertices.empty() || indices.empty())
@@ -181,13 +234,17 @@ void Geometry::RenderToClipMask(ClipMaskOperation clip_mask, Vector2f translatio
 		RMLUI_ZoneScoped;
 
 		compile_attempted = true;
-		compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(),
-			texture ? texture->GetHandle(render_interface) : 0);
+		Vector<Vertex> opacity_vertices;
+		compiled_geometry = render_interface->CompileGeometry(GetRenderVertices(opacity_vertices), (int)vertices.size(), &indices[0],
+			(int)indices.size(), texture_handle);
+		compiled_texture_handle = texture_handle;
 	}
 
 	if (compiled_geometry)
 	{
+		FlushDrawList(render_interface);
 		translation = translation.Round();
+		FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
 		render_interface->RenderToClipMask(clip_mask, compiled_geometry, translation);
 	}
 }
@@ -217,6 +274,41 @@ void Geometry::SetTexture(const Texture* _texture)
 	Release();
 }
 
+void Geometry::SetOpacity(float _opacity)
+{
+	if (opacity == _opacity)
+		return;
+
+	// The opacity is applied to the vertex colours whenever they are submitted, thus only the compiled geometry needs to be released.
+	opacity = _opacity;
+	if (compile_attempted)
+		Release();
+}
+
+float Geometry::GetOpacity() const
+{
+	return opacity;
+}
+
+Vertex* Geometry::GetRenderVertices(Vector<Vertex>& buffer)
+{
+	if (opacity >= 1.f)
+		return vertices.data();
+
+	buffer = vertices;
+	for (Vertex& vertex : buffer)
+		vertex.colour.alpha = byte(opacity * float(vertex.colour.alpha));
+
+	return buffer.data();
+}
+
+void Geometry::ReleaseIfTextureChanged(TextureHandle texture_handle)
+{
+	// The texture may have been released and generated again with a new handle, e.g. when evicted to stay within the texture memory budget.
+	if (compile_attempted && texture_handle != compiled_texture_handle)
+		Release();
+}
+
 void Geometry::Release(bool clear_buffers)
 {
 	if (compiled_geometry)
@@ -225,6 +317,7 @@ void Geometry::Release(bool clear_buffers)
 		compiled_geometry = 0;
 	}
 
+	compiled_texture_handle = 0;
 	compile_attempted = false;
 
 	if (clear_buffers)
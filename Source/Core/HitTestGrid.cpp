@@ -0,0 +1,313 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "HitTestGrid.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "TransformState.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace Rml {
+
+static constexpr int MaxCellsPerAxis = 64;
+
+// Returns the window-space bounds of the element's border boxes, or an invalid rectangle if they cannot be determined.
+static Rectanglef GetElementBounds(Element* element)
+{
+	const Vector2f position = element->GetAbsoluteOffset(BoxArea::Border);
+
+	Vector2f box_offset;
+	const Box& main_box = element->GetBox(0, box_offset);
+	Rectanglef bounds = Rectanglef::FromPositionSize(position + box_offset, main_box.GetSize(BoxArea::Border));
+
+	for (int i = 1; i < element->GetNumBoxes(); ++i)
+	{
+		const Box& box = element->GetBox(i, box_offset);
+		bounds.Join(Rectanglef::FromPositionSize(position + box_offset, box.GetSize(BoxArea::Border)));
+	}
+
+	const TransformState* transform_state = element->GetTransformState();
+	if (const Matrix4f* transform = (transform_state ? transform_state->GetTransform() : nullptr))
+	{
+		// The transformed boxes lie within the convex hull of the transformed corners, as long as no corner is projected
+		// behind the viewer.
+		const Vector2f corners[4] = {bounds.TopLeft(), {bounds.Right(), bounds.Top()}, {bounds.Left(), bounds.Bottom()}, bounds.BottomRight()};
+
+		for (int i = 0; i < 4; i++)
+		{
+			const Vector4f window_point = *transform * Vector4f(corners[i].x, corners[i].y, 0, 1);
+			if (window_point.w <= 1e-5f)
+				return Rectanglef::CreateInvalid();
+
+			const Vector3f divided_point = window_point.PerspectiveDivide();
+			const Vector2f point(divided_point.x, divided_point.y);
+			if (i == 0)
+				bounds = Rectanglef::FromPosition(point);
+			else
+				bounds.Join(point);
+		}
+	}
+
+	// Pad the bounds to account for rounding differences against the exact test.
+	bounds.Extend(1.f);
+
+	if (!std::isfinite(bounds.Left()) || !std::isfinite(bounds.Top()) || !std::isfinite(bounds.Right()) || !std::isfinite(bounds.Bottom()))
+		return Rectanglef::CreateInvalid();
+
+	return bounds;
+}
+
+void HitTestGrid::Build(Element* root)
+{
+	entries.clear();
+	unbounded_entries.clear();
+	moved_entries.clear();
+	cell_offsets.clear();
+	cell_entries.clear();
+	num_cells_x = 0;
+	num_cells_y = 0;
+
+	AddElementRecursive(root);
+
+	int num_bounded_entries = 0;
+	for (int i = 0; i < (int)entries.size(); i++)
+	{
+		const Rectanglef bounds = entries[i].bounds;
+		if (!bounds.Valid())
+		{
+			unbounded_entries.push_back(i);
+			continue;
+		}
+
+		if (num_bounded_entries == 0)
+			grid_bounds = bounds;
+		else
+			grid_bounds.Join(bounds);
+		num_bounded_entries += 1;
+	}
+
+	if (num_bounded_entries == 0)
+		return;
+
+	const int num_cells_per_axis = Math::Clamp((int)std::sqrt((float)num_bounded_entries), 1, MaxCellsPerAxis);
+	num_cells_x = num_cells_per_axis;
+	num_cells_y = num_cells_per_axis;
+	cell_size = Math::Max(grid_bounds.Size(), Vector2f(1.f)) / float(num_cells_per_axis);
+
+	auto GetCellRange = [this](Rectanglef bounds, int& x0, int& y0, int& x1, int& y1) {
+		x0 = Math::Clamp(int((bounds.Left() - grid_bounds.Left()) / cell_size.x), 0, num_cells_x - 1);
+		y0 = Math::Clamp(int((bounds.Top() - grid_bounds.Top()) / cell_size.y), 0, num_cells_y - 1);
+		x1 = Math::Clamp(int((bounds.Right() - grid_bounds.Left()) / cell_size.x), 0, num_cells_x - 1);
+		y1 = Math::Clamp(int((bounds.Bottom() - grid_bounds.Top()) / cell_size.y), 0, num_cells_y - 1);
+	};
+
+	// Count the entries of each cell, then fill them in place. Entries are visited in order, keeping each cell sorted.
+	cell_offsets.resize(num_cells_x * num_cells_y + 1, 0);
+
+	for (const Entry& entry : entries)
+	{
+		if (!entry.bounds.Valid())
+			continue;
+
+		int x0, y0, x1, y1;
+		GetCellRange(entry.bounds, x0, y0, x1, y1);
+		for (int y = y0; y <= y1; y++)
+			for (int x = x0; x <= x1; x++)
+				cell_offsets[y * num_cells_x + x + 1] += 1;
+	}
+
+	for (size_t i = 1; i < cell_offsets.size(); i++)
+		cell_offsets[i] += cell_offsets[i - 1];
+
+	cell_entries.resize(cell_offsets.back());
+	Vector<int> cell_cursors(cell_offsets.begin(), cell_offsets.end() - 1);
+
+	for (int i = 0; i < (int)entries.size(); i++)
+	{
+		if (!entries[i].bounds.Valid())
+			continue;
+
+		int x0, y0, x1, y1;
+		GetCellRange(entries[i].bounds, x0, y0, x1, y1);
+		for (int y = y0; y <= y1; y++)
+			for (int x = x0; x <= x1; x++)
+				cell_entries[cell_cursors[y * num_cells_x + x]++] = i;
+	}
+}
+
+void HitTestGrid::AddElementRecursive(Element* element)
+{
+	// Mirrors the traversal order of a front-to-back hit test: the stacking context from the top, then the element itself.
+	if (element->local_stacking_context)
+	{
+		if (element->stacking_context_dirty)
+			element->BuildLocalStackingContext();
+
+		for (int i = (int)element->stacking_context.size() - 1; i >= 0; --i)
+			AddElementRecursive(element->stacking_context[i]);
+	}
+
+	element->hit_test_grid_index = (int)entries.size();
+	entries.push_back(Entry{element, GetElementBounds(element), false});
+}
+
+bool HitTestGrid::UpdateMovedSubtree(Element* element)
+{
+	const size_t num_moved_entries_before = moved_entries.size();
+
+	UpdateMovedElementRecursive(element);
+
+	// Moved entries are tested linearly, when they make up a large part of the grid it is better rebuilt.
+	if (moved_entries.size() * 4 > entries.size())
+		return false;
+
+	if (moved_entries.size() != num_moved_entries_before)
+		std::sort(moved_entries.begin(), moved_entries.end());
+
+	return true;
+}
+
+void HitTestGrid::UpdateMovedElementRecursive(Element* element)
+{
+	const int index = element->hit_test_grid_index;
+	if (index >= 0 && index < (int)entries.size() && entries[index].element == element)
+	{
+		Entry& entry = entries[index];
+		entry.bounds = GetElementBounds(element);
+		if (!entry.moved)
+		{
+			entry.moved = true;
+			moved_entries.push_back(index);
+		}
+	}
+
+	for (const ElementPtr& child : element->children)
+		UpdateMovedElementRecursive(child.get());
+}
+
+Element* HitTestGrid::GetElementAtPoint(Vector2f point, const Element* ignore_element) const
+{
+	if (entries.empty())
+		return nullptr;
+
+	const int* cell_begin = nullptr;
+	const int* cell_end = nullptr;
+
+	if (num_cells_x > 0 && grid_bounds.Contains(point))
+	{
+		const int x = Math::Clamp(int((point.x - grid_bounds.Left()) / cell_size.x), 0, num_cells_x - 1);
+		const int y = Math::Clamp(int((point.y - grid_bounds.Top()) / cell_size.y), 0, num_cells_y - 1);
+		const int cell_index = y * num_cells_x + x;
+
+		cell_begin = cell_entries.data() + cell_offsets[cell_index];
+		cell_end = cell_entries.data() + cell_offsets[cell_index + 1];
+	}
+
+	const int* unbounded_begin = unbounded_entries.data();
+	const int* unbounded_end = unbounded_begin + unbounded_entries.size();
+
+	const int* moved_begin = moved_entries.data();
+	const int* moved_end = moved_begin + moved_entries.size();
+
+	const int root_index = (int)entries.size() - 1;
+	constexpr int no_index = INT_MAX;
+
+	// Merge the candidates of the cell with the unbounded and moved entries to test them all in hit test order.
+	while (cell_begin != cell_end || unbounded_begin != unbounded_end || moved_begin != moved_end)
+	{
+		const int cell_index = (cell_begin != cell_end ? *cell_begin : no_index);
+		const int unbounded_index = (unbounded_begin != unbounded_end ? *unbounded_begin : no_index);
+		const int moved_index = (moved_begin != moved_end ? *moved_begin : no_index);
+
+		int index;
+		if (moved_index <= cell_index && moved_index <= unbounded_index)
+		{
+			index = *moved_begin++;
+			cell_begin += (cell_index == index);
+			unbounded_begin += (unbounded_index == index);
+		}
+		else if (cell_index < unbounded_index)
+		{
+			index = *cell_begin++;
+		}
+		else
+		{
+			index = *unbounded_begin++;
+		}
+
+		const Entry& entry = entries[index];
+
+		// Moved entries are only tested in their own order, and against their updated bounds.
+		if (entry.moved && index != moved_index)
+			continue;
+		if (entry.bounds.Valid() && !entry.bounds.Contains(point))
+			continue;
+
+		if (ignore_element && index != root_index)
+		{
+			const Element* element_hierarchy = entry.element;
+			while (element_hierarchy && element_hierarchy != ignore_element)
+				element_hierarchy = element_hierarchy->GetParentNode();
+
+			if (element_hierarchy)
+				continue;
+		}
+
+		if (IsElementAtPoint(entry.element, point))
+			return entry.element;
+	}
+
+	return nullptr;
+}
+
+bool HitTestGrid::IsElementAtPoint(Element* element, Vector2f point)
+{
+	// Ignore elements whose pointer events are disabled.
+	if (element->GetComputedValues().pointer_events() == Style::PointerEvents::None)
+		return false;
+
+	// Projection may fail if we have a singular transformation matrix.
+	bool projection_result = element->Project(point);
+
+	// Check if the point is actually within this element.
+	bool within_element = (projection_result && element->IsPointWithinElement(point));
+	if (within_element)
+	{
+		Rectanglei clip_region;
+		if (ElementUtilities::GetClippingRegion(clip_region, element))
+			within_element = clip_region.Contains(Vector2i(point));
+	}
+
+	return within_element;
+}
+
+} // namespace Rml
@@ -0,0 +1,96 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_HITTESTGRID_H
+#define RMLUI_CORE_HITTESTGRID_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+class Element;
+
+/**
+	A spatial index over the elements of a document, used to find the element under a given point without visiting
+	every element in the document's stacking context tree.
+
+	The elements are stored in the order they are visited by a front-to-back hit test, together with a conservative
+	window-space bounding box of their border boxes after transforms. A uniform grid over the bounding boxes narrows a
+	query down to the candidates overlapping a single cell, which are then tested exactly in their original order.
+
+	Elements which move without changing the hit test order, such as when scrolling, are taken out of the grid and
+	tested against their updated bounds instead, until too many of them have moved and the grid is rebuilt.
+ */
+
+class HitTestGrid {
+public:
+	/// Rebuilds the index from the stacking context tree of the given element.
+	void Build(Element* root);
+
+	/// Updates the bounds of an element and its descendants after they have moved, without any other changes to the document.
+	/// @return False if so many elements have moved that the index should rather be rebuilt.
+	bool UpdateMovedSubtree(Element* element);
+
+	/// Returns the front-most element under the given point, equivalent to a full traversal of the stacking contexts.
+	/// @param[in] point The point to test, in window coordinates.
+	/// @param[in] ignore_element If set, this element and its descendants are skipped, except for the root element itself.
+	Element* GetElementAtPoint(Vector2f point, const Element* ignore_element) const;
+
+	/// Tests whether the point lies within the given element itself, taking into account its transform, clipping, and
+	/// pointer-events. Descendants are not considered.
+	static bool IsElementAtPoint(Element* element, Vector2f point);
+
+private:
+	void AddElementRecursive(Element* element);
+	void UpdateMovedElementRecursive(Element* element);
+
+	struct Entry {
+		Element* element;
+		Rectanglef bounds;
+		// Moved entries are no longer located in the cells they were added to.
+		bool moved;
+	};
+
+	// All elements in hit test order, the root element last.
+	Vector<Entry> entries;
+	// Indices of entries whose bounds could not be determined, such as elements projected behind the viewer.
+	Vector<int> unbounded_entries;
+	// Indices of entries which have moved since the grid was built, in ascending order. These are tested against their updated bounds.
+	Vector<int> moved_entries;
+
+	// The grid covers the union of all bounded entries, cell entry indices are stored in ascending order.
+	Rectanglef grid_bounds;
+	Vector2f cell_size;
+	int num_cells_x = 0;
+	int num_cells_y = 0;
+	Vector<int> cell_offsets;
+	Vector<int> cell_entries;
+};
+
+} // namespace Rml
+#endif
@@ -241,6 +241,10 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 {
 	RMLUI_ASSERT(element);
 
+	float cached_width = 0.f;
+	if (LayoutEngine::GetCachedShrinkToFitWidth(element, containing_block, cached_width))
+		return cached_width;
+
 	Box box;
 	float min_height, max_height;
 	LayoutDetails::BuildBox(box, containing_block, element, BoxContext::Block, containing_block.x);
@@ -266,7 +270,10 @@ float LayoutDetails::GetShrinkToFitWidth(Element* element, Vector2f containing_b
 	// away with not closing the boxes. This is avoided for performance reasons.
 	//block_context_box->Close();
 
-	return Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+	const float width = Math::Min(containing_block.x, block_context_box->GetShrinkToFitWidth());
+	LayoutEngine::SetCachedShrinkToFitWidth(element, containing_block, width);
+
+	return width;
 }
 
 ComputedAxisSize LayoutDetails::BuildComputedHorizontalSize(const ComputedValues& computed)
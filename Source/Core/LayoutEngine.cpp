@@ -29,12 +29,16 @@
 #include "LayoutEngine.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "FrameProfiler.h"
 #include "LayoutBlockBoxSpace.h"
 #include "LayoutDetails.h"
 #include "LayoutFlex.h"
 #include "LayoutInlineBoxText.h"
+#include "LayoutState.h"
 #include "LayoutTable.h"
 #include "Pool.h"
 #include <cstddef>
@@ -57,17 +61,99 @@ static Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true);
 static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
 static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
 
+#ifdef RMLUI_TESTS_ENABLED
+static int num_formatted_elements = 0;
+static LayoutEngine::CacheStatistics cache_statistics;
+#define RMLUI_COUNT_FORMATTED_ELEMENT() (num_formatted_elements += 1)
+#define RMLUI_COUNT_LAYOUT_CACHE_HIT() (cache_statistics.num_hits += 1)
+#define RMLUI_COUNT_LAYOUT_CACHE_MISS() (cache_statistics.num_misses += 1)
+#else
+#define RMLUI_COUNT_FORMATTED_ELEMENT()
+#define RMLUI_COUNT_LAYOUT_CACHE_HIT()
+#define RMLUI_COUNT_LAYOUT_CACHE_MISS()
+#endif
+
+// Inserts an entry at the front of a most-recently-used list, dropping the least recently used entry if the list is full.
+template <typename T, int N>
+static void InsertRecentEntry(T (&entries)[N], int& num_entries, const T& entry)
+{
+	num_entries = Math::Min(num_entries + 1, N);
+	for (int i = num_entries - 1; i > 0; i--)
+		entries[i] = entries[i - 1];
+	entries[0] = entry;
+}
+
+// Called when the descendants of an element are formatted other than according to its most recent layout. The results of that layout
+// are then only valid for measuring the element.
+static void DetachLayout(LayoutState& state)
+{
+	if (state.layout_applied)
+	{
+		InsertRecentEntry(state.measurements, state.num_measurements, state.layout);
+		state.layout_applied = false;
+	}
+}
+
+// Returns the layout state of an element about to be formatted, after discarding any cached results which are out of date.
+static LayoutState& BeginLayout(UniquePtr<LayoutState>& layout_state)
+{
+	if (!layout_state)
+		layout_state = MakeUnique<LayoutState>();
+
+	LayoutState& state = *layout_state;
+	if (state.cache_valid)
+	{
+		DetachLayout(state);
+	}
+	else
+	{
+		state.num_measurements = 0;
+		state.num_shrink_to_fit_widths = 0;
+		state.layout_applied = false;
+	}
+
+	// Any change to the layout of the element or its descendants during formatting will clear this flag again.
+	state.cache_valid = true;
+
+	return state;
+}
 
 // Formats the contents for a root-level element (usually a document or floating element).
 void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, const Box* override_initial_box, Vector2f* out_visible_overflow_size)
 {
 	RMLUI_ASSERT(element && containing_block.x >= 0 && containing_block.y >= 0);
+
+	// Without any changes to the element or its formatting inputs since its most recent layout, we can reuse the results of that layout.
+	if (LayoutState* state = element->layout_state.get())
+	{
+		if (state->cache_valid && state->layout_applied && state->layout.Matches(containing_block, override_initial_box))
+		{
+			RMLUI_COUNT_LAYOUT_CACHE_HIT();
+
+			element->SetBox(state->layout.box);
+			element->SetBaseline(state->layout.baseline);
+			state->relayout_boundary = (override_initial_box == nullptr);
+			state->layout.containing_block = containing_block;
+
+			if (out_visible_overflow_size)
+				*out_visible_overflow_size = state->layout.visible_overflow_size;
+			return;
+		}
+	}
+
+	RMLUI_COUNT_LAYOUT_CACHE_MISS();
+
 #ifdef RMLUI_ENABLE_PROFILING
 	RMLUI_ZoneScopedC(0xB22222);
 	auto name = CreateString(80, "%s %p", element->GetAddress(false, false).c_str(), element);
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	RMLUI_COUNT_FORMATTED_ELEMENT();
+	FrameProfiler::Count(FrameProfiler::Counter::ElementsFormatted);
+
+	BeginLayout(element->layout_state);
+
 	auto containing_block_box = MakeUnique<LayoutBlockBox>(nullptr, nullptr, Box(containing_block), 0.0f, FLT_MAX);
 
 	Box box;
@@ -95,12 +181,140 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 
 	block_context_box->CloseAbsoluteElements();
 
+	const Vector2f visible_overflow_size = block_context_box->GetVisibleOverflowSize();
 	if (out_visible_overflow_size)
-		*out_visible_overflow_size = block_context_box->GetVisibleOverflowSize();
+		*out_visible_overflow_size = visible_overflow_size;
+
+	// Store the layout inputs and results, so that the element can later be formatted again on its own, or skip formatting altogether. Without
+	// an overriding box, the element's box is fully determined by the containing block and its own contents, so it can act as a relayout boundary.
+	LayoutState& state = *element->layout_state;
+	state.relayout_boundary = (override_initial_box == nullptr);
+	state.layout_applied = true;
+
+	LayoutResult& layout = state.layout;
+	layout.has_override_box = (override_initial_box != nullptr);
+	if (override_initial_box)
+		layout.override_box = *override_initial_box;
+	layout.containing_block = containing_block;
+	layout.box = element->GetBox();
+	layout.baseline = element->GetBaseline();
+	layout.visible_overflow_size = visible_overflow_size;
 
 	element->OnLayout();
 }
 
+Vector2f LayoutEngine::MeasureElement(Element* element, Vector2f containing_block, const Box& override_initial_box)
+{
+	// In addition to the most recent layout, previous layouts can be used here since we are only interested in the resulting size.
+	LayoutState* state = element->layout_state.get();
+	if (state && state->cache_valid)
+	{
+		for (int i = 0; i < state->num_measurements; i++)
+		{
+			if (state->measurements[i].Matches(containing_block, &override_initial_box))
+			{
+				RMLUI_COUNT_LAYOUT_CACHE_HIT();
+				return state->measurements[i].box.GetSize();
+			}
+		}
+	}
+
+	FormatElement(element, containing_block, &override_initial_box);
+	return element->GetBox().GetSize();
+}
+
+bool LayoutEngine::GetCachedShrinkToFitWidth(Element* element, Vector2f containing_block, float& out_width)
+{
+	LayoutState* state = element->layout_state.get();
+	if (state && state->cache_valid)
+	{
+		for (int i = 0; i < state->num_shrink_to_fit_widths; i++)
+		{
+			if (state->shrink_to_fit_widths[i].containing_block == containing_block)
+			{
+				RMLUI_COUNT_LAYOUT_CACHE_HIT();
+				out_width = state->shrink_to_fit_widths[i].width;
+				return true;
+			}
+		}
+	}
+
+	RMLUI_COUNT_LAYOUT_CACHE_MISS();
+	return false;
+}
+
+void LayoutEngine::SetCachedShrinkToFitWidth(Element* element, Vector2f containing_block, float width)
+{
+	// The element's children were formatted to determine the width, thus they no longer reflect the element's most recent layout.
+	LayoutState& state = BeginLayout(element->layout_state);
+	InsertRecentEntry(state.shrink_to_fit_widths, state.num_shrink_to_fit_widths, LayoutState::ShrinkToFitWidth{containing_block, width});
+}
+
+void LayoutEngine::DirtyLayoutCache(Element* element)
+{
+	if (!element->layout_state)
+	{
+		// Before the first layout of the document, such as while it is loading, there are no cached layouts to invalidate.
+		Element* document = element->GetOwnerDocument();
+		if (document && !document->layout_state)
+			return;
+	}
+	else
+	{
+		element->layout_state->cache_valid = false;
+	}
+
+	// Every formatted element validates its cache, thus an ancestor with an invalid cache has not been formatted since it was invalidated.
+	// It will be formatted again, or its layout does not currently depend on its descendants such as when it is not displayed. Either way,
+	// its own ancestors have already been invalidated when it was, so we can stop the walk there.
+	for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+	{
+		if (ancestor->layout_state)
+		{
+			if (!ancestor->layout_state->cache_valid)
+				break;
+			ancestor->layout_state->cache_valid = false;
+		}
+	}
+}
+
+Element* LayoutEngine::FindRelayoutBoundary(Element* element)
+{
+	Element* document = element->GetOwnerDocument();
+
+	// The element's own box may have changed, so the search starts at its parent.
+	for (Element* ancestor = element->GetParentNode(); ancestor && ancestor != document; ancestor = ancestor->GetParentNode())
+	{
+		if (ancestor->layout_state && ancestor->layout_state->relayout_boundary)
+			return ancestor;
+	}
+
+	return nullptr;
+}
+
+bool LayoutEngine::FormatRelayoutBoundary(Element* element)
+{
+	if (!element->layout_state || !element->layout_state->relayout_boundary)
+		return false;
+
+	const LayoutResult previous_layout = element->layout_state->layout;
+
+	Vector2f visible_overflow_size;
+	FormatElement(element, previous_layout.containing_block, previous_layout.has_override_box ? &previous_layout.override_box : nullptr,
+		&visible_overflow_size);
+
+	element->layout_state->relayout_boundary = true;
+
+	return element->GetBox() == previous_layout.box && element->GetBaseline() == previous_layout.baseline &&
+		visible_overflow_size == previous_layout.visible_overflow_size;
+}
+
+void LayoutEngine::MarkRelayoutBoundary(Element* element)
+{
+	RMLUI_ASSERT(element->layout_state);
+	element->layout_state->relayout_boundary = true;
+}
+
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
 	static_assert(ChunkSizeBig > ChunkSizeMedium && ChunkSizeMedium > ChunkSizeSmall, "The following assumes a strict ordering of the chunk sizes.");
@@ -132,6 +346,22 @@ void LayoutEngine::DeallocateLayoutChunk(void* chunk, size_t size)
 	}
 }
 
+#ifdef RMLUI_TESTS_ENABLED
+int LayoutEngine::GetAndResetNumFormattedElements()
+{
+	const int result = num_formatted_elements;
+	num_formatted_elements = 0;
+	return result;
+}
+
+LayoutEngine::CacheStatistics LayoutEngine::GetAndResetCacheStatistics()
+{
+	const CacheStatistics result = cache_statistics;
+	cache_statistics = {};
+	return result;
+}
+#endif
+
 // Positions a single element and its children within this layout.
 bool LayoutEngine::FormatElement(LayoutBlockBox* block_context_box, Element* element)
 {
@@ -141,6 +371,17 @@ bool LayoutEngine::FormatElement(LayoutBlockBox* block_context_box, Element* ele
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	RMLUI_COUNT_FORMATTED_ELEMENT();
+	FrameProfiler::Count(FrameProfiler::Counter::ElementsFormatted);
+
+	// The element is now formatted as part of its parent's formatting context, thus it can no longer be formatted on its own. Its cache is
+	// validated again like any other formatted element, so that later changes to its descendants are propagated through it to its ancestors.
+	if (element->layout_state)
+	{
+		BeginLayout(element->layout_state);
+		element->layout_state->relayout_boundary = false;
+	}
+
 	auto& computed = element->GetComputedValues();
 
 	// Check if we have to do any special formatting for any elements that don't fit into the standard layout scheme.
@@ -51,14 +51,59 @@ public:
 	/// @param[out] visible_overflow_size Optionally output the overflow size of the element.
 	static void FormatElement(Element* element, Vector2f containing_block, const Box* override_initial_box = nullptr, Vector2f* out_visible_overflow_size = nullptr);
 
+	/// Determines the size of a root-level element formatted with the given box, without requiring its descendants to be formatted accordingly.
+	/// Intended for formatting contexts which need to measure their children before formatting them with their final box.
+	/// @param[in] element The element to measure.
+	/// @param[in] containing_block The size of the containing block.
+	/// @param[in] override_initial_box The box to override the generated box for the element.
+	/// @return The resulting content size of the element.
+	static Vector2f MeasureElement(Element* element, Vector2f containing_block, const Box& override_initial_box);
+
 	/// Positions a single element and its children within a block formatting context.
 	/// @param[in] block_context_box The open block box to layout the element in.
 	/// @param[in] element The element to lay out.
 	static bool FormatElement(LayoutBlockBox* block_context_box, Element* element);
 
+	/// Returns the closest ancestor of the element which can be formatted on its own, without affecting the layout of its own ancestors as long as
+	/// its outer box does not change. This is an element previously formatted as the root of an independent formatting context, with its
+	/// containing block and box determined without regard to its contents.
+	/// @param[in] element The element whose layout is dirty.
+	/// @return The relayout boundary, or nullptr if the whole document needs to be formatted.
+	static Element* FindRelayoutBoundary(Element* element);
+
+	/// Formats a relayout boundary again, using the containing block and box from its most recent layout.
+	/// @param[in] element The relayout boundary.
+	/// @return True if the outer box, baseline, and visible overflow of the element are unchanged, so that its ancestors are unaffected.
+	static bool FormatRelayoutBoundary(Element* element);
+
+	/// Marks an element most recently formatted with an overriding box as a relayout boundary. Formatting contexts should only call this
+	/// after determining the element's box without regard to its contents.
+	static void MarkRelayoutBoundary(Element* element);
+
+	/// Retrieves the cached shrink-to-fit width of an element in the given containing block.
+	/// @return True if the width was found in the cache, false if it needs to be determined again.
+	static bool GetCachedShrinkToFitWidth(Element* element, Vector2f containing_block, float& out_width);
+	/// Stores the shrink-to-fit width of an element in the given containing block, after its children were formatted to determine the width.
+	static void SetCachedShrinkToFitWidth(Element* element, Vector2f containing_block, float width);
+
+	/// Clears the cached layout results of the element and all its ancestors, called whenever the layout of the element is dirtied.
+	static void DirtyLayoutCache(Element* element);
+
 	static void* AllocateLayoutChunk(size_t size);
 	static void DeallocateLayoutChunk(void* chunk, size_t size);
 
+#ifdef RMLUI_TESTS_ENABLED
+	/// Returns the number of elements formatted since the last call to this function.
+	static int GetAndResetNumFormattedElements();
+
+	struct CacheStatistics {
+		int num_hits = 0;
+		int num_misses = 0;
+	};
+	/// Returns the number of layout cache hits and misses since the last call to this function.
+	static CacheStatistics GetAndResetCacheStatistics();
+#endif
+
 private:
 	/// Formats and positions an element as a block element.
 	/// @param[in] block_context_box The open block box to layout the element in.
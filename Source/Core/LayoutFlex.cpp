@@ -98,6 +98,9 @@ struct FlexItem {
 	Element* element;
 	Box box;
 
+	// True if the item's size was determined by formatting its contents.
+	bool sized_by_content;
+
 	// Filled during the build step.
 	Size main;
 	Size cross;
@@ -268,9 +271,11 @@ void LayoutFlex::Format()
 		else if (main_axis_horizontal)
 		{
 			item.inner_flex_base_size = LayoutDetails::GetShrinkToFitWidth(element, flex_content_containing_block);
+			item.sized_by_content = true;
 		}
 		else
 		{
+			item.sized_by_content = true;
 			const Vector2f initial_box_size = item.box.GetSize();
 			RMLUI_ASSERT(initial_box_size.y < 0.f);
 
@@ -278,8 +283,7 @@ void LayoutFlex::Format()
 			if (initial_box_size.x < 0.f)
 				format_box.SetContent(Vector2f(flex_available_content_size.x - item.cross.sum_edges, initial_box_size.y));
 
-			LayoutEngine::FormatElement(element, flex_content_containing_block, &format_box);
-			item.inner_flex_base_size = element->GetBox().GetSize().y;
+			item.inner_flex_base_size = LayoutEngine::MeasureElement(element, flex_content_containing_block, format_box).y;
 		}
 
 		// Calculate the hypothetical main size (clamped flex base size).
@@ -564,8 +568,8 @@ void LayoutFlex::Format()
 				if (content_size.y < 0.0f)
 				{
 					item.box.SetContent(Vector2f(used_main_size_inner, content_size.y));
-					LayoutEngine::FormatElement(item.element, flex_content_containing_block, &item.box);
-					item.hypothetical_cross_size = item.element->GetBox().GetSize().y + item.cross.sum_edges;
+					item.hypothetical_cross_size = LayoutEngine::MeasureElement(item.element, flex_content_containing_block, item.box).y + item.cross.sum_edges;
+					item.sized_by_content = true;
 				}
 				else
 				{
@@ -579,6 +583,7 @@ void LayoutFlex::Format()
 					item.box.SetContent(Vector2f(content_size.x, used_main_size_inner));
 					item.hypothetical_cross_size =
 						LayoutDetails::GetShrinkToFitWidth(item.element, flex_content_containing_block) + item.cross.sum_edges;
+					item.sized_by_content = true;
 				}
 				else
 				{
@@ -831,6 +836,10 @@ void LayoutFlex::Format()
 			Vector2f cell_visible_overflow_size;
 			LayoutEngine::FormatElement(item.element, flex_content_containing_block, &item.box, &cell_visible_overflow_size);
 
+			// Items sized independently of their contents can later be formatted again on their own, when only their descendants change.
+			if (!item.sized_by_content)
+				LayoutEngine::MarkRelayoutBoundary(item.element);
+
 			// Set the position of the element within the the flex container
 			item.element->SetOffset(flex_content_offset + item_offset, element_flex);
 
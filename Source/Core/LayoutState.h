@@ -0,0 +1,107 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2014 Markus Schöngart
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#ifndef RMLUI_CORE_LAYOUTSTATE_H
+#define RMLUI_CORE_LAYOUTSTATE_H
+
+#include "../../Include/RmlUi/Core/Box.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+/**
+	The inputs and results of a layout of an element formatted as the root of an independent formatting context.
+ */
+
+struct LayoutResult {
+	// The containing block and (optional) overriding box the element was formatted with.
+	bool has_override_box = false;
+	Vector2f containing_block;
+	Box override_box;
+
+	// The resulting box, baseline, and visible overflow size of the element.
+	Box box;
+	float baseline = 0.f;
+	Vector2f visible_overflow_size;
+
+	// Returns true if the given layout inputs are guaranteed to produce the same layout as the inputs of this result.
+	bool Matches(Vector2f in_containing_block, const Box* in_override_box) const
+	{
+		if (has_override_box != (in_override_box != nullptr))
+			return false;
+		if (!in_override_box)
+			return containing_block == in_containing_block;
+		if (override_box != *in_override_box)
+			return false;
+
+		// With a definite size of the overriding box along an axis, the containing block size along this axis does not affect the layout.
+		const Vector2f size = override_box.GetSize();
+		return (size.x >= 0.f || containing_block.x == in_containing_block.x) && (size.y >= 0.f || containing_block.y == in_containing_block.y);
+	}
+};
+
+/**
+	The layout state of an element formatted as the root of an independent formatting context, such as a document, or a floating,
+	absolutely positioned, inline-block, or flex item element.
+
+	This state allows the element to be formatted again on its own when only its descendants have changed. Additionally, it caches the
+	results of previous layouts, so that the element can skip formatting while neither its contents nor its formatting inputs have changed.
+ */
+
+struct LayoutState {
+	// True if the element can be formatted again using only the most recent layout inputs, see 'LayoutEngine::FindRelayoutBoundary'.
+	bool relayout_boundary = false;
+
+	// The most recent layout of the element.
+	LayoutResult layout;
+
+	// True while the cached results below, and the layout above, are up-to-date with the element and its descendants. Cleared whenever the
+	// layout of the element or any of its descendants is dirtied.
+	bool cache_valid = false;
+
+	// True if the descendants of the element are currently formatted according to the most recent layout.
+	bool layout_applied = false;
+
+	// Previous layouts using different inputs, most recent first. Only their resulting sizes can be reused, as the descendants have since
+	// been formatted again. Multiple entries are kept since layouts are often repeated with alternating inputs, such as when a scrollbar is
+	// added to an ancestor.
+	static constexpr int MaxNumMeasurements = 2;
+	int num_measurements = 0;
+	LayoutResult measurements[MaxNumMeasurements];
+
+	// The shrink-to-fit widths of the element in the given containing blocks, most recent first.
+	struct ShrinkToFitWidth {
+		Vector2f containing_block;
+		float width;
+	};
+	static constexpr int MaxNumShrinkToFitWidths = 2;
+	int num_shrink_to_fit_widths = 0;
+	ShrinkToFitWidth shrink_to_fit_widths[MaxNumShrinkToFitWidths];
+};
+
+} // namespace Rml
+#endif
@@ -65,6 +65,11 @@ int PropertyDictionary::GetNumProperties() const
 	return (int)properties.size();
 }
 
+void PropertyDictionary::Reserve(int num_properties)
+{
+	properties.reserve((size_t)num_properties);
+}
+
 // Returns the map of properties in the dictionary.
 const PropertyMap& PropertyDictionary::GetProperties() const
 {
@@ -74,6 +79,10 @@ const PropertyMap& PropertyDictionary::GetProperties() const
 // Imports potentially un-specified properties into the dictionary.
 void PropertyDictionary::Import(const PropertyDictionary& other, int property_specificity)
 {
+	// Most dictionaries are only imported into once, reserve their exact size to avoid excess capacity.
+	if (properties.empty())
+		Reserve(other.GetNumProperties());
+
 	for (const auto& pair : other.properties)
 	{
 		const PropertyId id = pair.first;
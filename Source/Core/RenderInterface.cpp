@@ -60,6 +60,13 @@ void RenderInterface::RenderCompiledGeometry(CompiledGeometryHandle /*geometry*/
 // Called by RmlUi when it wants to release application-compiled geometry.
 void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*/) {}
 
+bool RenderInterface::SupportsDrawLists()
+{
+	return false;
+}
+
+void RenderInterface::RenderDrawList(const DrawList& /*draw_list*/) {}
+
 bool RenderInterface::EnableClipMask(bool /*enable*/)
 {
 	return false;
@@ -73,12 +80,24 @@ bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /
 	return false;
 }
 
+// Called by RmlUi on a worker thread when textures are loaded in the background.
+bool RenderInterface::DecodeTexture(Vector<byte>& /*texture_data*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
 {
 	return false;
 }
 
+// Called by RmlUi when a region of a previously generated texture needs to be updated.
+bool RenderInterface::UpdateTexture(TextureHandle /*texture_handle*/, const byte* /*source*/, const Vector2i& /*offset*/, const Vector2i& /*dimensions*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a loaded texture is no longer required.
 void RenderInterface::ReleaseTexture(TextureHandle /*texture*/)
 {
@@ -32,7 +32,9 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameProfiler.h"
 #include "TransformState.h"
 
 namespace Rml {
@@ -45,6 +47,7 @@ void RenderState::BeginRender()
 
 	render_interface->EnableScissorRegion(false);
 	supports_clip_mask = render_interface->EnableClipMask(false);
+	supports_draw_lists = render_interface->SupportsDrawLists();
 	render_interface->SetTransform(nullptr);
 
 	stack.back() = State{};
@@ -52,6 +55,7 @@ void RenderState::BeginRender()
 
 void RenderState::Reset()
 {
+	FlushDrawList();
 	Set(State{});
 }
 
@@ -67,14 +71,20 @@ void RenderState::SetScissorRegion(Rectanglei new_region)
 	const bool new_scissor_enable = new_region.Valid();
 
 	if (new_scissor_enable != old_scissor_enable)
+	{
+		FlushDrawList();
 		render_interface->EnableScissorRegion(new_scissor_enable);
+	}
 
 	if (new_scissor_enable)
 	{
 		new_region.Intersect(Rectanglei::FromSize(viewport_dimensions));
 
 		if (new_region != state.scissor_region)
+		{
+			FlushDrawList();
 			render_interface->SetScissorRegion(new_region.Left(), new_region.Top(), new_region.Width(), new_region.Height());
+		}
 	}
 
 	state.scissor_region = new_region;
@@ -121,6 +131,7 @@ void RenderState::SetTransform(const Matrix4f* p_new_transform)
 		// Do a deep comparison as well to avoid submitting a new transform which is equal.
 		if (!p_active_transform || !p_new_transform || (active_transform != *p_new_transform))
 		{
+			FlushDrawList();
 			render_interface->SetTransform(p_new_transform);
 
 			if (p_new_transform)
@@ -138,6 +149,8 @@ Rectanglei RenderState::GetScissorState() const
 
 void RenderState::ApplyClipMask(const ElementClipList& clip_elements)
 {
+	FlushDrawList();
+
 	const bool clip_mask_enabled = !clip_elements.empty();
 	render_interface->EnableClipMask(clip_mask_enabled);
 
@@ -157,6 +170,56 @@ void RenderState::ApplyClipMask(const ElementClipList& clip_elements)
 	}
 }
 
+void RenderState::AddToDrawList(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, TextureHandle texture,
+	Vector2f translation, float opacity)
+{
+	RMLUI_ASSERT(supports_draw_lists);
+
+	const int vertex_offset = (int)draw_list.vertices.size();
+	const int index_offset = (int)draw_list.indices.size();
+
+	draw_list.vertices.resize(vertex_offset + num_vertices);
+	for (int i = 0; i < num_vertices; i++)
+	{
+		Vertex& vertex = draw_list.vertices[vertex_offset + i];
+		vertex = vertices[i];
+		vertex.position += translation;
+	}
+
+	if (opacity < 1.f)
+	{
+		for (int i = 0; i < num_vertices; i++)
+		{
+			Colourb& colour = draw_list.vertices[vertex_offset + i].colour;
+			colour.alpha = byte(opacity * float(colour.alpha));
+		}
+	}
+
+	draw_list.indices.resize(index_offset + num_indices);
+	for (int i = 0; i < num_indices; i++)
+		draw_list.indices[index_offset + i] = indices[i] + vertex_offset;
+
+	// Indices are laid out in submission order, thus consecutive geometry with the same texture can be merged into the previous command.
+	if (!draw_list.commands.empty() && draw_list.commands.back().texture == texture)
+		draw_list.commands.back().num_indices += num_indices;
+	else
+		draw_list.commands.push_back(DrawListCommand{index_offset, num_indices, texture});
+}
+
+void RenderState::FlushDrawList()
+{
+	if (draw_list.commands.empty())
+		return;
+
+	RMLUI_ZoneScopedN("RenderDrawList");
+	FrameProfiler::Count(FrameProfiler::Counter::DrawCalls);
+	render_interface->RenderDrawList(draw_list);
+
+	draw_list.vertices.clear();
+	draw_list.indices.clear();
+	draw_list.commands.clear();
+}
+
 void RenderState::SetViewport(Vector2i dimensions)
 {
 	viewport_dimensions = dimensions;
@@ -0,0 +1,162 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/StringWidthCache.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
+
+namespace Rml {
+
+StringWidthCache::StringWidthCache(int max_entries, int max_string_length) : max_entries(max_entries), max_string_length(max_string_length)
+{
+	RMLUI_ASSERT(max_entries > 0);
+}
+
+StringWidthCache::~StringWidthCache() {}
+
+bool StringWidthCache::Find(const String& string, Character prior_character, int& width)
+{
+	if ((int)string.size() > max_string_length)
+		return false;
+
+	const size_t hash = Hash(string, prior_character);
+	auto it = entry_map.find(hash);
+	if (it == entry_map.end())
+		return false;
+
+	const int index = it->second;
+	Entry& entry = entries[index];
+	if (entry.prior_character != prior_character || entry.string != string)
+		return false;
+
+	if (index != front)
+	{
+		Unlink(index);
+		PushFront(index);
+	}
+
+	width = entry.width;
+	return true;
+}
+
+void StringWidthCache::Insert(const String& string, Character prior_character, int width)
+{
+	if ((int)string.size() > max_string_length)
+		return;
+
+	const size_t hash = Hash(string, prior_character);
+
+	auto it = entry_map.find(hash);
+	if (it != entry_map.end())
+	{
+		// Either the same string measured again, or a hash collision. In both cases the newest string replaces the entry.
+		const int index = it->second;
+		Entry& entry = entries[index];
+		entry.string = string;
+		entry.prior_character = prior_character;
+		entry.width = width;
+		Unlink(index);
+		PushFront(index);
+		return;
+	}
+
+	int index = -1;
+	if ((int)entries.size() < max_entries)
+	{
+		index = (int)entries.size();
+		entries.emplace_back();
+	}
+	else
+	{
+		index = back;
+		entry_map.erase(entries[index].hash);
+		Unlink(index);
+	}
+
+	Entry& entry = entries[index];
+	entry.hash = hash;
+	entry.string = string;
+	entry.prior_character = prior_character;
+	entry.width = width;
+	PushFront(index);
+
+	entry_map.emplace(hash, index);
+}
+
+void StringWidthCache::Clear()
+{
+	entries.clear();
+	entry_map.clear();
+	front = -1;
+	back = -1;
+}
+
+int StringWidthCache::GetNumEntries() const
+{
+	return (int)entries.size();
+}
+
+size_t StringWidthCache::Hash(const String& string, Character prior_character)
+{
+	size_t seed = Rml::Hash<String>()(string);
+	Utilities::HashCombine(seed, prior_character);
+	return seed;
+}
+
+void StringWidthCache::Unlink(int index)
+{
+	Entry& entry = entries[index];
+
+	if (entry.previous >= 0)
+		entries[entry.previous].next = entry.next;
+	else
+		front = entry.next;
+
+	if (entry.next >= 0)
+		entries[entry.next].previous = entry.previous;
+	else
+		back = entry.previous;
+
+	entry.previous = -1;
+	entry.next = -1;
+}
+
+void StringWidthCache::PushFront(int index)
+{
+	Entry& entry = entries[index];
+	entry.previous = -1;
+	entry.next = front;
+
+	if (front >= 0)
+		entries[front].previous = index;
+	front = index;
+
+	if (back < 0)
+		back = index;
+}
+
+} // namespace Rml
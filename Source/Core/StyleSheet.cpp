@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "AncestorFilter.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
 #include "StyleSheetNode.h"
@@ -193,48 +194,91 @@ SharedPtr<const ElementDefinition> StyleSheet::GetElementDefinition(const Elemen
 {
 	RMLUI_ASSERT_NONRECURSIVE;
 
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector< const StyleSheetNode* > applicable_nodes;
-	applicable_nodes.clear();
+	// During the update traversal, we can use the filter of ancestors to skip nodes, and share results between siblings.
+	AncestorFilter* filter = AncestorFilter::Get(element);
 
-	auto AddApplicableNodes = [element](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
-		auto it_nodes = node_index.find(Hash<String>()(key));
-		if (it_nodes != node_index.end())
+	AncestorFilter::SiblingMatch* match = (filter ? filter->FindSiblingMatch(this, element) : nullptr);
+	if (!match)
+	{
+		// Using static to avoid allocations. Make sure we don't call this function recursively.
+		static AncestorFilter::SiblingMatch non_cached_match;
+		match = (filter ? filter->AddSiblingMatch(this, element) : nullptr);
+		if (!match)
 		{
-			const StyleSheetIndex::NodeList& nodes = it_nodes->second;
+			match = &non_cached_match;
+			match->nodes.clear();
+			match->structural_nodes.clear();
+		}
 
-			for (const StyleSheetNode* node : nodes)
+		auto AddApplicableNode = [element, filter, match](const StyleSheetNode* node) {
+			// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
+			// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
+			// element's hierarchy to nodes in the style hierarchy. The structural selectors of the node itself depend on the element's
+			// position among its siblings, thus they are matched separately for each element.
+			if (node->IsApplicableIgnoringStructural(element, filter))
 			{
-				// We found a node that has at least one requirement matching the element. Now see if we satisfy the remaining requirements of the
-				// node, including all ancestor nodes. What this involves is traversing the style nodes backwards, trying to match nodes in the
-				// element's hierarchy to nodes in the style hierarchy.
-				if (node->IsApplicable(element))
-					applicable_nodes.push_back(node);
+				if (node->HasStructuralSelectors())
+					match->structural_nodes.push_back(node);
+				else
+					match->nodes.push_back(node);
 			}
-		}
-	};
+		};
+
+		auto AddApplicableNodes = [&AddApplicableNode](const StyleSheetIndex::NodeIndex& node_index, const String& key) {
+			auto it_nodes = node_index.find(Hash<String>()(key));
+			if (it_nodes != node_index.end())
+			{
+				for (const StyleSheetNode* node : it_nodes->second)
+					AddApplicableNode(node);
+			}
+		};
+
+		// See if there are any styles defined for this element.
+		const String& tag = element->GetTagName();
+		const String& id = element->GetId();
+		const StringList& class_names = element->GetStyle()->GetClassNameList();
 
-	// See if there are any styles defined for this element.
-	const String& tag = element->GetTagName();
-	const String& id = element->GetId();
-	const StringList& class_names = element->GetStyle()->GetClassNameList();
+		// First, look up the indexed requirements.
+		if (!id.empty())
+			AddApplicableNodes(styled_node_index.ids, id);
 
-	// First, look up the indexed requirements. 
-	if (!id.empty())
-		AddApplicableNodes(styled_node_index.ids, id);
+		for (const String& name : class_names)
+			AddApplicableNodes(styled_node_index.classes, name);
 
-	for (const String& name : class_names)
-		AddApplicableNodes(styled_node_index.classes, name);
+		AddApplicableNodes(styled_node_index.tags, tag);
 
-	AddApplicableNodes(styled_node_index.tags, tag);
+		// Also check all remaining nodes that don't contain any indexed requirements.
+		for (const StyleSheetNode* node : styled_node_index.other)
+			AddApplicableNode(node);
 
-	// Also check all remaining nodes that don't contain any indexed requirements.
-	for (const StyleSheetNode* node : styled_node_index.other)
+		if (match->structural_nodes.empty())
+		{
+			SharedPtr<const ElementDefinition> definition = GetOrCreateElementDefinition(match->nodes);
+			if (match != &non_cached_match)
+				match->definition = definition;
+			return definition;
+		}
+	}
+	else if (match->structural_nodes.empty())
 	{
-		if (node->IsApplicable(element))
+		return match->definition;
+	}
+
+	// Using static to avoid allocations. Make sure we don't call this function recursively.
+	static StyleSheetIndex::NodeList applicable_nodes;
+	applicable_nodes = match->nodes;
+
+	for (const StyleSheetNode* node : match->structural_nodes)
+	{
+		if (node->IsStructurallyApplicable(element))
 			applicable_nodes.push_back(node);
 	}
 
+	return GetOrCreateElementDefinition(applicable_nodes);
+}
+
+SharedPtr<const ElementDefinition> StyleSheet::GetOrCreateElementDefinition(StyleSheetIndex::NodeList& applicable_nodes) const
+{
 	// If this element definition won't actually store any information, don't bother with it.
 	if (applicable_nodes.empty())
 		return nullptr;
@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/Utilities.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetNodeSelector.h"
 #include <algorithm>
@@ -39,54 +40,107 @@ namespace Rml {
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_selectors, bool child_combinator)
 	: parent(parent), tag(tag), id(id), class_names(classes), pseudo_class_names(pseudo_classes), structural_selectors(structural_selectors), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAncestorHashes();
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator)
 	: parent(parent), tag(std::move(tag)), id(std::move(id)), class_names(std::move(classes)), pseudo_class_names(std::move(pseudo_classes)), structural_selectors(std::move(structural_selectors)), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	CalculateAndSetAncestorHashes();
 }
 
-StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const StyleSheetNode& other)
+// Children are only indexed when there are more than this number of them.
+static constexpr size_t ChildIndexThreshold = 16;
+
+static size_t HashRequirements(const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_selectors, bool child_combinator)
 {
-	// See if we match the target child
-	for (const auto& child : children)
+	size_t seed = 0;
+	Utilities::HashCombine(seed, tag);
+	Utilities::HashCombine(seed, id);
+	for (const String& name : classes)
+		Utilities::HashCombine(seed, name);
+	for (const String& name : pseudo_classes)
+		Utilities::HashCombine(seed, name);
+	for (const StructuralSelector& selector : structural_selectors)
 	{
-		if (child->EqualRequirements(other.tag, other.id, other.class_names, other.pseudo_class_names, other.structural_selectors, other.child_combinator))
-			return child.get();
+		Utilities::HashCombine(seed, selector.selector);
+		Utilities::HashCombine(seed, selector.a);
+		Utilities::HashCombine(seed, selector.b);
 	}
+	Utilities::HashCombine(seed, child_combinator);
+	return seed;
+}
 
-	// We don't, so create a new child
-	auto child = MakeUnique<StyleSheetNode>(this, other.tag, other.id, other.class_names, other.pseudo_class_names, other.structural_selectors, other.child_combinator);
-	StyleSheetNode* result = child.get();
+StyleSheetNode* StyleSheetNode::FindChildNode(const String& _tag, const String& _id, const StringList& _classes, const StringList& _pseudo_classes, const StructuralSelectorList& _structural_selectors, bool _child_combinator)
+{
+	if (children.size() <= ChildIndexThreshold)
+	{
+		for (const auto& child : children)
+		{
+			if (child->EqualRequirements(_tag, _id, _classes, _pseudo_classes, _structural_selectors, _child_combinator))
+				return child.get();
+		}
+		return nullptr;
+	}
+
+	// The index is built lazily, this way it also covers children added by other means such as deep copies.
+	if (child_index.size() != children.size())
+	{
+		child_index.clear();
+		for (const auto& child : children)
+		{
+			const size_t hash = HashRequirements(child->tag, child->id, child->class_names, child->pseudo_class_names, child->structural_selectors, child->child_combinator);
+			child_index.emplace(hash, child.get());
+		}
+	}
 
+	const auto range = child_index.equal_range(HashRequirements(_tag, _id, _classes, _pseudo_classes, _structural_selectors, _child_combinator));
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second->EqualRequirements(_tag, _id, _classes, _pseudo_classes, _structural_selectors, _child_combinator))
+			return it->second;
+	}
+	return nullptr;
+}
+
+StyleSheetNode* StyleSheetNode::AddChildNode(UniquePtr<StyleSheetNode> child)
+{
+	StyleSheetNode* result = child.get();
 	children.push_back(std::move(child));
 
+	// Keep the index up to date once it is in use.
+	if (!child_index.empty() && child_index.size() + 1 == children.size())
+		child_index.emplace(HashRequirements(result->tag, result->id, result->class_names, result->pseudo_class_names, result->structural_selectors, result->child_combinator), result);
+
 	return result;
 }
 
-StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_pseudo_classes, bool child_combinator)
+StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const StyleSheetNode& other)
 {
-	// See if we match an existing child
-	for (const auto& child : children)
-	{
-		if (child->EqualRequirements(tag, id, classes, pseudo_classes, structural_pseudo_classes, child_combinator))
-			return child.get();
-	}
+	// See if we match the target child
+	if (StyleSheetNode* child = FindChildNode(other.tag, other.id, other.class_names, other.pseudo_class_names, other.structural_selectors, other.child_combinator))
+		return child;
 
 	// We don't, so create a new child
-	auto child = MakeUnique<StyleSheetNode>(this, std::move(tag), std::move(id), std::move(classes), std::move(pseudo_classes), std::move(structural_pseudo_classes), child_combinator);
-	StyleSheetNode* result = child.get();
+	return AddChildNode(MakeUnique<StyleSheetNode>(this, other.tag, other.id, other.class_names, other.pseudo_class_names, other.structural_selectors, other.child_combinator));
+}
 
-	children.push_back(std::move(child));
+StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_pseudo_classes, bool child_combinator)
+{
+	// See if we match an existing child
+	if (StyleSheetNode* child = FindChildNode(tag, id, classes, pseudo_classes, structural_pseudo_classes, child_combinator))
+		return child;
 
-	return result;
+	// We don't, so create a new child
+	return AddChildNode(MakeUnique<StyleSheetNode>(this, std::move(tag), std::move(id), std::move(classes), std::move(pseudo_classes), std::move(structural_pseudo_classes), child_combinator));
 }
 
 // Merges an entire tree hierarchy into our hierarchy.
@@ -262,6 +316,18 @@ inline bool StyleSheetNode::MatchStructuralSelector(const Element* element) cons
 
 // Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
 bool StyleSheetNode::IsApplicable(const Element* const in_element) const
+{
+	if (!IsApplicableIgnoringStructural(in_element, nullptr))
+		return false;
+
+	// Finally, check the structural selector requirements last as they can be quite slow.
+	if (!MatchStructuralSelector(in_element))
+		return false;
+
+	return true;
+}
+
+bool StyleSheetNode::IsApplicableIgnoringStructural(const Element* const in_element, const AncestorFilter* filter) const
 {
 	// Determine whether the element matches the current node and its entire lineage. The entire hierarchy of
 	// the element's document will be considered during the match as necessary.
@@ -284,6 +350,10 @@ bool StyleSheetNode::IsApplicable(const Element* const in_element) const
 	if (!id.empty() && id != in_element->GetId())
 		return false;
 
+	// Before walking the ancestors, see if they could possibly contain all the tags, ids, and classes we need.
+	if (filter && !filter->MayContainAll(ancestor_hashes))
+		return false;
+
 	const Element* element = in_element;
 
 	// Walk up through all our parent nodes, each one of them must be matched by some ancestor element.
@@ -304,13 +374,19 @@ bool StyleSheetNode::IsApplicable(const Element* const in_element) const
 			return false;
 	}
 
-	// Finally, check the structural selector requirements last as they can be quite slow.
-	if (!MatchStructuralSelector(in_element))
-		return false;
-
 	return true;
 }
 
+bool StyleSheetNode::IsStructurallyApplicable(const Element* element) const
+{
+	return MatchStructuralSelector(element);
+}
+
+bool StyleSheetNode::HasStructuralSelectors() const
+{
+	return !structural_selectors.empty();
+}
+
 bool StyleSheetNode::IsStructurallyVolatile() const
 {
 	return is_structurally_volatile;
@@ -338,4 +414,21 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void StyleSheetNode::CalculateAndSetAncestorHashes()
+{
+	// The root node does not represent any element, thus neither it nor its children add any requirements on the ancestors.
+	ancestor_hashes.clear();
+	if (!parent || !parent->parent)
+		return;
+
+	ancestor_hashes = parent->ancestor_hashes;
+
+	if (!parent->tag.empty())
+		AncestorFilter::AddTagHash(ancestor_hashes, parent->tag);
+	if (!parent->id.empty())
+		AncestorFilter::AddIdHash(ancestor_hashes, parent->id);
+	for (const String& name : parent->class_names)
+		AncestorFilter::AddClassHash(ancestor_hashes, name);
+}
+
 } // namespace Rml
@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include "AncestorFilter.h"
 #include <tuple>
 
 namespace Rml {
@@ -90,6 +91,13 @@ public:
 
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
 	bool IsApplicable(const Element* element) const;
+	/// Returns true if this node is applicable to the given element, except for its own structural selectors.
+	/// @param[in] filter If set, used to reject the node when the ancestors required by its selector are not present.
+	bool IsApplicableIgnoringStructural(const Element* element, const AncestorFilter* filter) const;
+	/// Returns true if the node's own structural selectors are applicable to the given element.
+	bool IsStructurallyApplicable(const Element* element) const;
+	/// Returns true if this node has any structural selectors of its own.
+	bool HasStructuralSelectors() const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
@@ -99,10 +107,15 @@ public:
 	bool IsStructurallyVolatile() const;
 
 private:
+	// Adds a new child node, and returns it.
+	StyleSheetNode* AddChildNode(UniquePtr<StyleSheetNode> child);
+	// Returns the child with the given requirements, or nullptr if there is none.
+	StyleSheetNode* FindChildNode(const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_selectors, bool child_combinator);
 	// Returns true if the requirements of this node equals the given arguments.
 	bool EqualRequirements(const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_pseudo_classes, bool child_combinator) const;
 
 	void CalculateAndSetSpecificity();
+	void CalculateAndSetAncestorHashes();
 
 	// Match an element to the local node requirements.
 	inline bool Match(const Element* element) const;
@@ -120,6 +133,9 @@ private:
 	StructuralSelectorList structural_selectors; // Represents structural pseudo classes
 	bool child_combinator = false; // The '>' combinator: This node only matches if the element is a parent of the previous matching element.
 
+	// Hashes of the tags, ids, and classes required on the element's ancestors by the parent nodes.
+	AncestorFilter::HashList ancestor_hashes;
+
 	// True if any ancestor, descendent, or self is a structural pseudo class.
 	bool is_structurally_volatile = true;
 
@@ -130,6 +146,10 @@ private:
 	PropertyDictionary properties;
 
 	StyleSheetNodeList children;
+
+	// Children indexed by the hash of their requirements. Only built for nodes with many children, such as the root node of
+	// large style sheets, where searching through all the children for every new rule would be quadratic.
+	UnorderedMultimap<size_t, StyleSheetNode*> child_index;
 };
 
 } // namespace Rml
@@ -44,6 +44,12 @@ void Texture::Set(const String& name, const TextureCallback& callback)
 	resource->Set(name, callback);
 }
 
+void Texture::UpdateRegion(const byte* source, Vector2i offset, Vector2i dimensions)
+{
+	if (resource)
+		resource->UpdateRegion(source, offset, dimensions);
+}
+
 // Returns the texture's source name. This is usually the name of the file the texture was loaded from.
 const String& Texture::GetSource() const
 {
@@ -72,6 +78,16 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	return resource->GetDimensions(render_interface);
 }
 
+bool Texture::IsLoaded() const
+{
+	return resource && resource->IsLoaded();
+}
+
+bool Texture::IsLoading(RenderInterface* render_interface) const
+{
+	return resource && resource->IsLoading(render_interface);
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
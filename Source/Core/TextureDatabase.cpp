@@ -28,9 +28,12 @@
 
 #include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "TextureLoader.h"
 #include "TextureResource.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -46,6 +49,9 @@ TextureDatabase::~TextureDatabase()
 {
 	RMLUI_ASSERT(texture_database == this);
 
+	// Stop the background loader first, it holds the placeholder texture and references the textures being loaded.
+	texture_loader.reset();
+
 #ifdef RMLUI_DEBUG
 	// All textures not owned by the database should have been released at this point.
 	int num_leaks_file = 0;
@@ -107,6 +113,115 @@ void TextureDatabase::RemoveCallbackTexture(TextureResource* texture)
 		texture_database->callback_textures.erase(texture);
 }
 
+void TextureDatabase::SetAsyncLoading(int upload_budget, const String& placeholder_source)
+{
+	if (!texture_database)
+		return;
+
+	texture_database->texture_loader.reset();
+
+	if (upload_budget > 0)
+		texture_database->texture_loader = MakeUnique<TextureLoader>(upload_budget, placeholder_source);
+}
+
+TextureLoader* TextureDatabase::GetTextureLoader()
+{
+	return texture_database ? texture_database->texture_loader.get() : nullptr;
+}
+
+void TextureDatabase::SetMemoryBudget(size_t budget, int min_unused_frames)
+{
+	if (!texture_database)
+		return;
+
+	texture_database->memory_budget = budget;
+	texture_database->min_unused_frames = Math::Max(min_unused_frames, 1);
+}
+
+TextureMemoryStatistics TextureDatabase::GetMemoryStatistics()
+{
+	TextureMemoryStatistics statistics;
+	if (!texture_database)
+		return statistics;
+
+	auto add_texture = [&statistics](const TextureResource* texture) {
+		const size_t size = texture->GetMemorySize();
+		if (size == 0)
+			return;
+
+		statistics.textures.push_back(TextureMemoryStatistics::Entry{texture->GetSource(), size, texture->GetLastUsedFrame()});
+		statistics.total_size += size;
+	};
+
+	for (const auto& texture : texture_database->textures)
+		add_texture(texture.second.get());
+	for (const TextureResource* texture : texture_database->callback_textures)
+		add_texture(texture);
+
+	std::sort(statistics.textures.begin(), statistics.textures.end(),
+		[](const TextureMemoryStatistics::Entry& a, const TextureMemoryStatistics::Entry& b) { return a.size > b.size; });
+
+	statistics.budget = texture_database->memory_budget;
+	statistics.frame = texture_database->frame;
+
+	return statistics;
+}
+
+void TextureDatabase::NextFrame()
+{
+	if (!texture_database)
+		return;
+
+	TextureDatabase& database = *texture_database;
+	const int current_frame = database.frame;
+	database.frame += 1;
+
+	if (database.memory_budget == 0)
+		return;
+
+	struct Candidate {
+		TextureResource* texture;
+		size_t size;
+		int last_used_frame;
+	};
+	Vector<Candidate> candidates;
+	size_t total_size = 0;
+
+	auto add_texture = [&](TextureResource* texture) {
+		const size_t size = texture->GetMemorySize();
+		total_size += size;
+		if (size > 0 && current_frame - texture->GetLastUsedFrame() >= database.min_unused_frames)
+			candidates.push_back(Candidate{texture, size, texture->GetLastUsedFrame()});
+	};
+
+	for (const auto& texture : database.textures)
+		add_texture(texture.second.get());
+	for (TextureResource* texture : database.callback_textures)
+		add_texture(texture);
+
+	if (total_size <= database.memory_budget)
+		return;
+
+	// Release the least recently used textures first, and the largest ones among those used in the same frame.
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+		return a.last_used_frame < b.last_used_frame || (a.last_used_frame == b.last_used_frame && a.size > b.size);
+	});
+
+	for (const Candidate& candidate : candidates)
+	{
+		if (total_size <= database.memory_budget)
+			break;
+
+		candidate.texture->ReleaseHandles();
+		total_size -= candidate.size;
+	}
+}
+
+int TextureDatabase::GetFrame()
+{
+	return texture_database ? texture_database->frame : 0;
+}
+
 StringList TextureDatabase::GetSourceList()
 {
 	StringList result;
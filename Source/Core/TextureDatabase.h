@@ -29,11 +29,13 @@
 #ifndef RMLUI_CORE_TEXTUREDATABASE_H
 #define RMLUI_CORE_TEXTUREDATABASE_H
 
+#include "../../Include/RmlUi/Core/Texture.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
 class RenderInterface;
+class TextureLoader;
 class TextureResource;
 
 /**
@@ -60,6 +62,21 @@ public:
 	/// Removes a callback texture from the database.
 	static void RemoveCallbackTexture(TextureResource* texture);
 
+	/// Enables loading texture files in the background, see Rml::SetAsyncTextureLoading(). Textures already being loaded are cancelled.
+	static void SetAsyncLoading(int upload_budget, const String& placeholder_source);
+	/// Returns the loader of texture files in the background, or nullptr if it is disabled.
+	static TextureLoader* GetTextureLoader();
+
+	/// Sets the memory budget of all textures, see Rml::SetTextureMemoryBudget().
+	static void SetMemoryBudget(size_t budget, int min_unused_frames);
+	/// Returns the size and last use of all textures held by any render interface.
+	static TextureMemoryStatistics GetMemoryStatistics();
+
+	/// Finishes the current frame, releasing the least recently used textures if the memory budget is exceeded.
+	static void NextFrame();
+	/// Returns the current frame, used for tracking when textures were last used.
+	static int GetFrame();
+
 	/// Return a list of all texture sources currently in the database.
 	static StringList GetSourceList();
 
@@ -75,6 +92,12 @@ private:
 
 	using CallbackTextureMap = UnorderedSet<TextureResource*>;
 	CallbackTextureMap callback_textures;
+
+	UniquePtr<TextureLoader> texture_loader;
+
+	size_t memory_budget = 0;
+	int min_unused_frames = 1;
+	int frame = 0;
 };
 
 } // namespace Rml
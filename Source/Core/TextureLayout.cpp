@@ -25,23 +25,16 @@
  * THE SOFTWARE.
  *
  */
-
 #include "TextureLayout.h"
-#include "TextureLayoutRectangle.h"
-#include "TextureLayoutTexture.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include <algorithm>
 
 namespace Rml {
 
-struct RectangleSort
-{
-	bool operator()(const TextureLayoutRectangle& lhs, const TextureLayoutRectangle& rhs) const
-	{
-		return lhs.GetDimensions().y > rhs.GetDimensions().y;
-	}
-};
+// The smallest area used when estimating the dimensions of a new texture, avoids repeatedly enlarging tiny textures.
+static constexpr int min_texture_square_pixels = 128 * 128;
 
-TextureLayout::TextureLayout()
+TextureLayout::TextureLayout(int max_texture_dimensions) : max_texture_dimensions(max_texture_dimensions)
 {
 }
 
@@ -49,34 +42,109 @@ TextureLayout::~TextureLayout()
 {
 }
 
-// Adds a rectangle to the list of rectangles to be laid out.
-void TextureLayout::AddRectangle(int id, Vector2i dimensions)
+// Positions new rectangles in the layout.
+bool TextureLayout::AddRectangles(Vector<TextureLayoutRectangle>& rectangles)
 {
-	rectangles.push_back(TextureLayoutRectangle(id, dimensions));
-}
+	// Place the rectangles in order of decreasing height, which keeps the shelves tightly packed.
+	Vector<int> order(rectangles.size());
+	int square_pixels = 0;
+	for (int i = 0; i < (int)rectangles.size(); ++i)
+	{
+		order[i] = i;
+		square_pixels += (rectangles[i].dimensions.x + 1) * (rectangles[i].dimensions.y + 1);
+	}
 
-// Returns one of the layout's rectangles.
-TextureLayoutRectangle& TextureLayout::GetRectangle(int index)
-{
-	RMLUI_ASSERT(index >= 0);
-	RMLUI_ASSERT(index < GetNumRectangles());
+	std::stable_sort(order.begin(), order.end(),
+		[&rectangles](int lhs, int rhs) { return rectangles[lhs].dimensions.y > rectangles[rhs].dimensions.y; });
 
-	return rectangles[index];
-}
+	bool result = true;
 
-// Returns the number of rectangles in the layout.
-int TextureLayout::GetNumRectangles() const
-{
-	return (int) rectangles.size();
+	for (int index : order)
+	{
+		TextureLayoutRectangle& rectangle = rectangles[index];
+		rectangle.texture_index = -1;
+
+		if (rectangle.dimensions.x + 2 > max_texture_dimensions || rectangle.dimensions.y + 2 > max_texture_dimensions)
+		{
+			result = false;
+			continue;
+		}
+
+		// Look for free space in the existing textures.
+		for (int i = 0; i < (int)textures.size(); ++i)
+		{
+			if (PlaceRectangle(textures[i], rectangle.dimensions, rectangle.position))
+			{
+				rectangle.texture_index = i;
+				break;
+			}
+		}
+
+		if (rectangle.texture_index < 0)
+		{
+			if (textures.empty())
+			{
+				// Come up with an estimate for how big a texture we need. Square-root the total square pixels required by the remaining
+				// rectangles to get the dimensions of the smallest texture necessary (under optimal circumstances), and round it up to
+				// the nearest power of two. This leaves some room for adding rectangles later, and the texture is enlarged below if the
+				// estimate proves too small.
+				const int texture_width = Math::RealToInteger(Math::SquareRoot((float)Math::Max(square_pixels, min_texture_square_pixels)));
+
+				LayoutTexture texture;
+				texture.dimensions = Vector2i(Math::Min(Math::ToPowerOfTwo(texture_width), max_texture_dimensions));
+				textures.push_back(std::move(texture));
+			}
+
+			// Enlarge the last texture until the rectangle fits, as long as we're within the maximum texture dimensions. Each
+			// enlargement invalidates the texture coordinates of its existing rectangles, so grow in large steps.
+			LayoutTexture& texture = textures.back();
+			for (;;)
+			{
+				if (PlaceRectangle(texture, rectangle.dimensions, rectangle.position))
+				{
+					rectangle.texture_index = (int)textures.size() - 1;
+					break;
+				}
+
+				if (texture.dimensions.x >= max_texture_dimensions && texture.dimensions.y >= max_texture_dimensions)
+					break;
+
+				texture.dimensions.x = Math::Min(texture.dimensions.x * 2, max_texture_dimensions);
+				texture.dimensions.y = Math::Min(texture.dimensions.y * 2, max_texture_dimensions);
+			}
+		}
+
+		if (rectangle.texture_index < 0)
+		{
+			// All the textures are full. Any further textures are likely to fill up as well, so start them out at the maximum
+			// dimensions instead of enlarging them as they go.
+			LayoutTexture texture;
+			texture.dimensions = Vector2i(max_texture_dimensions);
+
+			if (PlaceRectangle(texture, rectangle.dimensions, rectangle.position))
+			{
+				rectangle.texture_index = (int)textures.size();
+				textures.push_back(std::move(texture));
+			}
+			else
+			{
+				result = false;
+			}
+		}
+
+		square_pixels -= (rectangle.dimensions.x + 1) * (rectangle.dimensions.y + 1);
+	}
+
+	return result;
 }
 
-// Returns one of the layout's textures.
-TextureLayoutTexture& TextureLayout::GetTexture(int index)
+// Returns the dimensions of one of the layout's textures.
+Vector2i TextureLayout::GetTextureDimensions(int index) const
 {
 	RMLUI_ASSERT(index >= 0);
 	RMLUI_ASSERT(index < GetNumTextures());
 
-	return textures[index];
+	return textures[index].dimensions;
 }
 
 // Returns the number of textures in the layout.
@@ -85,24 +153,34 @@ int TextureLayout::GetNumTextures() const
 	return (int) textures.size();
 }
 
-// Attempts to generate an efficient texture layout for the rectangles.
-bool TextureLayout::GenerateLayout(int max_texture_dimensions)
+bool TextureLayout::PlaceRectangle(LayoutTexture& texture, const Vector2i dimensions, Vector2i& out_position)
 {
-	// Sort the rectangles by height.
-	std::sort(rectangles.begin(), rectangles.end(), RectangleSort());
+	// Rectangles are separated by one pixel of padding, and the texture borders are padded as well.
+	const Vector2i padded_dimensions = dimensions + Vector2i(1);
 
-	int num_placed_rectangles = 0;
-	while (num_placed_rectangles != GetNumRectangles())
+	// Find the shelf with the least height to spare that still has room for the rectangle.
+	Shelf* best_shelf = nullptr;
+	for (Shelf& shelf : texture.shelves)
 	{
-		TextureLayoutTexture texture;
-		int texture_size = texture.Generate(*this, max_texture_dimensions);
-		if (texture_size == 0)
+		if (dimensions.y <= shelf.height && shelf.x + padded_dimensions.x <= texture.dimensions.x &&
+			(!best_shelf || shelf.height < best_shelf->height))
+			best_shelf = &shelf;
+	}
+
+	if (!best_shelf)
+	{
+		// Open a new shelf below the existing ones.
+		if (texture.shelves_end + padded_dimensions.y > texture.dimensions.y || 1 + padded_dimensions.x > texture.dimensions.x)
 			return false;
 
-		textures.push_back(texture);
-		num_placed_rectangles += texture_size;
+		texture.shelves.push_back(Shelf{texture.shelves_end, dimensions.y, 1});
+		texture.shelves_end += padded_dimensions.y;
+		best_shelf = &texture.shelves.back();
 	}
 
+	out_position = Vector2i(best_shelf->x, best_shelf->y);
+	best_shelf->x += padded_dimensions.x;
+
 	return true;
 }
 
@@ -25,18 +25,34 @@
  * THE SOFTWARE.
  *
  */
-
 #ifndef TEXTURELAYOUT_H
 #define TEXTURELAYOUT_H
 
-#include "TextureLayoutRectangle.h"
-#include "TextureLayoutTexture.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
 /**
-	A texture layout generates and stores a layout of rectangles within a series of textures. It is
-	used primarily by the font system for generating font textures.
+	The placement of a single rectangle within a texture layout.
+ */
+
+struct TextureLayoutRectangle
+{
+	// The index of the texture the rectangle is placed in, or -1 if it has not been placed.
+	int texture_index = -1;
+	// The position of the rectangle's top-left corner within its texture, in pixels.
+	Vector2i position;
+	// The dimensions of the rectangle, in pixels.
+	Vector2i dimensions;
+};
+
+/**
+	A texture layout positions rectangles within a series of textures. It is used primarily by the
+	font system for generating font textures.
+
+	Rectangles are packed into shelves, and can be added to the layout at any time. Once placed, a
+	rectangle never moves. However, the last texture may be enlarged to make room for new rectangles,
+	which changes the normalized texture coordinates of any rectangles already placed within it.
 
 	@author Peter
  */
@@ -44,42 +60,47 @@ namespace Rml {
 class TextureLayout
 {
 public:
-	TextureLayout();
+	/// Constructs an empty layout.
+	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
+	TextureLayout(int max_texture_dimensions = 1024);
 	~TextureLayout();
 
-	/// Adds a rectangle to the list of rectangles to be laid out. All rectangles must be added to
-	/// the layout before the layout is generated.
-	/// @param[in] id The id of the rectangle; used to identify the rectangle after it has been positioned.
-	/// @param[in] dimensions The dimensions of the rectangle.
-	void AddRectangle(int id, Vector2i dimensions);
-
-	/// Returns one of the layout's rectangles.
-	/// @param[in] index The index of the desired rectangle.
-	/// @return The desired rectangle.
-	TextureLayoutRectangle& GetRectangle(int index);
-	/// Returns the number of rectangles in the layout.
-	/// @return The layout's rectangle count.
-	int GetNumRectangles() const;
-
-	/// Returns one of the layout's textures.
+	/// Positions new rectangles in the layout. Rectangles are placed within the free space of existing
+	/// textures where possible, otherwise the last texture is enlarged or a new texture is added.
+	/// @param[in,out] rectangles The rectangles to place, with their dimensions set. On return, the texture index and position of each placed rectangle is set.
+	/// @return True if all the rectangles were placed, false if any rectangle exceeded the maximum texture dimensions.
+	bool AddRectangles(Vector<TextureLayoutRectangle>& rectangles);
+
+	/// Returns the dimensions of one of the layout's textures.
 	/// @param[in] index The index of the desired texture.
-	/// @return The desired texture.
-	TextureLayoutTexture& GetTexture(int index);
+	/// @return The dimensions of the texture.
+	Vector2i GetTextureDimensions(int index) const;
 	/// Returns the number of textures in the layout.
 	/// @return The layout's texture count.
 	int GetNumTextures() const;
 
-	/// Attempts to generate an efficient texture layout for the rectangles.
-	/// @param[in] max_texture_dimensions The maximum dimensions allowed for any single texture.
-	/// @return True if the layout was generated successfully, false if not.
-	bool GenerateLayout(int max_texture_dimensions);
-
 private:
-	using RectangleList = Vector< TextureLayoutRectangle >;
-	using TextureList = Vector< TextureLayoutTexture >;
+	struct Shelf {
+		// The y-coordinate and height of the shelf.
+		int y;
+		int height;
+		// The x-coordinate of the free space at the end of the shelf.
+		int x;
+	};
+
+	struct LayoutTexture {
+		Vector2i dimensions;
+		Vector<Shelf> shelves;
+		// The y-coordinate of the free space below the last shelf.
+		int shelves_end = 1;
+	};
+
+	// Attempts to place a rectangle within the free space of the given texture, without resizing it.
+	static bool PlaceRectangle(LayoutTexture& texture, Vector2i dimensions, Vector2i& out_position);
+
+	int max_texture_dimensions;
 
-	TextureList textures;
-	RectangleList rectangles;
+	Vector<LayoutTexture> textures;
 };
 
 } // namespace Rml
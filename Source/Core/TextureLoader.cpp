@@ -0,0 +1,182 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureLoader.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "TextureResource.h"
+
+namespace Rml {
+
+static Element* requesting_element = nullptr;
+
+TextureLoader::TextureLoader(int upload_budget, const String& placeholder_source) :
+	upload_budget(upload_budget), worker_pool(WorkerPool::GetDefaultNumThreads())
+{
+	// The placeholder is generated through a callback, so that it is always loaded directly.
+	if (!placeholder_source.empty())
+	{
+		placeholder.Set(placeholder_source, [](RenderInterface* render_interface, const String& source, TextureHandle& handle, Vector2i& dimensions) {
+			return render_interface->LoadTexture(handle, dimensions, source);
+		});
+	}
+}
+
+TextureLoader::~TextureLoader()
+{
+	for (const SharedPtr<TextureLoadRequest>& request : requests)
+		Cancel(*request);
+}
+
+void TextureLoader::Request(SharedPtr<TextureLoadRequest>& request, TextureResource* texture, RenderInterface* render_interface)
+{
+	if (!request)
+	{
+		request = MakeShared<TextureLoadRequest>();
+		request->texture = texture;
+		request->render_interface = render_interface;
+		request->source = texture->GetSource();
+		requests.push_back(request);
+
+		worker_pool.Submit([request]() {
+			TextureLoadRequest::State expected = TextureLoadRequest::State::Queued;
+			if (!request->state.compare_exchange_strong(expected, TextureLoadRequest::State::Decoding))
+				return;
+
+			const bool result = request->render_interface->DecodeTexture(request->data, request->dimensions, request->source);
+
+			expected = TextureLoadRequest::State::Decoding;
+			request->state.compare_exchange_strong(expected, result ? TextureLoadRequest::State::Decoded : TextureLoadRequest::State::Failed);
+		});
+	}
+
+	if (requesting_element)
+	{
+		ObserverPtr<Element>& requester = request->requesters[requesting_element];
+		if (!requester)
+			requester = requesting_element->GetObserverPtr();
+	}
+	else
+	{
+		request->anonymous_requester = true;
+	}
+}
+
+void TextureLoader::Process(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& loaded_elements)
+{
+	if (requests.empty())
+		return;
+
+	RMLUI_ZoneScoped;
+
+	int remaining_budget = upload_budget;
+	bool generated_texture = false;
+
+	// Keep the remaining requests in order, while removing finished and cancelled ones.
+	size_t num_remaining = 0;
+	for (size_t i = 0; i < requests.size(); i++)
+	{
+		SharedPtr<TextureLoadRequest>& request = requests[i];
+		const TextureLoadRequest::State state = request->state.load();
+
+		bool keep = true;
+		if (state == TextureLoadRequest::State::Cancelled)
+		{
+			keep = false;
+		}
+		else if (request->render_interface == render_interface)
+		{
+			if (IsRequestAbandoned(*request))
+			{
+				Cancel(*request);
+				keep = false;
+			}
+			else if ((state == TextureLoadRequest::State::Decoded || state == TextureLoadRequest::State::Failed) &&
+				(!generated_texture || remaining_budget > 0))
+			{
+				const Vector2i dimensions = request->texture->GenerateLoadedTexture(render_interface, *request);
+				remaining_budget -= 4 * dimensions.x * dimensions.y;
+				generated_texture = true;
+
+				for (auto& requester : request->requesters)
+				{
+					if (requester.second)
+						loaded_elements.push_back(requester.second);
+				}
+				keep = false;
+			}
+		}
+
+		if (keep)
+		{
+			if (num_remaining != i)
+				requests[num_remaining] = std::move(request);
+			num_remaining += 1;
+		}
+	}
+
+	requests.resize(num_remaining);
+}
+
+TextureHandle TextureLoader::GetPlaceholderHandle(RenderInterface* render_interface) const
+{
+	return placeholder ? placeholder.GetHandle(render_interface) : TextureHandle(0);
+}
+
+void TextureLoader::Cancel(TextureLoadRequest& request)
+{
+	if (request.state.exchange(TextureLoadRequest::State::Cancelled) != TextureLoadRequest::State::Cancelled)
+		request.texture->load_requests.erase(request.render_interface);
+}
+
+bool TextureLoader::IsRequestAbandoned(const TextureLoadRequest& request)
+{
+	if (request.anonymous_requester)
+		return false;
+
+	for (const auto& requester : request.requesters)
+	{
+		if (requester.second && requester.second->GetOwnerDocument())
+			return false;
+	}
+
+	return true;
+}
+
+TextureLoader::RequesterScope::RequesterScope(Element* element) : previous_requester(requesting_element)
+{
+	requesting_element = element;
+}
+
+TextureLoader::RequesterScope::~RequesterScope()
+{
+	requesting_element = previous_requester;
+}
+
+} // namespace Rml
@@ -0,0 +1,115 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TEXTURELOADER_H
+#define RMLUI_CORE_TEXTURELOADER_H
+
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include "WorkerPool.h"
+#include <atomic>
+
+namespace Rml {
+
+class RenderInterface;
+class TextureResource;
+
+/*
+    A texture file being loaded in the background. The texture data is decoded on a worker thread, everything else is only accessed on the
+    main thread.
+*/
+struct TextureLoadRequest : NonCopyMoveable {
+	enum class State { Queued, Decoding, Decoded, Failed, Cancelled };
+
+	// Only valid as long as the request is not cancelled, which is done when the texture is released.
+	TextureResource* texture = nullptr;
+	RenderInterface* render_interface = nullptr;
+	String source;
+
+	// The elements waiting for the texture. Requests made outside any element are never cancelled.
+	SmallUnorderedMap<Element*, ObserverPtr<Element>> requesters;
+	bool anonymous_requester = false;
+
+	std::atomic<State> state{State::Queued};
+
+	// Written by the worker thread before the state is set to decoded.
+	Vector<byte> data;
+	Vector2i dimensions;
+};
+
+/**
+    Loads texture files in the background, see Rml::SetAsyncTextureLoading().
+
+    Texture files are decoded on worker threads through the render interface. The decoded textures are then generated in the order they were
+    requested, during the context update and within the upload budget. Requests are dropped when all the elements that requested them have been
+    removed from their document.
+ */
+
+class TextureLoader : NonCopyMoveable {
+public:
+	TextureLoader(int upload_budget, const String& placeholder_source);
+	~TextureLoader();
+
+	/// Starts loading the texture in the background, unless it is already being loaded. Registers the current requesting element, if any.
+	/// @param[in,out] request The request of the texture for the given render interface, created if it is empty.
+	void Request(SharedPtr<TextureLoadRequest>& request, TextureResource* texture, RenderInterface* render_interface);
+
+	/// Generates the decoded textures of the given render interface within the upload budget, and drops requests of removed elements.
+	/// @param[out] loaded_elements The elements waiting for the generated textures.
+	void Process(RenderInterface* render_interface, Vector<ObserverPtr<Element>>& loaded_elements);
+
+	/// Returns the handle of the placeholder texture, or zero if there is none.
+	TextureHandle GetPlaceholderHandle(RenderInterface* render_interface) const;
+
+	/// Sets the element requesting textures during its layout or rendering, which is notified when textures loaded in the background are ready.
+	class RequesterScope : NonCopyMoveable {
+	public:
+		RequesterScope(Element* element);
+		~RequesterScope();
+
+	private:
+		Element* previous_requester;
+	};
+
+private:
+	static void Cancel(TextureLoadRequest& request);
+	static bool IsRequestAbandoned(const TextureLoadRequest& request);
+
+	int upload_budget;
+	Texture placeholder;
+
+	// All unfinished requests, in the order they were made.
+	Vector<SharedPtr<TextureLoadRequest>> requests;
+
+	WorkerPool worker_pool;
+};
+
+} // namespace Rml
+#endif
@@ -28,6 +28,8 @@
 
 #include "TextureResource.h"
 #include "TextureDatabase.h"
+#include "FrameProfiler.h"
+#include "TextureLoader.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -73,9 +75,14 @@ void TextureResource::Reset()
 // Returns the resource's underlying texture.
 TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 {
+	last_used_frame = TextureDatabase::GetFrame();
+
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
+		if (LoadAsync(render_interface))
+			return TextureDatabase::GetTextureLoader()->GetPlaceholderHandle(render_interface);
+
 		Load(render_interface);
 		texture_iterator = texture_data.find(render_interface);
 	}
@@ -89,6 +96,9 @@ Vector2i TextureResource::GetDimensions(RenderInterface* render_interface)
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
+		if (LoadAsync(render_interface))
+			return Vector2i(0, 0);
+
 		Load(render_interface);
 		texture_iterator = texture_data.find(render_interface);
 	}
@@ -96,15 +106,54 @@ Vector2i TextureResource::GetDimensions(RenderInterface* render_interface)
 	return texture_iterator->second.second;
 }
 
+bool TextureResource::IsLoaded() const
+{
+	return !texture_data.empty();
+}
+
+bool TextureResource::IsLoading(RenderInterface* render_interface) const
+{
+	return load_requests.count(render_interface) != 0;
+}
+
 // Returns the resource's source.
 const String& TextureResource::GetSource() const
 {
 	return source;
 }
 
+void TextureResource::UpdateRegion(const byte* source, Vector2i offset, Vector2i dimensions)
+{
+	RMLUI_ASSERT(texture_callback);
+
+	Vector<RenderInterface*> failed_render_interfaces;
+
+	for (auto& interface_data_pair : texture_data)
+	{
+		TextureHandle handle = interface_data_pair.second.first;
+		if (handle && !interface_data_pair.first->UpdateTexture(handle, source, offset, dimensions))
+			failed_render_interfaces.push_back(interface_data_pair.first);
+	}
+
+	// The callback generates the texture including the updated region, thus release the texture to have it generated again on next use.
+	for (RenderInterface* render_interface : failed_render_interfaces)
+		Release(render_interface);
+}
+
 // Releases the texture's handle.
 void TextureResource::Release(RenderInterface* render_interface)
 {
+	// Cancel any textures being loaded in the background, they are discarded when they are finished.
+	for (auto& request_pair : load_requests)
+	{
+		if (!render_interface || request_pair.first == render_interface)
+			request_pair.second->state = TextureLoadRequest::State::Cancelled;
+	}
+	if (!render_interface)
+		load_requests.clear();
+	else
+		load_requests.erase(render_interface);
+
 	if (!render_interface)
 	{
 		for (auto& interface_data_pair : texture_data)
@@ -130,9 +179,40 @@ void TextureResource::Release(RenderInterface* render_interface)
 	}
 }
 
+void TextureResource::ReleaseHandles()
+{
+	for (auto& interface_data_pair : texture_data)
+	{
+		TextureHandle handle = interface_data_pair.second.first;
+		if (handle)
+			interface_data_pair.first->ReleaseTexture(handle);
+	}
+
+	texture_data.clear();
+}
+
+size_t TextureResource::GetMemorySize() const
+{
+	size_t size = 0;
+	for (const auto& interface_data_pair : texture_data)
+	{
+		const Vector2i dimensions = interface_data_pair.second.second;
+		if (interface_data_pair.second.first)
+			size += 4 * size_t(dimensions.x) * size_t(dimensions.y);
+	}
+	return size;
+}
+
+int TextureResource::GetLastUsedFrame() const
+{
+	return last_used_frame;
+}
+
 bool TextureResource::Load(RenderInterface* render_interface)
 {
 	RMLUI_ZoneScoped;
+	FrameProfiler::Count(FrameProfiler::Counter::TexturesGenerated);
+	last_used_frame = TextureDatabase::GetFrame();
 
 	// Generate the texture from the callback function if we have one.
 	if (texture_callback)
@@ -167,4 +247,47 @@ bool TextureResource::Load(RenderInterface* render_interface)
 	return true;
 }
 
+bool TextureResource::LoadAsync(RenderInterface* render_interface)
+{
+	if (texture_callback)
+		return false;
+
+	TextureLoader* texture_loader = TextureDatabase::GetTextureLoader();
+	if (!texture_loader)
+		return false;
+
+	texture_loader->Request(load_requests[render_interface], this, render_interface);
+	return true;
+}
+
+Vector2i TextureResource::GenerateLoadedTexture(RenderInterface* render_interface, const TextureLoadRequest& request)
+{
+	RMLUI_ASSERT(request.texture == this && request.render_interface == render_interface);
+
+	// Keep the request alive until we are done with its data.
+	SharedPtr<TextureLoadRequest> request_ptr = std::move(load_requests[render_interface]);
+	load_requests.erase(render_interface);
+
+	if (request.state != TextureLoadRequest::State::Decoded)
+	{
+		Load(render_interface);
+		return texture_data[render_interface].second;
+	}
+
+	RMLUI_ZoneScoped;
+	FrameProfiler::Count(FrameProfiler::Counter::TexturesGenerated);
+
+	TextureHandle handle = {};
+	if (request.data.empty() || !render_interface->GenerateTexture(handle, request.data.data(), request.dimensions))
+	{
+		Log::Message(Log::LT_WARNING, "Failed to generate texture loaded from %s.", source.c_str());
+		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+		return Vector2i(0, 0);
+	}
+
+	texture_data[render_interface] = TextureData(handle, request.dimensions);
+	last_used_frame = TextureDatabase::GetFrame();
+	return request.dimensions;
+}
+
 } // namespace Rml
@@ -34,6 +34,8 @@
 
 namespace Rml {
 
+struct TextureLoadRequest;
+
 /**
     A texture resource stores application-generated texture data (handle and dimensions) for each
     unique render interface that needs to render the data. It is used through a Texture object.
@@ -59,20 +61,47 @@ public:
 	/// Returns the dimensions of the resource's texture.
 	Vector2i GetDimensions(RenderInterface* render_interface);
 
+	/// Returns true if the texture has been loaded by any render interface.
+	bool IsLoaded() const;
+	/// Returns true while the texture is being loaded in the background for the given render interface.
+	bool IsLoading(RenderInterface* render_interface) const;
+
 	/// Returns the resource's source.
 	const String& GetSource() const;
 
+	/// Updates a region of the texture for all render interfaces holding it, releasing the texture for any render interface that
+	/// cannot update it. Only applies to textures generated through a callback function.
+	void UpdateRegion(const byte* source, Vector2i offset, Vector2i dimensions);
+
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
+	/// Releases the texture's handle for all render interfaces, without cancelling any textures being loaded in the background. The texture
+	/// is loaded or generated again on next use.
+	void ReleaseHandles();
+
+	/// Returns the size in bytes of the texture data held by all render interfaces, assuming four bytes per pixel.
+	size_t GetMemorySize() const;
+	/// Returns the frame of the texture database in which the texture was last rendered or loaded.
+	int GetLastUsedFrame() const;
 
 	/// For debugging. Returns true if the texture holds a reference to the given render interface, otherwise false.
-	inline bool HoldsRenderInterface(RenderInterface* render_interface) const { return texture_data.count(render_interface); }
+	inline bool HoldsRenderInterface(RenderInterface* render_interface) const
+	{
+		return texture_data.count(render_interface) || load_requests.count(render_interface);
+	}
+
+	/// Generates the texture from data decoded in the background, or loads it directly if it could not be decoded.
+	/// @return The dimensions of the texture.
+	Vector2i GenerateLoadedTexture(RenderInterface* render_interface, const TextureLoadRequest& request);
 
 private:
 	void Reset();
 
 	/// Attempts to load the texture from the source, or the callback function if set.
 	bool Load(RenderInterface* render_interface);
+	/// Starts or continues loading the texture in the background, if enabled and the texture is loaded from a file.
+	/// @return True if the texture is being loaded in the background, otherwise it should be loaded directly.
+	bool LoadAsync(RenderInterface* render_interface);
 
 	String source;
 
@@ -81,6 +110,13 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	int last_used_frame = 0;
+
+	using LoadRequestMap = SmallUnorderedMap<RenderInterface*, SharedPtr<TextureLoadRequest>>;
+	LoadRequestMap load_requests;
+
+	friend class TextureLoader;
 };
 
 } // namespace Rml
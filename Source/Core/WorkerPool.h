@@ -0,0 +1,108 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_WORKERPOOL_H
+#define RMLUI_CORE_WORKERPOOL_H
+
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+
+/**
+    A fixed set of threads running submitted jobs in order of submission.
+
+    The pool is used for expensive work off the main thread, such as loading textures in the background and rendering plugin content. Jobs still
+    queued when the pool is destroyed are discarded, while running jobs are finished first.
+ */
+
+class WorkerPool : NonCopyMoveable {
+public:
+	using Job = Function<void()>;
+
+	explicit WorkerPool(int num_threads)
+	{
+		for (int i = 0; i < num_threads; i++)
+			threads.emplace_back([this]() { Run(); });
+	}
+
+	~WorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		condition.notify_all();
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+
+	void Submit(Job job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			jobs.push(std::move(job));
+		}
+		condition.notify_one();
+	}
+
+	/// Returns a number of threads suitable for background work, leaving one core for the main thread.
+	static int GetDefaultNumThreads() { return Math::Clamp(int(std::thread::hardware_concurrency()) - 1, 1, 4); }
+
+private:
+	void Run()
+	{
+		while (true)
+		{
+			Job job;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				condition.wait(lock, [this]() { return stopping || !jobs.empty(); });
+				if (stopping)
+					return;
+				job = std::move(jobs.front());
+				jobs.pop();
+			}
+			job();
+		}
+	}
+
+	std::mutex mutex;
+	std::condition_variable condition;
+	Queue<Job> jobs;
+	bool stopping = false;
+	Vector<std::thread> threads;
+};
+
+} // namespace Rml
+#endif
@@ -0,0 +1,212 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "XMLFragment.h"
+#include "XMLParseTools.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include <algorithm>
+
+namespace Rml {
+
+static const String fragment_root_tag = "body";
+
+// Records the parsed nodes in document order, instead of instancing them as the XMLParser does.
+class XMLFragmentParser : public BaseXMLParser {
+public:
+	XMLFragmentParser(Vector<XMLFragment::Node>& nodes) : nodes(nodes)
+	{
+		// Use the same configuration as the XMLParser.
+		RegisterCDATATag("script");
+
+		for (const String& name : Factory::GetStructuralDataViewAttributeNames())
+			RegisterInnerXMLAttribute(name);
+	}
+
+	bool IsValid() const { return valid && open_nodes.empty() && depth == 0; }
+
+	void HandleElementStart(const String& _name, const XMLAttributes& attributes) override
+	{
+		depth += 1;
+
+		// The outermost tag only wraps the fragment contents.
+		if (depth == 1)
+			return;
+
+		const String name = StringUtilities::ToLower(_name);
+
+		// Custom node handlers can not be replayed from the node list.
+		if (XMLParser::GetNodeHandler(name))
+			valid = false;
+
+		open_nodes.push_back(nodes.size());
+
+		nodes.emplace_back();
+		nodes.back().tag = name;
+		nodes.back().attributes = attributes;
+	}
+
+	void HandleElementEnd(const String& _name) override
+	{
+		depth -= 1;
+		if (depth == 0)
+			return;
+
+		if (open_nodes.empty() || nodes[open_nodes.back()].tag != StringUtilities::ToLower(_name))
+		{
+			// Mismatched tags, let the regular parser report the error.
+			valid = false;
+			return;
+		}
+
+		const size_t index = open_nodes.back();
+		open_nodes.pop_back();
+		nodes[index].num_descendants = int(nodes.size() - index - 1);
+	}
+
+	void HandleData(const String& data, XMLDataType type) override
+	{
+		if (depth == 0)
+			return;
+
+		nodes.emplace_back();
+		nodes.back().data = data;
+		nodes.back().data_type = type;
+	}
+
+private:
+	Vector<XMLFragment::Node>& nodes;
+	Vector<size_t> open_nodes;
+	int depth = 0;
+	bool valid = true;
+};
+
+bool XMLFragment::Compile(const String& rml)
+{
+	RMLUI_ZoneScoped;
+
+	nodes.clear();
+
+	String text;
+	if (SystemInterface* system_interface = GetSystemInterface())
+		system_interface->TranslateString(text, rml);
+
+	// Follow the same steps as Factory::InstanceElementText, only run the XML parser when the text contains RML elements.
+	if (std::all_of(text.begin(), text.end(), &StringUtilities::IsWhitespace))
+		return true;
+
+	bool parse_as_rml = false;
+	bool inside_brackets = false;
+	bool inside_string = false;
+	char previous = 0;
+	for (const char c : text)
+	{
+		// Leave any errors to be reported when the string is instanced directly.
+		if (XMLParseTools::ParseDataBrackets(inside_brackets, inside_string, c, previous))
+			return false;
+
+		if (!inside_brackets && c == '<')
+			parse_as_rml = true;
+
+		previous = c;
+	}
+
+	if (!parse_as_rml)
+	{
+		nodes.emplace_back();
+		nodes.back().data = std::move(text);
+		return true;
+	}
+
+	const String open_tag = "<" + fragment_root_tag + ">";
+	const String close_tag = "</" + fragment_root_tag + ">";
+	StreamMemory stream(open_tag.size() + text.size() + close_tag.size());
+	stream.Write(open_tag);
+	stream.Write(text);
+	stream.Write(close_tag);
+	stream.Seek(0, SEEK_SET);
+
+	XMLFragmentParser parser(nodes);
+	parser.Parse(&stream);
+
+	if (!parser.IsValid())
+	{
+		nodes.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void XMLFragment::Instance(Element* parent) const
+{
+	RMLUI_ZoneScoped;
+	RMLUI_ASSERT(parent);
+
+	InstanceNodes(parent, nodes.data(), nodes.data() + nodes.size());
+}
+
+void XMLFragment::InstanceNodes(Element* parent, const Node* begin, const Node* end)
+{
+	// Mirrors the behavior of XMLNodeHandlerDefault.
+	for (const Node* node = begin; node < end; ++node)
+	{
+		if (node->tag.empty())
+		{
+			// Structural data views use the raw inner xml contents of the node, submit them now.
+			if (node->data_type == XMLDataType::InnerXML && ElementUtilities::ApplyStructuralDataViews(parent, node->data))
+				continue;
+
+			Factory::InstanceElementText(parent, node->data);
+			continue;
+		}
+
+		Element* element = parent;
+
+		if (ElementPtr new_element = Factory::InstanceElement(parent, node->tag, node->tag, node->attributes))
+			element = parent->AppendChild(std::move(new_element));
+		else
+			Log::Message(Log::LT_ERROR, "Failed to create element for tag %s, instancer returned nullptr.", node->tag.c_str());
+
+		const Node* children_begin = node + 1;
+		const Node* children_end = children_begin + node->num_descendants;
+		InstanceNodes(element, children_begin, children_end);
+
+		node = children_end - 1;
+	}
+}
+
+} // namespace Rml
@@ -26,50 +26,51 @@
  *
  */
 
-#ifndef TEXTURELAYOUTTEXTURE_H
-#define TEXTURELAYOUTTEXTURE_H
+#ifndef RMLUI_CORE_XMLFRAGMENT_H
+#define RMLUI_CORE_XMLFRAGMENT_H
 
-#include "../../Include/RmlUi/Core/Texture.h"
-#include "TextureLayoutRow.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
 
-class TextureLayout;
-class TextureResource;
+class Element;
 
 /**
-	A texture layout texture is a single rectangular area which sub-rectangles are placed on within
-	a complete texture layout.
+	A fragment of RML parsed once into a node tree, which can then be instanced any number of times without running the
+	XML parser again. Used by the 'data-for' view to generate the contents of each iteration.
 
-	@author Peter
+	Only fragments where every node is handled by the default node handler can be compiled, since custom node handlers
+	may depend on the parser state. Otherwise, the RML string should be instanced directly.
  */
 
-class TextureLayoutTexture
-{
+class XMLFragment {
 public:
-	TextureLayoutTexture();
-	~TextureLayoutTexture();
+	/// Parses the given RML into the fragment.
+	/// @return False if the RML could not be compiled, in which case the fragment is left empty.
+	bool Compile(const String& rml);
 
-	/// Returns the texture's dimensions. This is only valid after the texture has been generated.
-	/// @return The texture's dimensions.
-	Vector2i GetDimensions() const;
+	/// Instances the fragment as children of the given element, equivalent to Element::SetInnerRML on an empty element.
+	void Instance(Element* parent) const;
 
-	/// Attempts to position unplaced rectangles from the layout into this texture. The size of
-	/// this texture will be determined by its contents.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] maximum_dimensions The maximum dimensions of this texture. If this is not big enough to place all the rectangles, then as many will be placed as possible.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int maximum_dimensions);
+private:
+	struct Node {
+		// Tag name of element nodes, empty for data nodes.
+		String tag;
+		XMLAttributes attributes;
+		// Number of nodes following this one in the list which are contained in this element.
+		int num_descendants = 0;
 
-	/// Allocates the texture.
-	/// @return The allocated texture data.
-	UniquePtr<byte[]> AllocateTexture();
+		String data;
+		XMLDataType data_type = XMLDataType::Text;
+	};
 
-private:
-	using RowList = Vector< TextureLayoutRow >;
+	static void InstanceNodes(Element* parent, const Node* begin, const Node* end);
+
+	// All nodes of the fragment in document order.
+	Vector<Node> nodes;
 
-	Vector2i dimensions;
-	RowList rows;
+	friend class XMLFragmentParser;
 };
 
 } // namespace Rml
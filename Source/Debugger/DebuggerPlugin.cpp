@@ -36,6 +36,7 @@
 #include "ElementContextHook.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementProfiler.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -58,6 +59,7 @@ DebuggerPlugin::DebuggerPlugin()
 	menu_element = nullptr;
 	info_element = nullptr;
 	log_element = nullptr;
+	profiler_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
@@ -84,7 +86,8 @@ bool DebuggerPlugin::Initialise(Context* context)
 
 	if (!LoadMenuElement() ||
 		!LoadInfoElement() ||
-		!LoadLogElement())
+		!LoadLogElement() ||
+		!LoadProfilerElement())
 	{
 		Log::Message(Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -144,6 +147,9 @@ bool DebuggerPlugin::SetContext(Context* context)
 		info_element->Reset();
 	}
 
+	if (profiler_element)
+		profiler_element->SetDebugContext(context);
+
 	debug_context = context;
 	return true;
 }
@@ -274,6 +280,13 @@ void DebuggerPlugin::ProcessEvent(Event& event)
 		{
 			render_outlines = !render_outlines;
 		}
+		else if (event.GetTargetElement()->GetId() == "profiler-button")
+		{
+			if (profiler_element->IsVisible())
+				profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+			else
+				profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
+		}
 	}
 }
 
@@ -323,6 +336,9 @@ bool DebuggerPlugin::LoadMenuElement()
 	Element* outlines_button = menu_element->GetElementById("outlines-button");
 	outlines_button->AddEventListener(EventId::Click, this);
 
+	Element* profiler_button = menu_element->GetElementById("profiler-button");
+	profiler_button->AddEventListener(EventId::Click, this);
+
 	return true;
 }
 
@@ -373,6 +389,29 @@ bool DebuggerPlugin::LoadLogElement()
 	return true;
 }
 
+bool DebuggerPlugin::LoadProfilerElement()
+{
+	profiler_element_instancer = MakeUnique< ElementInstancerGeneric<ElementProfiler> >();
+	Factory::RegisterElementInstancer("debug-profiler", profiler_element_instancer.get());
+	profiler_element = rmlui_dynamic_cast< ElementProfiler* >(host_context->CreateDocument("debug-profiler"));
+	if (!profiler_element)
+		return false;
+
+	profiler_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+
+	if (!profiler_element->Initialise())
+	{
+		host_context->UnloadDocument(profiler_element);
+		profiler_element = nullptr;
+
+		return false;
+	}
+
+	profiler_element->SetDebugContext(debug_context);
+
+	return true;
+}
+
 void DebuggerPlugin::ReleaseElements()
 {
 	if (host_context)
@@ -397,6 +436,12 @@ void DebuggerPlugin::ReleaseElements()
 			application_interface = nullptr;
 			log_interface.reset();
 		}
+
+		if (profiler_element)
+		{
+			host_context->UnloadDocument(profiler_element);
+			profiler_element = nullptr;
+		}
 	}
 
 	if (debug_context)
@@ -642,6 +642,35 @@ void ElementInfo::UpdateSourceElement()
 			children_rml = std::move(children);
 		}
 	}
+
+	// Set the rendering statistics of the source element's context
+	if (Element* rendering_content = GetElementById("rendering-content"))
+	{
+		String rendering;
+		if (Context* context = (source_element ? source_element->GetContext() : nullptr))
+		{
+			const BoxShadowCacheStatistics box_shadows = context->GetBoxShadowCacheStatistics();
+
+			rendering =
+				"<span class='name'>box-shadow textures: </span><em>" + ToString(box_shadows.num_textures) + "</em><br/>" +
+				"<span class='name'>box-shadow users: </span><em>" + ToString(box_shadows.num_users) + "</em><br/>" +
+				"<span class='name'>box-shadow memory: </span><em>" + ToString(box_shadows.texture_memory / 1024) + " KiB</em><br/>" +
+				"<span class='name'>box-shadow cache hits: </span><em>" + ToString(box_shadows.num_hits) + "</em><br/>" +
+				"<span class='name'>box-shadow cache misses: </span><em>" + ToString(box_shadows.num_misses) + "</em>";
+		}
+
+		if (rendering.empty())
+		{
+			while (rendering_content->HasChildNodes())
+				rendering_content->RemoveChild(rendering_content->GetFirstChild());
+			rendering_rml.clear();
+		}
+		else if (rendering != rendering_rml)
+		{
+			rendering_content->SetInnerRML(rendering);
+			rendering_rml = std::move(rendering);
+		}
+	}
 }
 
 void ElementInfo::BuildElementPropertiesRML(String& property_rml, Element* element, Element* primary_element)
@@ -0,0 +1,282 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementProfiler.h"
+#include "CommonSource.h"
+#include "Geometry.h"
+#include "ProfilerSource.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Debugger {
+
+static constexpr int num_phases = 4;
+
+static double GetPhaseTime(const FrameStatistics& statistics, int phase)
+{
+	switch (phase)
+	{
+	case 0: return statistics.data_model_time;
+	case 1: return statistics.style_time;
+	case 2: return statistics.layout_time;
+	default: break;
+	}
+	return statistics.render_time;
+}
+
+static const Colourb phase_colours[num_phases] = {Colourb(204, 136, 204), Colourb(136, 204, 255), Colourb(255, 204, 102), Colourb(136, 238, 136)};
+
+ElementProfiler::ElementProfiler(const String& tag) : ElementDocument(tag)
+{
+	debug_context = nullptr;
+	history_index = 0;
+	history_size = 0;
+	previous_update_time = 0;
+	graph = nullptr;
+	statistics_content = nullptr;
+	textures_content = nullptr;
+}
+
+ElementProfiler::~ElementProfiler()
+{
+}
+
+// Initialises the profiler element.
+bool ElementProfiler::Initialise()
+{
+	SetInnerRML(profiler_rml);
+	SetId("rmlui-debug-profiler");
+
+	graph = GetElementById("graph");
+	statistics_content = GetElementById("statistics-content");
+	textures_content = GetElementById("textures-content");
+
+	SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(String(common_rcss) + String(profiler_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheetContainer(std::move(style_sheet));
+
+	AddEventListener(EventId::Click, this);
+
+	return true;
+}
+
+// Sets the context to gather frame statistics from.
+void ElementProfiler::SetDebugContext(Context* context)
+{
+	debug_context = context;
+	history_index = 0;
+	history_size = 0;
+}
+
+void ElementProfiler::OnUpdate()
+{
+	ElementDocument::OnUpdate();
+
+	if (!debug_context || !IsVisible())
+		return;
+
+	history[history_index] = debug_context->GetFrameStatistics();
+	history_index = (history_index + 1) % num_history_frames;
+	history_size = std::min(history_size + 1, num_history_frames);
+
+	const double t = GetSystemInterface()->GetElapsedTime();
+	constexpr double update_interval = 0.3;
+
+	if (history_size == 1 || t - previous_update_time > update_interval)
+	{
+		previous_update_time = t;
+		UpdateStatistics();
+		UpdateTextures();
+	}
+}
+
+void ElementProfiler::OnRender()
+{
+	ElementDocument::OnRender();
+	RenderGraph();
+}
+
+void ElementProfiler::ProcessEvent(Event& event)
+{
+	if (event == EventId::Click)
+	{
+		if (event.GetTargetElement()->GetId() == "close_button")
+			SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+	}
+}
+
+void ElementProfiler::UpdateStatistics()
+{
+	if (!statistics_content || history_size == 0)
+		return;
+
+	const FrameStatistics& last = history[(history_index + num_history_frames - 1) % num_history_frames];
+
+	String rml = "<table><tr><td class=\"name\"></td><td>last</td><td>avg</td><td>max</td></tr>";
+
+	// Phase times are listed in milliseconds.
+	const char* phase_names[num_phases] = {"Data models", "Style", "Layout", "Render"};
+	for (int phase = 0; phase < num_phases; phase++)
+	{
+		double sum = 0, max = 0;
+		for (int i = 0; i < history_size; i++)
+		{
+			const double time = GetPhaseTime(history[i], phase);
+			sum += time;
+			max = std::max(max, time);
+		}
+		rml += CreateString(256, "<tr><td class=\"name\">%s</td><td>%.3f</td><td>%.3f</td><td>%.3f</td></tr>", phase_names[phase],
+			1000.0 * GetPhaseTime(last, phase), 1000.0 * sum / double(history_size), 1000.0 * max);
+	}
+
+	struct CounterEntry {
+		const char* name;
+		int FrameStatistics::*member;
+	};
+	const CounterEntry counters[] = {
+		{"Elements updated", &FrameStatistics::num_elements_updated},
+		{"Definitions updated", &FrameStatistics::num_definitions_updated},
+		{"Elements formatted", &FrameStatistics::num_elements_formatted},
+		{"Geometry generated", &FrameStatistics::num_geometry_generated},
+		{"Draw calls", &FrameStatistics::num_draw_calls},
+		{"Textures generated", &FrameStatistics::num_textures_generated},
+	};
+	for (const CounterEntry& counter : counters)
+	{
+		int sum = 0, max = 0;
+		for (int i = 0; i < history_size; i++)
+		{
+			const int value = history[i].*counter.member;
+			sum += value;
+			max = std::max(max, value);
+		}
+		rml += CreateString(256, "<tr><td class=\"name\">%s</td><td>%d</td><td>%.1f</td><td>%d</td></tr>", counter.name, last.*counter.member,
+			double(sum) / double(history_size), max);
+	}
+
+	rml += "</table>";
+	statistics_content->SetInnerRML(rml);
+}
+
+void ElementProfiler::UpdateTextures()
+{
+	if (!textures_content)
+		return;
+
+	const TextureMemoryStatistics statistics = GetTextureMemoryStatistics();
+
+	// Sizes are listed in kibibytes, and the age as the number of frames since the texture was last used.
+	String rml = CreateString(256, "<p>Texture memory: %.1f KiB", double(statistics.total_size) / 1024.0);
+	if (statistics.budget > 0)
+		rml += CreateString(128, " of %.1f KiB", double(statistics.budget) / 1024.0);
+	rml += "</p><table><tr><td class=\"name\"></td><td>KiB</td><td>age</td></tr>";
+
+	constexpr int max_num_textures = 10;
+	const int num_textures = std::min((int)statistics.textures.size(), max_num_textures);
+	for (int i = 0; i < num_textures; i++)
+	{
+		const TextureMemoryStatistics::Entry& texture = statistics.textures[i];
+
+		String source = StringUtilities::EncodeRml(texture.source);
+		const size_t slash_pos = source.find_last_of("/\\");
+		if (slash_pos != String::npos)
+			source = source.substr(slash_pos + 1);
+
+		rml += CreateString(512, "<tr><td class=\"name\">%s</td><td>%.1f</td><td>%d</td></tr>", source.c_str(), double(texture.size) / 1024.0,
+			statistics.frame - texture.last_used_frame);
+	}
+
+	rml += "</table>";
+	textures_content->SetInnerRML(rml);
+}
+
+void ElementProfiler::RenderGraph()
+{
+	if (!graph || history_size == 0)
+		return;
+
+	const Vector2f graph_origin = graph->GetAbsoluteOffset(BoxArea::Content);
+	const Vector2f graph_size = graph->GetBox().GetSize(BoxArea::Content);
+	if (graph_size.x <= 0.f || graph_size.y <= 0.f)
+		return;
+
+	// Scale the bars so that the slowest frame in the history fills the graph.
+	double max_frame_time = 0;
+	for (int i = 0; i < history_size; i++)
+	{
+		double frame_time = 0;
+		for (int phase = 0; phase < num_phases; phase++)
+			frame_time += GetPhaseTime(history[i], phase);
+		max_frame_time = std::max(max_frame_time, frame_time);
+	}
+	if (max_frame_time <= 0)
+		return;
+
+	const float bar_width = graph_size.x / float(num_history_frames);
+	const float time_scale = graph_size.y / float(max_frame_time);
+
+	Vector<Vertex> vertices(history_size * num_phases * 4);
+	Vector<int> indices(history_size * num_phases * 6);
+	int num_quads = 0;
+
+	// Draw the oldest frame to the left, so that the newest frame ends up at the right edge of the graph.
+	for (int i = 0; i < history_size; i++)
+	{
+		const FrameStatistics& statistics = history[(history_index - history_size + i + num_history_frames) % num_history_frames];
+		const float x = graph_size.x - float(history_size - i) * bar_width;
+		float y = graph_size.y;
+
+		for (int phase = 0; phase < num_phases; phase++)
+		{
+			const float height = float(GetPhaseTime(statistics, phase)) * time_scale;
+			if (height <= 0.f)
+				continue;
+
+			y -= height;
+			GeometryUtilities::GenerateQuad(&vertices[num_quads * 4], &indices[num_quads * 6], Vector2f(x, y), Vector2f(bar_width, height),
+				phase_colours[phase], num_quads * 4);
+			num_quads++;
+		}
+	}
+
+	vertices.resize(num_quads * 4);
+	indices.resize(num_quads * 6);
+
+	Geometry::RenderGeometry(graph_origin, vertices, indices);
+}
+
+}
+} // namespace Rml
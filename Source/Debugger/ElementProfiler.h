@@ -15,7 +15,7 @@
  *
  * The above copyright notice and this permission notice shall be included in
  * all copies or substantial portions of the Software.
- * 
+ *
  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
@@ -26,52 +26,62 @@
  *
  */
 
-#ifndef TEXTURELAYOUTROW_H
-#define TEXTURELAYOUTROW_H
+#ifndef RMLUI_DEBUGGER_ELEMENTPROFILER_H
+#define RMLUI_DEBUGGER_ELEMENTPROFILER_H
 
-#include "TextureLayoutRectangle.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+#include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
-
-class TextureLayout;
+namespace Debugger {
 
 /**
-	A texture layout row is a single row of rectangles positioned vertically within a texture.
-
-	@author Peter
+	Displays the frame statistics of the debugged context, with a graph of the time spent in each phase of recent frames, and the memory
+	used by the largest textures.
  */
 
-class TextureLayoutRow
+class ElementProfiler : public Rml::ElementDocument, public Rml::EventListener
 {
 public:
-	TextureLayoutRow();
-	~TextureLayoutRow();
+	RMLUI_RTTI_DefineWithParent(ElementProfiler, Rml::ElementDocument)
 
-	/// Attempts to position unplaced rectangles from the layout into this row.
-	/// @param[in] layout The layout to position rectangles from.
-	/// @param[in] width The maximum width of this row.
-	/// @param[in] y The y-coordinate of this row.
-	/// @return The number of placed rectangles.
-	int Generate(TextureLayout& layout, int width, int y);
+	ElementProfiler(const String& tag);
+	~ElementProfiler();
 
-	/// Assigns allocated texture data to all rectangles in this row.
-	/// @param[in] texture_data The pointer to the beginning of the texture's data.
-	/// @param[in] stride The stride of the texture's surface, in bytes;
-	void Allocate(byte* texture_data, int stride);
+	/// Initialises the profiler element.
+	/// @return True if the element initialised successfully, false otherwise.
+	bool Initialise();
 
-	/// Returns the height of the row.
-	/// @return The row's height.
-	int GetHeight() const;
+	/// Sets the context to gather frame statistics from.
+	void SetDebugContext(Context* context);
 
-	/// Resets the placed status for all of the rectangles within this row.
-	void Unplace();
+protected:
+	void OnUpdate() override;
+	void OnRender() override;
+	void ProcessEvent(Event& event) override;
 
 private:
-	using RectangleList = Vector< TextureLayoutRectangle* >;
+	void UpdateStatistics();
+	void UpdateTextures();
+	void RenderGraph();
+
+	static constexpr int num_history_frames = 120;
 
-	int height;
-	RectangleList rectangles;
+	Context* debug_context;
+	FrameStatistics history[num_history_frames];
+	int history_index;
+	int history_size;
+
+	double previous_update_time;
+
+	Element* graph;
+	Element* statistics_content;
+	Element* textures_content;
 };
 
+}
 } // namespace Rml
+
 #endif
@@ -61,6 +61,7 @@ void Geometry::RenderOutline(const Vector2f origin, const Vector2f dimensions, c
 	GeometryUtilities::GenerateQuad(vertices + 8, indices + 12, Vector2f(0, 0), Vector2f(width, dimensions.y), colour, 8);
 	GeometryUtilities::GenerateQuad(vertices + 12, indices + 18, Vector2f(dimensions.x - width, 0), Vector2f(width, dimensions.y), colour, 12);
 
+	context->GetRenderState().FlushDrawList();
 	render_interface->RenderGeometry(vertices, 4 * 4, indices, 6 * 4, 0, origin);
 }
 
@@ -77,9 +78,22 @@ void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const
 
 	GeometryUtilities::GenerateQuad(vertices, indices, Vector2f(0, 0), Vector2f(dimensions.x, dimensions.y), colour, 0);
 
+	context->GetRenderState().FlushDrawList();
 	render_interface->RenderGeometry(vertices, 4, indices, 6, 0, origin);
 }
 
+// Renders untextured geometry, such as a set of boxes generated in one go.
+void Geometry::RenderGeometry(const Vector2f origin, Vector<Vertex>& vertices, Vector<int>& indices)
+{
+	if (context == nullptr || vertices.empty() || indices.empty())
+		return;
+
+	RenderInterface* render_interface = context->GetRenderInterface();
+
+	context->GetRenderState().FlushDrawList();
+	render_interface->RenderGeometry(vertices.data(), (int)vertices.size(), indices.data(), (int)indices.size(), 0, origin);
+}
+
 // Renders a box with a hole in the middle.
 void Geometry::RenderBox(const Vector2f origin, const Vector2f dimensions, const Vector2f hole_origin, const Vector2f hole_dimensions, const Colourb colour)
 {
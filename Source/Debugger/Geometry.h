@@ -34,6 +34,7 @@
 namespace Rml {
 
 class Context;
+struct Vertex;
 
 namespace Debugger {
 
@@ -55,6 +56,8 @@ public:
 	static void RenderBox(Vector2f origin, Vector2f dimensions, Colourb colour);
 	// Renders a box with a hole in the middle.
 	static void RenderBox(Vector2f origin, Vector2f dimensions, Vector2f hole_origin, Vector2f hole_dimensions, Colourb colour);
+	// Renders untextured geometry, such as a set of boxes generated in one go.
+	static void RenderGeometry(Vector2f origin, Vector<Vertex>& vertices, Vector<int>& indices);
 
 private:
 	Geometry();
@@ -167,5 +167,10 @@ static const char* info_rml = R"RML(
 		<div id="children-content">
 		</div>
 	</div>
+	<div id="rendering">
+		<h2>Rendering</h2>
+		<div id="rendering-content">
+		</div>
+	</div>
 </div>
 )RML";
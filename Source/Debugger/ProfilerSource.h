@@ -0,0 +1,94 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+static const char* profiler_rcss = R"RCSS(body
+{
+	width: 380dp;
+	height: 480dp;
+	min-width: 250dp;
+	min-height: 200dp;
+	top: 42dp;
+	left: 440dp;
+}
+div#graph
+{
+	height: 100dp;
+	margin: 4dp 2dp;
+	background-color: #111;
+}
+div#legend
+{
+	margin: 0 2dp 6dp;
+}
+div#legend span
+{
+	margin-right: 10dp;
+}
+div#legend span.data-models { color: #c8c; }
+div#legend span.style { color: #8cf; }
+div#legend span.layout { color: #fc6; }
+div#legend span.render { color: #8e8; }
+div#statistics-content table, div#textures-content table
+{
+	display: table;
+	width: 100%;
+}
+div#statistics-content tr, div#textures-content tr
+{
+	display: table-row;
+}
+div#statistics-content td, div#textures-content td
+{
+	display: table-cell;
+	text-align: right;
+	padding: 1dp 2dp;
+}
+div#statistics-content td.name, div#textures-content td.name
+{
+	text-align: left;
+}
+div#textures-content
+{
+	margin-top: 8dp;
+}
+)RCSS";
+
+static const char* profiler_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div>Frame Statistics</div>
+</h1>
+<div id="content">
+	<div id="graph"/>
+	<div id="legend"><span class="data-models">Data models</span><span class="style">Style</span><span class="layout">Layout</span><span class="render">Render</span></div>
+	<div id="statistics-content"/>
+	<div id="textures-content"/>
+</div>
+<handle id="size_handle" size_target="#document" />
+)RML";
@@ -32,9 +32,11 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "LottieRasterizer.h"
 #include <cmath>
 #include <rlottie.h>
 
@@ -61,6 +63,11 @@ bool ElementLottie::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 	return true;
 }
 
+void ElementLottie::SetFrameCacheLimit(size_t max_bytes)
+{
+	LottieRasterizer::SetFrameCacheLimit(max_bytes);
+}
+
 void ElementLottie::OnRender()
 {
 	if (animation)
@@ -134,9 +141,13 @@ bool ElementLottie::LoadAnimation()
 	animation_dirty = false;
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
+	texture = Texture();
+	texture_dimensions = Vector2i{};
 	animation.reset();
-	prev_animation_frame = size_t(-1);
+	rasterizer.reset();
+	displayed_frame.reset();
 	time_animation_start = -1;
+	time_previous_update = -1;
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -174,6 +185,9 @@ bool ElementLottie::LoadAnimation()
 	intrinsic_dimensions.x = float(width);
 	intrinsic_dimensions.y = float(height);
 
+	rasterizer = MakeShared<LottieRasterizer>(animation, path);
+	texture_size_dirty = true;
+
 	return true;
 }
 
@@ -187,66 +201,71 @@ void ElementLottie::UpdateTexture()
 	if (time_animation_start < 0.0)
 		time_animation_start = t;
 
+	// Frames are rendered ahead of time for when we expect the next update, based on the time since the previous update.
+	const double time_until_next_update = (time_previous_update < 0.0 ? 0.0 : Math::Clamp(t - time_previous_update, 0.0, 0.1));
+	time_previous_update = t;
+
 	// Find the next animation frame to display.
 	// Here it is possible to add more logic to control playback speed, pause/resume, and more.
 	double _unused;
 	// Find the normalized animation progress [0, 1].
 	const double pos = std::modf((t - time_animation_start) / animation->duration(), &_unused);
+	const double pos_ahead = std::modf((t + time_until_next_update - time_animation_start) / animation->duration(), &_unused);
 
 	const size_t next_frame = animation->frameAtPos(pos);
-	if (!texture_size_dirty && next_frame == prev_animation_frame)
-	{
-		// No need to update the texture if we are drawing the same frame at the same size.
-		return;
-	}
 
-	// Resize the texture buffer if necessary.
-	const size_t new_texture_data_size = 4 * render_dimensions.x * render_dimensions.y;
-	if (new_texture_data_size > texture_data_size)
+	if (texture_size_dirty)
 	{
-		texture_data.reset(new byte[new_texture_data_size]);
-		texture_data_size = new_texture_data_size;
+		rasterizer->SetDimensions(render_dimensions);
+		displayed_frame.reset();
+		texture_size_dirty = false;
 	}
 
-	// Callback for generating texture.
-	auto p_callback = [this, next_frame](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle,
-						  Vector2i& out_dimensions) -> bool {
-		RMLUI_ASSERT(animation);
-
-		const size_t bytes_per_line = 4 * render_dimensions.x;
-		const size_t total_bytes = bytes_per_line * render_dimensions.y;
-		byte* p_data = texture_data.get();
-
-		rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(p_data), render_dimensions.x, render_dimensions.y, bytes_per_line);
-		animation->renderSync(next_frame, surface);
+	if (!displayed_frame || displayed_frame->frame_index != next_frame)
+	{
+		// Use the frame rendered ahead of time if it is ready, otherwise keep displaying the current frame until it is. If there is nothing to
+		// display yet, render the frame right away.
+		SharedPtr<LottieFrame> frame = rasterizer->TakeFrame(next_frame);
+		if (!frame && !displayed_frame)
+			frame = rasterizer->RenderFrame(next_frame);
 
-		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
+		if (frame)
 		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
+			rasterizer->RecycleFrame(std::move(displayed_frame));
+			displayed_frame = std::move(frame);
 
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			const byte a = p_data[i + 3];
-			if (a > 0 && a < 255)
+			// Upload the frame to the existing texture when possible, otherwise generate a new one from the frame data.
+			if (texture && texture_dimensions == displayed_frame->dimensions)
 			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
+				texture.UpdateRegion(displayed_frame->data.get(), Vector2i(0, 0), displayed_frame->dimensions);
+			}
+			else
+			{
+				auto p_callback = [this](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle,
+									  Vector2i& out_dimensions) -> bool {
+					if (!displayed_frame || !render_interface->GenerateTexture(out_handle, displayed_frame->data.get(), displayed_frame->dimensions))
+						return false;
+
+					out_dimensions = displayed_frame->dimensions;
+					return true;
+				};
+
+				texture.Set("lottie", p_callback);
+				texture_dimensions = displayed_frame->dimensions;
+				geometry.SetTexture(&texture);
 			}
 		}
+	}
 
-		if (!render_interface->GenerateTexture(out_handle, p_data, render_dimensions))
-			return false;
-
-		out_dimensions = render_dimensions;
-		return true;
-	};
+	// Start rendering the frame we expect to display next, or otherwise the one following the current frame.
+	if (displayed_frame)
+	{
+		size_t ahead_frame = animation->frameAtPos(pos_ahead);
+		if (ahead_frame == displayed_frame->frame_index)
+			ahead_frame = (ahead_frame + 1) % Math::Max(animation->totalFrame(), size_t(1));
 
-	texture.Set("lottie", p_callback);
-	geometry.SetTexture(&texture);
-	prev_animation_frame = next_frame;
-	texture_size_dirty = false;
+		LottieRasterizer::RequestFrame(rasterizer, ahead_frame);
+	}
 }
 
 } // namespace Rml
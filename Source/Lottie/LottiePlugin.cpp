@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "LottieRasterizer.h"
 
 namespace Rml {
 namespace Lottie {
@@ -46,11 +47,15 @@ public:
 		
 		Factory::RegisterElementInstancer("lottie", instancer.get());
 
+		LottieRasterizer::Initialise();
+
 		Log::Message(Log::LT_INFO, "Lottie plugin initialised.");
 	}
 
 	void OnShutdown() override
 	{
+		LottieRasterizer::Shutdown();
+
 		delete this;
 	}
 
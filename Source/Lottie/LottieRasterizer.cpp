@@ -0,0 +1,261 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LottieRasterizer.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../Core/WorkerPool.h"
+#include <rlottie.h>
+
+namespace Rml {
+
+namespace {
+
+struct RasterizerData {
+	RasterizerData(int num_threads) : worker_pool(num_threads) {}
+
+	WorkerPool worker_pool;
+
+	// Frame caches by source and dimensions. Only accessed from the main thread.
+	UnorderedMap<String, WeakPtr<LottieFrameCache>> frame_caches;
+};
+
+} // namespace
+
+static UniquePtr<RasterizerData> rasterizer_data;
+static size_t frame_cache_limit = 0;
+
+// Converts rlottie's pixels with pre-multiplied alpha to RmlUi's RGBA format with post-multiplied alpha, in-place.
+static void ConvertToStraightRGBA(byte* data, size_t num_pixels)
+{
+	// The rlottie surface consists of 32-bit ARGB pixels. Swap the red and blue channels to match RmlUi's byte order. The loop operates on whole
+	// pixels without branches so that it can be vectorized by the compiler.
+	uint32_t* pixels = reinterpret_cast<uint32_t*>(data);
+	for (size_t i = 0; i < num_pixels; i++)
+	{
+		const uint32_t p = pixels[i];
+		pixels[i] = (p & 0xff00ff00u) | ((p >> 16) & 0x000000ffu) | ((p & 0x000000ffu) << 16);
+	}
+
+	// Un-premultiply the partially transparent pixels. The fixed-point reciprocals are rounded up, which gives the same result as dividing by
+	// alpha for all valid pre-multiplied colors.
+	static const Array<uint32_t, 256> reciprocals = []() {
+		Array<uint32_t, 256> result = {};
+		for (uint32_t a = 1; a < 256; a++)
+			result[a] = ((255u << 16) + a - 1) / a;
+		return result;
+	}();
+
+	for (size_t i = 0; i < num_pixels; i++)
+	{
+		const uint32_t p = pixels[i];
+		const uint32_t a = p >> 24;
+		if (a == 0 || a == 255)
+			continue;
+
+		const uint32_t reciprocal = reciprocals[a];
+		const uint32_t c0 = Math::Min(((p & 0xffu) * reciprocal) >> 16, 255u);
+		const uint32_t c1 = Math::Min((((p >> 8) & 0xffu) * reciprocal) >> 16, 255u);
+		const uint32_t c2 = Math::Min((((p >> 16) & 0xffu) * reciprocal) >> 16, 255u);
+		pixels[i] = (a << 24) | (c2 << 16) | (c1 << 8) | c0;
+	}
+}
+
+void LottieRasterizer::Initialise()
+{
+	rasterizer_data = MakeUnique<RasterizerData>(WorkerPool::GetDefaultNumThreads());
+}
+
+void LottieRasterizer::Shutdown()
+{
+	rasterizer_data.reset();
+}
+
+void LottieRasterizer::SetFrameCacheLimit(size_t max_bytes)
+{
+	frame_cache_limit = max_bytes;
+}
+
+void LottieRasterizer::RequestFrame(const SharedPtr<LottieRasterizer>& rasterizer, size_t frame_index)
+{
+	Vector2i frame_dimensions;
+	SharedPtr<LottieFrameCache> cache;
+	{
+		std::lock_guard<std::mutex> lock(rasterizer->mutex);
+		if (rasterizer->job_pending || rasterizer->ready_frame || rasterizer->dimensions.x <= 0 || rasterizer->dimensions.y <= 0)
+			return;
+
+		if (rasterizer->frame_cache)
+		{
+			std::lock_guard<std::mutex> cache_lock(rasterizer->frame_cache->mutex);
+			if (frame_index < rasterizer->frame_cache->frames.size() && rasterizer->frame_cache->frames[frame_index])
+				return;
+		}
+
+		rasterizer->job_pending = true;
+		frame_dimensions = rasterizer->dimensions;
+		cache = rasterizer->frame_cache;
+	}
+
+	auto job = [rasterizer, frame_index, frame_dimensions, cache]() {
+		LottieFramePtr frame = rasterizer->Rasterize(frame_index, frame_dimensions, cache);
+
+		std::lock_guard<std::mutex> lock(rasterizer->mutex);
+		rasterizer->job_pending = false;
+
+		// Discard the frame if the dimensions were changed while rendering.
+		if (rasterizer->dimensions == frame_dimensions)
+			rasterizer->ready_frame = std::move(frame);
+	};
+
+	if (rasterizer_data)
+		rasterizer_data->worker_pool.Submit(std::move(job));
+	else
+		job();
+}
+
+LottieRasterizer::LottieRasterizer(SharedPtr<rlottie::Animation> animation, const String& source) : animation(std::move(animation)), source(source)
+{}
+
+LottieRasterizer::~LottieRasterizer() {}
+
+void LottieRasterizer::SetDimensions(Vector2i new_dimensions)
+{
+	SharedPtr<LottieFrameCache> new_frame_cache;
+
+	// Share frames through a cache when all the frames of the animation fit within the limit.
+	const size_t frame_size = 4 * size_t(Math::Max(new_dimensions.x, 0)) * size_t(Math::Max(new_dimensions.y, 0));
+	const size_t num_frames = animation->totalFrame();
+	if (rasterizer_data && !source.empty() && frame_size > 0 && num_frames * frame_size <= frame_cache_limit)
+	{
+		auto& frame_caches = rasterizer_data->frame_caches;
+		for (auto it = frame_caches.begin(); it != frame_caches.end();)
+		{
+			if (it->second.expired())
+				it = frame_caches.erase(it);
+			else
+				++it;
+		}
+
+		const String key = CreateString(source.size() + 32, "%s|%dx%d", source.c_str(), new_dimensions.x, new_dimensions.y);
+		WeakPtr<LottieFrameCache>& weak_cache = frame_caches[key];
+		new_frame_cache = weak_cache.lock();
+		if (!new_frame_cache)
+		{
+			new_frame_cache = MakeShared<LottieFrameCache>();
+			new_frame_cache->frames.resize(num_frames);
+			weak_cache = new_frame_cache;
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	dimensions = new_dimensions;
+	frame_cache = std::move(new_frame_cache);
+	ready_frame.reset();
+	spare_frame.reset();
+}
+
+LottieFramePtr LottieRasterizer::TakeFrame(size_t frame_index)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if (frame_cache)
+	{
+		std::lock_guard<std::mutex> cache_lock(frame_cache->mutex);
+		if (frame_index < frame_cache->frames.size() && frame_cache->frames[frame_index])
+			return frame_cache->frames[frame_index];
+	}
+
+	return std::move(ready_frame);
+}
+
+LottieFramePtr LottieRasterizer::RenderFrame(size_t frame_index)
+{
+	Vector2i frame_dimensions;
+	SharedPtr<LottieFrameCache> cache;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		frame_dimensions = dimensions;
+		cache = frame_cache;
+	}
+
+	if (frame_dimensions.x <= 0 || frame_dimensions.y <= 0)
+		return nullptr;
+
+	return Rasterize(frame_index, frame_dimensions, cache);
+}
+
+void LottieRasterizer::RecycleFrame(LottieFramePtr frame)
+{
+	// Only reuse frames that are no longer referenced anywhere else, such as in a frame cache.
+	if (!frame || frame.use_count() != 1)
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (frame->dimensions == dimensions)
+		spare_frame = std::move(frame);
+}
+
+LottieFramePtr LottieRasterizer::Rasterize(size_t frame_index, Vector2i frame_dimensions, const SharedPtr<LottieFrameCache>& cache)
+{
+	LottieFramePtr frame;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		frame = std::move(spare_frame);
+	}
+
+	const size_t num_pixels = size_t(frame_dimensions.x) * size_t(frame_dimensions.y);
+
+	if (!frame || frame->dimensions != frame_dimensions)
+	{
+		frame = MakeShared<LottieFrame>();
+		frame->dimensions = frame_dimensions;
+		frame->data.reset(new byte[4 * num_pixels]);
+	}
+	frame->frame_index = frame_index;
+
+	{
+		std::lock_guard<std::mutex> lock(render_mutex);
+		rlottie::Surface surface(reinterpret_cast<std::uint32_t*>(frame->data.get()), size_t(frame_dimensions.x), size_t(frame_dimensions.y),
+			4 * size_t(frame_dimensions.x));
+		animation->renderSync(frame_index, surface);
+	}
+
+	ConvertToStraightRGBA(frame->data.get(), num_pixels);
+
+	if (cache)
+	{
+		std::lock_guard<std::mutex> lock(cache->mutex);
+		if (frame_index < cache->frames.size() && !cache->frames[frame_index])
+			cache->frames[frame_index] = frame;
+	}
+
+	return frame;
+}
+
+} // namespace Rml
@@ -0,0 +1,114 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_LOTTIE_LOTTIERASTERIZER_H
+#define RMLUI_LOTTIE_LOTTIERASTERIZER_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace rlottie { class Animation; }
+
+namespace Rml {
+
+/*
+    A rasterized animation frame, in RmlUi's RGBA format with post-multiplied alpha. Frames are immutable once handed out by the rasterizer.
+*/
+struct LottieFrame {
+	size_t frame_index = size_t(-1);
+	Vector2i dimensions;
+	UniquePtr<byte[]> data;
+};
+using LottieFramePtr = SharedPtr<LottieFrame>;
+
+/*
+    Frames of an animation shared between all elements playing the same file at the same size.
+*/
+struct LottieFrameCache {
+	std::mutex mutex;
+	Vector<LottieFramePtr> frames;
+};
+
+/**
+    Renders the frames of a single lottie animation ahead of time on a pool of worker threads.
+
+    The rasterizer is double-buffered: one frame is displayed by the element, while the worker renders the next frame into a second buffer.
+    The displayed frame is recycled as the next render target once it is replaced. Optionally, frames are additionally stored in a frame cache
+    and shared with other rasterizers.
+ */
+
+class LottieRasterizer : NonCopyMoveable {
+public:
+	/// Starts the worker threads, called on plugin initialisation.
+	static void Initialise();
+	/// Stops the worker threads, any frames not yet started are discarded.
+	static void Shutdown();
+
+	/// Sets the maximum size of all the frames in a single animation for it to be shared through a frame cache, zero disables the cache.
+	static void SetFrameCacheLimit(size_t max_bytes);
+
+	/// Starts rendering the given frame on a worker thread, unless the worker is still busy or an unconsumed frame is ready.
+	static void RequestFrame(const SharedPtr<LottieRasterizer>& rasterizer, size_t frame_index);
+
+	/// @param[in] animation The animation to render, it must only be rendered through this rasterizer.
+	/// @param[in] source Identifies the animation file, for sharing frames with other rasterizers.
+	LottieRasterizer(SharedPtr<rlottie::Animation> animation, const String& source);
+	~LottieRasterizer();
+
+	/// Sets the dimensions of the rendered frames, discarding any frames of other dimensions.
+	void SetDimensions(Vector2i dimensions);
+
+	/// Returns the given frame if it is cached, otherwise the latest frame finished by the worker, if any.
+	LottieFramePtr TakeFrame(size_t frame_index);
+	/// Renders the given frame immediately on the calling thread, used when there is nothing else to display.
+	LottieFramePtr RenderFrame(size_t frame_index);
+	/// Hands back a frame no longer displayed, so that its memory can be reused for rendering.
+	void RecycleFrame(LottieFramePtr frame);
+
+private:
+	// Renders the frame at the given dimensions, then stores it in the frame cache if any.
+	LottieFramePtr Rasterize(size_t frame_index, Vector2i frame_dimensions, const SharedPtr<LottieFrameCache>& cache);
+
+	SharedPtr<rlottie::Animation> animation;
+	String source;
+
+	// Serializes rendering of the animation between the worker and the calling thread.
+	std::mutex render_mutex;
+
+	// Protects the members below, which are shared with the worker.
+	std::mutex mutex;
+	Vector2i dimensions;
+	SharedPtr<LottieFrameCache> frame_cache;
+	bool job_pending = false;
+	LottieFramePtr ready_frame;
+	LottieFramePtr spare_frame;
+};
+
+} // namespace Rml
+#endif
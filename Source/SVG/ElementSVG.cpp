@@ -36,8 +36,8 @@
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "SVGCache.h"
 #include <cmath>
-#include <lunasvg.h>
 #include <string.h>
 
 namespace Rml {
@@ -71,15 +71,21 @@ bool ElementSVG::GetIntrinsicDimensions(Vector2f& dimensions, float& ratio)
 	return true;
 }
 
+void ElementSVG::SetAsyncRasterization(bool enable)
+{
+	SVGCache::SetAsyncRasterization(enable);
+}
+
 void ElementSVG::OnRender()
 {
-	if (svg_document)
+	if (svg_data)
 	{
 		if (geometry_dirty)
 			GenerateGeometry();
 
 		UpdateTexture();
-		geometry.Render(GetAbsoluteOffset(BoxArea::Content));
+		if (svg_texture)
+			geometry.Render(GetAbsoluteOffset(BoxArea::Content));
 	}
 }
 
@@ -149,9 +155,12 @@ void ElementSVG::GenerateGeometry()
 bool ElementSVG::LoadSource()
 {
 	source_dirty = false;
+	texture_size_dirty = true;
 	intrinsic_dimensions = Vector2f{};
 	geometry.SetTexture(nullptr);
-	svg_document.reset();
+	svg_data.reset();
+	svg_texture.reset();
+	pending_svg_texture.reset();
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -159,58 +168,39 @@ bool ElementSVG::LoadSource()
 		return false;
 
 	String path = attribute_src;
-	String directory;
 
 	if (ElementDocument* document = GetOwnerDocument())
 	{
 		const String document_source_url = StringUtilities::Replace(document->GetSourceURL(), '|', ':');
 		GetSystemInterface()->JoinPath(path, document_source_url, attribute_src);
-		GetSystemInterface()->JoinPath(directory, document_source_url, "");
 	}
 
-	String svg_data;
-
-	if (path.empty() || !GetFileInterface()->LoadFile(path, svg_data))
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", path.c_str());
+	svg_data = SVGCache::GetDocument(path);
+	if (!svg_data)
 		return false;
-	}
 
-	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
-	svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
-
-	if (!svg_document)
-	{
-		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", path.c_str());
-		return false;
-	}
-
-	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
-	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
+	intrinsic_dimensions = svg_data->intrinsic_dimensions;
 
 	return true;
 }
 
 void ElementSVG::UpdateTexture()
 {
-	if (!svg_document || !texture_size_dirty)
+	if (!svg_data)
 		return;
 
-	// Callback for generating texture.
-	auto p_callback = [this](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
-		RMLUI_ASSERT(svg_document);
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-		if (!bitmap.valid() || !bitmap.data())
-			return false;
-		if (!render_interface->GenerateTexture(out_handle, reinterpret_cast<const Rml::byte*>(bitmap.data()), render_dimensions))
-			return false;
-		out_dimensions = render_dimensions;
-		return true;
-	};
+	if (texture_size_dirty)
+	{
+		pending_svg_texture = SVGCache::GetTexture(svg_data, render_dimensions);
+		texture_size_dirty = false;
+	}
 
-	texture.Set("svg", p_callback);
-	geometry.SetTexture(&texture);
-	texture_size_dirty = false;
+	// Keep rendering the previous texture, if any, until the new one is rasterized.
+	if (pending_svg_texture && pending_svg_texture->IsReady())
+	{
+		svg_texture = std::move(pending_svg_texture);
+		geometry.SetTexture(svg_texture->GetTexture());
+	}
 }
 
 } // namespace Rml
@@ -0,0 +1,224 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "SVGCache.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../Core/WorkerPool.h"
+#include <lunasvg.h>
+
+namespace Rml {
+
+namespace {
+
+struct CacheData {
+	// Documents and textures by source, and by source and dimensions, respectively. Only accessed from the main thread.
+	UnorderedMap<String, WeakPtr<SVGData>> documents;
+	UnorderedMap<String, WeakPtr<SVGTexture>> textures;
+	size_t documents_cleanup_size = 64;
+	size_t textures_cleanup_size = 64;
+
+	UniquePtr<WorkerPool> worker_pool;
+};
+
+} // namespace
+
+static UniquePtr<CacheData> cache_data;
+static bool async_rasterization = false;
+
+// Removes entries no longer in use, once the map has grown past the cleanup size. Amortizes the cost over the insertions since the last cleanup.
+template <typename T>
+static void RemoveExpiredEntries(UnorderedMap<String, WeakPtr<T>>& map, size_t& cleanup_size)
+{
+	if (map.size() <= cleanup_size)
+		return;
+
+	for (auto it = map.begin(); it != map.end();)
+	{
+		if (it->second.expired())
+			it = map.erase(it);
+		else
+			++it;
+	}
+
+	cleanup_size = Math::Max(size_t(64), 2 * map.size());
+}
+
+SVGData::SVGData() {}
+
+SVGData::~SVGData() {}
+
+SVGTexture::SVGTexture(SharedPtr<SVGData> in_data, Vector2i dimensions) : data(std::move(in_data)), dimensions(dimensions)
+{
+	// Callback for generating the texture. Uses the bitmap rasterized ahead of time if available, otherwise the document is rasterized now.
+	auto p_callback = [this](RenderInterface* render_interface, const String& /*name*/, TextureHandle& out_handle, Vector2i& out_dimensions) -> bool {
+		UniquePtr<lunasvg::Bitmap> rasterized_bitmap;
+		if (async_result)
+		{
+			std::lock_guard<std::mutex> lock(async_result->mutex);
+			if (!async_result->rasterizing)
+				rasterized_bitmap = std::move(async_result->bitmap);
+		}
+
+		lunasvg::Bitmap result = (rasterized_bitmap ? std::move(*rasterized_bitmap) : Rasterize(*data, this->dimensions));
+		if (!result.valid() || !result.data())
+			return false;
+		if (!render_interface->GenerateTexture(out_handle, reinterpret_cast<const Rml::byte*>(result.data()), this->dimensions))
+			return false;
+		out_dimensions = this->dimensions;
+		return true;
+	};
+
+	texture.Set("svg", p_callback);
+}
+
+SVGTexture::~SVGTexture() {}
+
+bool SVGTexture::IsReady()
+{
+	if (!async_result)
+		return true;
+
+	std::lock_guard<std::mutex> lock(async_result->mutex);
+	return !async_result->rasterizing;
+}
+
+lunasvg::Bitmap SVGTexture::Rasterize(const SVGData& data, Vector2i dimensions)
+{
+	if (dimensions.x <= 0 || dimensions.y <= 0)
+		return lunasvg::Bitmap();
+
+	std::lock_guard<std::mutex> lock(data.render_mutex);
+	return data.svg_document->renderToBitmap(uint32_t(dimensions.x), uint32_t(dimensions.y));
+}
+
+void SVGCache::Initialise()
+{
+	cache_data = MakeUnique<CacheData>();
+}
+
+void SVGCache::Shutdown()
+{
+	cache_data.reset();
+}
+
+void SVGCache::SetAsyncRasterization(bool enable)
+{
+	async_rasterization = enable;
+}
+
+SharedPtr<SVGData> SVGCache::GetDocument(const String& source)
+{
+	WeakPtr<SVGData>* weak_data = nullptr;
+	if (cache_data)
+	{
+		weak_data = &cache_data->documents[source];
+		if (SharedPtr<SVGData> data = weak_data->lock())
+			return data;
+	}
+
+	String svg_data;
+	if (source.empty() || !GetFileInterface()->LoadFile(source, svg_data))
+	{
+		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG file %s", source.c_str());
+		return nullptr;
+	}
+
+	SharedPtr<SVGData> data = MakeShared<SVGData>();
+	data->source = source;
+
+	// We use a reset-release approach here in case clients use a non-std unique_ptr (lunasvg uses std::unique_ptr)
+	data->svg_document.reset(lunasvg::Document::loadFromData(svg_data).release());
+
+	if (!data->svg_document)
+	{
+		Log::Message(Rml::Log::Type::LT_WARNING, "Could not load SVG data from file %s", source.c_str());
+		return nullptr;
+	}
+
+	data->intrinsic_dimensions.x = Math::Max(float(data->svg_document->width()), 1.0f);
+	data->intrinsic_dimensions.y = Math::Max(float(data->svg_document->height()), 1.0f);
+
+	if (weak_data)
+	{
+		*weak_data = data;
+		RemoveExpiredEntries(cache_data->documents, cache_data->documents_cleanup_size);
+	}
+
+	return data;
+}
+
+SharedPtr<SVGTexture> SVGCache::GetTexture(const SharedPtr<SVGData>& data, Vector2i dimensions)
+{
+	RMLUI_ASSERT(data);
+
+	WeakPtr<SVGTexture>* weak_texture = nullptr;
+	if (cache_data)
+	{
+		weak_texture = &cache_data->textures[CreateString(data->source.size() + 32, "%s|%dx%d", data->source.c_str(), dimensions.x, dimensions.y)];
+		if (SharedPtr<SVGTexture> texture = weak_texture->lock())
+		{
+			// Textures keep their document alive, thus they always refer to the document currently cached for their source.
+			RMLUI_ASSERT(texture->data == data);
+			return texture;
+		}
+	}
+
+	SharedPtr<SVGTexture> texture = MakeShared<SVGTexture>(data, dimensions);
+
+	if (weak_texture)
+	{
+		*weak_texture = texture;
+		RemoveExpiredEntries(cache_data->textures, cache_data->textures_cleanup_size);
+
+		if (async_rasterization)
+		{
+			if (!cache_data->worker_pool)
+				cache_data->worker_pool = MakeUnique<WorkerPool>(WorkerPool::GetDefaultNumThreads());
+
+			SharedPtr<SVGTexture::AsyncResult> async_result = MakeShared<SVGTexture::AsyncResult>();
+			async_result->rasterizing = true;
+			texture->async_result = async_result;
+
+			cache_data->worker_pool->Submit([data, dimensions, async_result]() {
+				auto bitmap = MakeUnique<lunasvg::Bitmap>(SVGTexture::Rasterize(*data, dimensions));
+				std::lock_guard<std::mutex> lock(async_result->mutex);
+				async_result->bitmap = std::move(bitmap);
+				async_result->rasterizing = false;
+			});
+		}
+	}
+
+	return texture;
+}
+
+} // namespace Rml
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_SVG_SVGCACHE_H
+#define RMLUI_SVG_SVGCACHE_H
+
+#include "../../Include/RmlUi/Core/Texture.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace lunasvg {
+class Document;
+class Bitmap;
+} // namespace lunasvg
+
+namespace Rml {
+
+/*
+    A parsed SVG document, shared between all elements using the same source file.
+*/
+struct SVGData : NonCopyMoveable {
+	SVGData();
+	~SVGData();
+
+	String source;
+	UniquePtr<lunasvg::Document> svg_document;
+	Vector2f intrinsic_dimensions;
+
+	// Serializes rasterization of the document between threads.
+	mutable std::mutex render_mutex;
+};
+
+/*
+    An SVG document rasterized to a texture at a given size, shared between all elements displaying the document at that size.
+*/
+class SVGTexture : NonCopyMoveable {
+public:
+	SVGTexture(SharedPtr<SVGData> data, Vector2i dimensions);
+	~SVGTexture();
+
+	/// Returns true if the texture can be used without waiting for a worker thread to finish rasterizing the document.
+	bool IsReady();
+
+	const Texture* GetTexture() const { return &texture; }
+
+private:
+	// Renders the document at the given dimensions, on any thread.
+	static lunasvg::Bitmap Rasterize(const SVGData& data, Vector2i dimensions);
+
+	// Result of rasterization on a worker thread. Kept separate from the texture, so that the texture is always released on the main thread.
+	struct AsyncResult {
+		std::mutex mutex;
+		bool rasterizing = false;
+		UniquePtr<lunasvg::Bitmap> bitmap;
+	};
+
+	SharedPtr<SVGData> data;
+	Vector2i dimensions;
+	Texture texture;
+	SharedPtr<AsyncResult> async_result;
+
+	friend class SVGCache;
+};
+
+/**
+    Caches parsed SVG documents by source, and their rasterized textures by source and size.
+
+    Both are owned by the elements using them, while the cache only keeps weak references to them. Thus, a document or texture is released as
+    soon as no element uses it anymore.
+ */
+
+class SVGCache {
+public:
+	/// Starts the cache and its worker threads, called on plugin initialisation.
+	static void Initialise();
+	/// Stops the cache, any rasterization not yet started is discarded.
+	static void Shutdown();
+
+	/// Enables rasterization of new textures on a worker thread, instead of synchronously on first use.
+	static void SetAsyncRasterization(bool enable);
+
+	/// Returns the parsed document of the given file, loading it if it is not already in use.
+	/// @return The shared document, or nullptr if it could not be loaded.
+	static SharedPtr<SVGData> GetDocument(const String& source);
+
+	/// Returns the texture of the document rasterized at the given size, generating it if it is not already in use.
+	static SharedPtr<SVGTexture> GetTexture(const SharedPtr<SVGData>& data, Vector2i dimensions);
+};
+
+} // namespace Rml
+#endif
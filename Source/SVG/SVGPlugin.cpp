@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
+#include "SVGCache.h"
 
 namespace Rml {
 namespace SVG {
@@ -42,6 +43,8 @@ class SVGPlugin : public Plugin {
 public:
 	void OnInitialise() override
 	{
+		SVGCache::Initialise();
+
 		instancer = MakeUnique<ElementInstancerGeneric<ElementSVG> >();
 		
 		Factory::RegisterElementInstancer("svg", instancer.get());
@@ -51,6 +54,7 @@ public:
 
 	void OnShutdown() override
 	{
+		SVGCache::Shutdown();
 		delete this;
 	}
 
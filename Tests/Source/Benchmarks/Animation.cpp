@@ -0,0 +1,120 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Transform.h>
+#include <RmlUi/Core/TransformPrimitive.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		.spinner {
+			display: inline-block;
+			width: 16px;
+			height: 16px;
+			margin: 2px;
+			background: #335;
+			border: 1px #88c;
+			transform: rotate(0deg);
+		}
+	</style>
+</head>
+
+<body>
+<div id="container"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("animation")
+{
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* container = document->GetElementById("container");
+	REQUIRE(container);
+
+	constexpr int num_elements = 1000;
+	String rml;
+	for (int i = 0; i < num_elements; i++)
+		rml += "<div class=\"spinner\"><div/></div>";
+	container->SetInnerRML(rml);
+
+	TestsShell::RenderLoop();
+
+	const String msg = TestsShell::GetRenderStats();
+	MESSAGE(msg);
+
+	nanobench::Bench bench;
+	bench.title("Animation");
+	bench.relative(true);
+	bench.minEpochIterations(100);
+	bench.warmup(50);
+
+	double t = 0.0;
+	auto NextFrame = [&] {
+		t += 1.0 / 60.0;
+		system_interface->SetTime(t);
+		context->Update();
+		context->Render();
+	};
+
+	bench.run("Reference (update + render)", NextFrame);
+
+	const Property rotated(TransformPtr(MakeShared<Transform>(Transform::PrimitiveList{Transforms::Rotate2D(360.f, Unit::DEG)})), Unit::TRANSFORM);
+	for (int i = 0; i < num_elements; i++)
+		container->GetChild(i)->Animate("transform", rotated, 1.f, Tween{}, -1);
+
+	bench.run("Spin elements", NextFrame);
+
+	for (int i = 0; i < num_elements; i++)
+		container->GetChild(i)->Animate("opacity", Property(0.f, Unit::NUMBER), 1.f, Tween{}, -1, true);
+
+	bench.run("Spin and fade elements", NextFrame);
+
+	document->Close();
+	system_interface->SetTime(0.0);
+}
@@ -0,0 +1,101 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+TEST_CASE("convolution_filter")
+{
+	// Roughly the size of a glyph at a large font size.
+	const Vector2i source_dimensions(40, 48);
+
+	Vector<byte> source_a8(source_dimensions.x * source_dimensions.y);
+	Vector<byte> source_rgba8(source_a8.size() * 4, byte(255));
+	for (int i = 0; i < (int)source_a8.size(); i++)
+	{
+		source_a8[i] = byte((i * 37) % 256 > 96 ? 255 : 0);
+		source_rgba8[i * 4 + 3] = source_a8[i];
+	}
+
+	nanobench::Bench bench;
+	bench.title("Convolution filter");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+
+	for (int radius : {1, 2, 4, 8, 16, 32})
+	{
+		const Vector2i destination_dimensions = source_dimensions + Vector2i(2 * radius);
+		const int destination_stride = destination_dimensions.x * 4;
+		Vector<byte> destination(destination_stride * destination_dimensions.y);
+
+		// Same kernels as used by the glow and outline font effects.
+		ConvolutionFilter blur;
+		blur.Initialise(radius, FilterOperation::Sum);
+
+		const float std_dev = .4f * float(radius);
+		const float two_variance = 2.f * std_dev * std_dev;
+		for (int y = -radius; y <= radius; y++)
+		{
+			for (int x = -radius; x <= radius; x++)
+				blur[y + radius][x + radius] = Math::Exp(-float(x * x + y * y) / two_variance) / (Math::RMLUI_PI * two_variance);
+		}
+
+		ConvolutionFilter outline;
+		outline.Initialise(radius, FilterOperation::Dilation);
+		for (int y = -radius; y <= radius; y++)
+		{
+			for (int x = -radius; x <= radius; x++)
+			{
+				const float distance = Math::SquareRoot(float(x * x + y * y));
+				outline[y + radius][x + radius] = (distance > radius ? Math::Max((radius + 1) - distance, 0.0f) : 1.f);
+			}
+		}
+
+		for (ColorFormat source_format : {ColorFormat::A8, ColorFormat::RGBA8})
+		{
+			const byte* source = (source_format == ColorFormat::A8 ? source_a8.data() : source_rgba8.data());
+			const char* format_name = (source_format == ColorFormat::A8 ? "A8" : "RGBA8");
+
+			bench.run(CreateString(64, "Blur r=%d %s", radius, format_name), [&] {
+				blur.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source, source_dimensions,
+					Vector2i(radius), source_format);
+			});
+
+			bench.run(CreateString(64, "Outline r=%d %s", radius, format_name), [&] {
+				outline.Run(destination.data(), destination_dimensions, destination_stride, ColorFormat::RGBA8, source, source_dimensions,
+					Vector2i(radius), source_format);
+			});
+		}
+	}
+}
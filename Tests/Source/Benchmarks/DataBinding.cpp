@@ -31,6 +31,7 @@
 #include <RmlUi/Core/DataModelHandle.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StringUtilities.h>
 #include <doctest.h>
 #include <nanobench.h>
 
@@ -245,3 +246,179 @@ TEST_CASE("data_binding")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_for_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { width: 800px; height: 600px; overflow: auto; }
+		.row { display: block; height: 20px; }
+		.row span { display: inline-block; width: 100px; }
+	</style>
+</head>
+<body>
+<div data-model="leaderboard">
+	<div id="reference"/>
+	<div class="row" data-for="player, i : players">
+		<span class="rank">{{ i + 1 }}</span>
+		<span class="name" data-attr-title="player.name">{{ player.name }}</span>
+		<span class="score" data-class-leader="player.score > 900">{{ player.score }}</span>
+	</div>
+</div>
+</body>
+</rml>
+)";
+
+struct Player {
+	String name;
+	int score = 0;
+};
+
+TEST_CASE("data_binding.for")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 500;
+
+	Vector<Player> all_players(num_rows);
+	for (int i = 0; i < num_rows; i++)
+		all_players[i] = Player{CreateString(32, "Player %d", i), 1000 - 2 * i};
+
+	Vector<Player> players;
+
+	DataModelConstructor constructor = context->CreateDataModel("leaderboard");
+	REQUIRE(bool(constructor));
+
+	if (auto handle = constructor.RegisterStruct<Player>())
+	{
+		handle.RegisterMember("name", &Player::name);
+		handle.RegisterMember("score", &Player::score);
+	}
+	constructor.RegisterArray<Vector<Player>>();
+	constructor.Bind("players", &players);
+
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_for_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The same elements as generated by the data-for loop, without any data bindings.
+	String reference_rml;
+	for (int i = 0; i < num_rows; i++)
+	{
+		const Player& player = all_players[i];
+		reference_rml += CreateString(256,
+			R"(<div class="row"><span class="rank">%d</span><span class="name" title="%s">%s</span><span class="score">%d</span></div>)", i + 1,
+			player.name.c_str(), player.name.c_str(), player.score);
+	}
+	Element* element_reference = document->GetElementById("reference");
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: data-for");
+	bench.unit("row");
+	bench.batch(num_rows);
+	bench.relative(true);
+
+	bench.run("Reference (SetInnerRML)", [&] {
+		element_reference->SetInnerRML(reference_rml);
+		context->Update();
+		element_reference->SetInnerRML("");
+		context->Update();
+	});
+
+	bench.run("Create and remove rows", [&] {
+		players = all_players;
+		model_handle.DirtyVariable("players");
+		context->Update();
+		players.clear();
+		model_handle.DirtyVariable("players");
+		context->Update();
+	});
+
+	players = all_players;
+	model_handle.DirtyVariable("players");
+	context->Update();
+
+	nanobench::Rng rng;
+	nanobench::Bench bench_entry;
+	bench_entry.title("Data bindings: data-for single entry");
+	bench_entry.relative(true);
+
+	bench_entry.run("Dirty variable", [&] {
+		players[num_rows / 2].score = rng.bounded(1000);
+		model_handle.DirtyVariable("players");
+		context->Update();
+	});
+
+	bench_entry.run("Dirty address", [&] {
+		players[num_rows / 2].score = rng.bounded(1000);
+		model_handle.DirtyAddress(CreateString(64, "players[%d].score", num_rows / 2));
+		context->Update();
+	});
+
+	document->Close();
+	context->RemoveDataModel("leaderboard");
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("data_binding.for_keyed")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 500;
+
+	Vector<Player> players(num_rows);
+	for (int i = 0; i < num_rows; i++)
+		players[i] = Player{CreateString(32, "Player %d", i), 1000 - 2 * i};
+
+	DataModelConstructor constructor = context->CreateDataModel("leaderboard");
+	REQUIRE(bool(constructor));
+
+	if (auto handle = constructor.RegisterStruct<Player>())
+	{
+		handle.RegisterMember("name", &Player::name);
+		handle.RegisterMember("score", &Player::score);
+	}
+	constructor.RegisterArray<Vector<Player>>();
+	constructor.Bind("players", &players);
+
+	DataModelHandle model_handle = constructor.GetModelHandle();
+
+	const String document_rml = StringUtilities::Replace(document_for_rml, R"(data-for="player, i : players")", R"(data-for="player, i : players" data-key="player.name")");
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	const Player new_player = Player{"New player", 1000};
+
+	nanobench::Bench bench;
+	bench.title("Data bindings: data-for keyed");
+	bench.relative(true);
+
+	bench.run("Insert and remove first row", [&] {
+		players.insert(players.begin(), new_player);
+		model_handle.DirtyVariable("players");
+		context->Update();
+		players.erase(players.begin());
+		model_handle.DirtyVariable("players");
+		context->Update();
+	});
+
+	document->Close();
+	context->RemoveDataModel("leaderboard");
+
+	TestsShell::ShutdownShell();
+}
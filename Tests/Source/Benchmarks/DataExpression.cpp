@@ -57,6 +57,7 @@ TEST_CASE("data_expressions")
 	nanobench::Bench bench;
 	bench.title("Data expression");
 	bench.relative(true);
+	bench.minEpochIterations(1000);
 
 	auto bench_expression = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface);
@@ -91,6 +92,18 @@ TEST_CASE("data_expressions")
 		"Complex (execute)"
 	);
 
+	bench_expression(
+		"(radius * 2 + 1) * 3.14 > 10 ? 'large' : 'small'",
+		"Arithmetic (parse)",
+		"Arithmetic (execute)"
+	);
+
+	bench_expression(
+		"radius | format(2)",
+		"Transform (parse)",
+		"Transform (execute)"
+	);
+
 	auto bench_assignment = [&](const String& expression, const char* parse_name, const char* execute_name) {
 		DataParser parser(expression, interface); 
 		
@@ -123,4 +136,16 @@ TEST_CASE("data_expressions")
 		"Complex assign (parse)",
 		"Complex assign (execute)"
 	);
+
+	// Data views evaluate their expressions through DataExpression, which sets up the interpreter on every run.
+	DataExpression expression("color_name + ': ' + (radius * 2 | format(1)) + 'px'");
+	bool result = expression.Parse(interface, false);
+	REQUIRE(result);
+
+	Variant value;
+	bench.run("Data view (execute)", [&] {
+		result &= expression.Run(interface, value);
+	});
+
+	REQUIRE(result);
 }
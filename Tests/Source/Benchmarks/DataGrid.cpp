@@ -0,0 +1,179 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/DataSource.h>
+#include <RmlUi/Core/Elements/ElementDataGrid.h>
+#include <RmlUi/Core/Elements/ElementDataGridRow.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+namespace {
+
+class ServerDataSource : public DataSource {
+public:
+	ServerDataSource(int num_rows) : DataSource("servers"), num_rows(num_rows) {}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		for (const String& column : columns)
+		{
+			if (column == "name")
+				row.push_back(CreateString(32, "Server %d", row_index));
+			else if (column == "players")
+				row.push_back(CreateString(32, "%d/32", row_index % 33));
+			else if (column == "ping")
+				row.push_back(CreateString(32, "%d", row_index % 250));
+			else
+				row.push_back(String());
+		}
+	}
+
+	int GetNumRows(const String& /*table*/) override { return num_rows; }
+
+private:
+	int num_rows;
+};
+
+} // namespace
+
+static const String document_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		datagrid {
+			display: block;
+			width: 600px;
+			height: 400px;
+		}
+		datagridrow {
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<datagrid id="grid" source="servers.list" %s>
+	<col fields="name" width="60%%">Name</col>
+	<col fields="players" width="20%%">Players</col>
+	<col fields="ping" width="20%%">Ping</col>
+</datagrid>
+</body>
+</rml>
+)";
+
+static int CountElements(Element* element)
+{
+	int result = 1;
+	for (int i = 0; i < element->GetNumChildren(true); i++)
+		result += CountElements(element->GetChild(i));
+	return result;
+}
+
+TEST_CASE("datagrid")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("DataGrid");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+
+	for (int num_rows : {1000, 10000, 100000})
+	{
+		for (bool virtualized : {false, true})
+		{
+			// Regular rows are too slow to load at the largest size.
+			if (!virtualized && num_rows > 10000)
+				continue;
+
+			ServerDataSource data_source(num_rows);
+			const String rml = CreateString(document_rml.size() + 32, document_rml.c_str(), virtualized ? "virtualized" : "");
+			const String name = CreateString(64, "%s, %d rows", virtualized ? "Virtualized" : "Regular", num_rows);
+
+			ElementDocument* document = nullptr;
+			ElementDataGrid* grid = nullptr;
+
+			// Load the document and update until every row has been loaded, or for virtualized rows, until the scroll
+			// window has been laid out and filled.
+			auto LoadGrid = [&]() {
+				document = context->LoadDocumentFromMemory(rml);
+				document->Show();
+				grid = rmlui_dynamic_cast<ElementDataGrid*>(document->GetElementById("grid"));
+
+				int num_frames = 0;
+				auto IsLoaded = [&]() {
+					if (virtualized)
+						return num_frames >= 3;
+					ElementDataGridRow* last_row = grid->GetRow(grid->GetNumRows() - 1);
+					return last_row && last_row->GetChild(0)->GetNumChildren() > 0;
+				};
+				while (!IsLoaded())
+				{
+					context->Update();
+					context->Render();
+					num_frames += 1;
+				}
+			};
+
+			bench.epochs(1).epochIterations(1).warmup(0);
+			bench.run(name + ": load", [&] {
+				LoadGrid();
+				document->Close();
+				context->Update();
+			});
+
+			LoadGrid();
+			MESSAGE(name << ": " << CountElements(grid) << " elements in the data grid.");
+
+			// Scroll through the grid, a few rows every frame.
+			float scroll_top = 0.f;
+			bench.epochs(5).minEpochIterations(30).warmup(10);
+			bench.run(name + ": scroll", [&] {
+				scroll_top += 70.f;
+				if (scroll_top > grid->GetScrollHeight() - grid->GetClientHeight())
+					scroll_top = 0.f;
+				grid->SetScrollTop(scroll_top);
+				context->Update();
+				context->Render();
+			});
+
+			document->Close();
+			context->Update();
+		}
+	}
+}
@@ -256,4 +256,98 @@ TEST_CASE("element.asymptotic_complexity")
 	}
 
 	document->Close();
-}
\ No newline at end of file
+}
+
+TEST_CASE("element.hit_test")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+	el->SetProperty("overflow", "auto");
+
+	constexpr int num_rows = 500;
+	el->SetInnerRML(GenerateRml(num_rows));
+	context->Update();
+	context->Render();
+
+	String msg = Rml::CreateString(128, "\nHit testing among %d total elements.\n", GetNumDescendentElements(el));
+	MESSAGE(msg);
+
+	nanobench::Bench bench;
+	bench.title("Hit test");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int i = 0;
+	auto NextPoint = [&i]() {
+		i = (i + 1) % 64;
+		return Vector2f(120.f + 12.f * float(i), 100.f + 6.f * float(i));
+	};
+
+	bench.run("GetElementAtPoint", [&] {
+		Element* element = context->GetElementAtPoint(NextPoint());
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	bench.run("ProcessMouseMove", [&] {
+		const Vector2f point = NextPoint();
+		context->ProcessMouseMove(int(point.x), int(point.y), 0);
+	});
+
+	bench.run("ScrollTop + GetElementAtPoint", [&] {
+		el->SetScrollTop(float(i % 2));
+		Element* element = context->GetElementAtPoint(NextPoint());
+		nanobench::doNotOptimizeAway(element);
+	});
+
+	document->Close();
+}
+
+TEST_CASE("element.stacking_context")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	constexpr int num_items = 5000;
+	String rml;
+	for (int i = 0; i < num_items; i++)
+		rml += "<div/>";
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Stacking context");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	int i = 0;
+	bench.run("Toggle visibility + Render", [&] {
+		Element* item = el->GetChild((i++ * 97) % num_items);
+		item->SetProperty(PropertyId::Visibility, Style::Visibility(i % 2 ? Style::Visibility::Hidden : Style::Visibility::Visible));
+		context->Update();
+		context->Render();
+	});
+
+	bench.run("Toggle position + Render", [&] {
+		Element* item = el->GetChild((i++ * 97) % num_items);
+		item->SetProperty(PropertyId::Position, Style::Position(i % 2 ? Style::Position::Relative : Style::Position::Static));
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+}
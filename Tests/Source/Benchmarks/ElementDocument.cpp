@@ -26,6 +26,7 @@
  *
  */
 
+#include "../../../Source/Core/LayoutEngine.h"
 #include "../Common/TestsShell.h"
 #include "../Common/TestsInterface.h"
 #include <RmlUi/Core/Context.h>
@@ -184,3 +185,88 @@ TEST_CASE("elementdocument")
 		});
 	}
 }
+
+static const String document_large_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		body { font-size: 14px; }
+		#hud { display: flex; flex-wrap: wrap; }
+		.panel { width: 180px; height: 120px; margin: 5px; overflow: hidden; border: 1px #666; }
+		.row { display: block; }
+		#footer { display: block; }
+	</style>
+</head>
+<body>
+<div id="hud"/>
+<div id="footer">Frame: <span id="footer_value">0</span></div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementdocument.incremental_layout")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_panels = 200;
+	constexpr int num_rows = 5;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_large_rml);
+	REQUIRE(document);
+
+	String hud_rml;
+	for (int i = 0; i < num_panels; i++)
+	{
+		hud_rml += "<div class=\"panel\">";
+		for (int j = 0; j < num_rows; j++)
+			hud_rml += CreateString(128, "<div class=\"row\">Value %d: <span id=\"value_%d_%d\">0</span></div>", j, i, j);
+		hud_rml += "</div>";
+	}
+	document->GetElementById("hud")->SetInnerRML(hud_rml);
+	document->Show();
+	context->Update();
+
+	const int num_formatted_full_layout = LayoutEngine::GetAndResetNumFormattedElements();
+
+	int frame = 0;
+	auto mutate_leaf_and_update = [&](Element* leaf) {
+		frame += 1;
+		leaf->SetInnerRML(CreateString(32, "%d", frame));
+		context->Update();
+	};
+
+	Element* panel_leaf = document->GetElementById(CreateString(32, "value_%d_%d", num_panels / 2, num_rows / 2));
+	Element* footer_leaf = document->GetElementById("footer_value");
+	REQUIRE(panel_leaf);
+	REQUIRE(footer_leaf);
+
+	LayoutEngine::GetAndResetNumFormattedElements();
+	mutate_leaf_and_update(panel_leaf);
+	const int num_formatted_panel_leaf = LayoutEngine::GetAndResetNumFormattedElements();
+
+	mutate_leaf_and_update(footer_leaf);
+	const int num_formatted_footer_leaf = LayoutEngine::GetAndResetNumFormattedElements();
+
+	MESSAGE("Formatted elements during initial layout: " << num_formatted_full_layout);
+	MESSAGE("Formatted elements after changing a leaf inside a fixed-size flex item: " << num_formatted_panel_leaf);
+	MESSAGE("Formatted elements after changing a leaf in the document flow: " << num_formatted_footer_leaf);
+
+	// Unchanged subtrees reuse their cached layout when the document is formatted, thus neither case should format more than a small part of it.
+	CHECK(num_formatted_panel_leaf < num_formatted_full_layout / 10);
+	CHECK(num_formatted_footer_leaf < num_formatted_full_layout / 10);
+
+	{
+		nanobench::Bench bench;
+		bench.title("ElementDocument incremental layout");
+		bench.timeUnit(std::chrono::microseconds(1), "us");
+		bench.relative(true);
+
+		bench.run("Mutate leaf in flow (document layout)", [&] { mutate_leaf_and_update(footer_leaf); });
+		bench.run("Mutate leaf in flex item (relayout boundary)", [&] { mutate_leaf_and_update(panel_leaf); });
+	}
+
+	document->Close();
+	context->Update();
+}
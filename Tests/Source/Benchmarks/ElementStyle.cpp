@@ -248,3 +248,153 @@ TEST_CASE("elementstyle")
 		context->Update();
 	}
 }
+
+static String GenerateDescendantRCSS(const int depth, bool matching_ancestors)
+{
+	// Each rule requires a chain of ancestors. Non-matching rules only miss a single ancestor, so that the element and all but one of the
+	// ancestors match, requiring a walk all the way up the tree in the worst case.
+	String result;
+
+	for (int i = 0; i < num_rule_iterations; i++)
+	{
+		for (char c = 'a'; c <= 'z'; c++)
+		{
+			const String name(i + 1, c);
+			const String missing_class = (matching_ancestors ? "level0" : "missing-" + name);
+			result += CreateString(128, ".%s .level%d .level%d .col { scrollbar-margin: %dpx; }\n", missing_class.c_str(), (c - 'a') % depth,
+				depth - 1, int(c - 'a') + 1);
+		}
+	}
+
+	return result;
+}
+
+static String GenerateNestedRml(const int depth, const int num_rows)
+{
+	String rml;
+	for (int i = 0; i < depth; i++)
+		rml += CreateString(32, "<div class=\"level%d\">", i);
+
+	rml += GenerateRml(num_rows);
+
+	for (int i = 0; i < depth; i++)
+		rml += "</div>";
+
+	return rml;
+}
+
+TEST_CASE("elementstyle.deep_descendant")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 50;
+	constexpr int depth = 20;
+	const String rml = GenerateNestedRml(depth, num_rows);
+
+	// Benchmark style rules with long chains of descendant selectors, applied to deeply nested elements. Matching these rules requires
+	// walking up the ancestors of each element, unless they can be rejected early.
+
+	nanobench::Bench bench;
+	bench.title("ElementStyle (deep descendant selectors)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	for (int i = 0; i < 3; i++)
+	{
+		const bool reference = (i == 0);
+		const bool matching_ancestors = (i == 2);
+
+		const String styles = reference ? "" : GenerateDescendantRCSS(depth, matching_ancestors);
+		const String compiled_document_rml = Rml::CreateString(1000 + styles.size(), document_rml_template, styles.c_str());
+
+		ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+		document->Show();
+
+		Element* el = document->GetElementById("performance");
+		el->SetInnerRML(rml);
+		context->Update();
+		context->Render();
+
+		if (reference)
+		{
+			String msg = Rml::CreateString(128, "\nElement update after pseudo class change with %d descendant elements nested %d levels deep, and %d RCSS rules.",
+				GetNumDescendentElements(el), depth, num_rule_iterations * 26);
+			MESSAGE(msg);
+		}
+
+		const char* name = reference ? "Reference (no style rules)" : (matching_ancestors ? "Matching ancestors" : "Missing ancestor");
+
+		bool hover_active = false;
+
+		bench.run(name, [&] {
+			hover_active = !hover_active;
+			// Toggle some arbitrary pseudo class on the element to dirty the definition on this and all descendent elements.
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+
+		bench.run(String(name) + " (SetInnerRML + Update)", [&] {
+			el->SetInnerRML(rml);
+			context->Update();
+		});
+
+		document->Close();
+		context->Update();
+	}
+}
+
+TEST_CASE("elementstyle.shared_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_items = 500;
+
+	// Benchmark the computation of values for long lists of sibling elements with identical style. Siblings with the same definition and no
+	// inline properties can share their computed values, while the inline style in the reference disables sharing.
+	const String styles = R"(
+		.item { display: block; margin: 2px 0; padding: 0.5em 1em; border: 1px #666; background-color: #333; line-height: 1.5; }
+		.item span { color: #ddd; font-size: 1.2em; }
+		#performance:hover .item { background-color: #444; }
+	)";
+	const String compiled_document_rml = Rml::CreateString(1000 + styles.size(), document_rml_template, styles.c_str());
+
+	String rml_shared, rml_inline;
+	for (int i = 0; i < num_items; i++)
+	{
+		rml_shared += CreateString(128, "<div class=\"item\"><span>Item %d</span></div>", i);
+		rml_inline += CreateString(128, "<div class=\"item\" style=\"margin-left: %dpx;\"><span>Item %d</span></div>", i % 2, i);
+	}
+
+	nanobench::Bench bench;
+	bench.title("ElementStyle (shared values)");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(compiled_document_rml);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+
+	for (const bool inline_style : {true, false})
+	{
+		const String& rml = (inline_style ? rml_inline : rml_shared);
+		const String name = (inline_style ? "Reference (inline style)" : "Identical siblings");
+
+		bench.run(name + " (SetInnerRML + Update)", [&] {
+			el->SetInnerRML(rml);
+			context->Update();
+		});
+
+		bool hover_active = false;
+		bench.run(name + " (pseudo class change)", [&] {
+			hover_active = !hover_active;
+			el->SetPseudoClass("hover", hover_active);
+			context->Update();
+		});
+	}
+
+	document->Close();
+	context->Update();
+}
@@ -0,0 +1,148 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_events_rml = R"(
+<rml>
+<head>
+	<title>Events</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+		}
+		.branch {
+			position: absolute;
+			top: 0;
+			width: 300px;
+			height: 300px;
+		}
+		div {
+			display: block;
+			height: 100%;
+		}
+	</style>
+</head>
+
+<body>
+<div class="branch" id="left" style="left: 0"/>
+<div class="branch" id="right" style="left: 400px"/>
+</body>
+</rml>
+)";
+
+class CountingListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+	int num_events = 0;
+};
+
+static Element* AppendDescendants(Element* element, const int depth)
+{
+	for (int i = 0; i < depth; i++)
+		element = element->AppendChild(element->GetOwnerDocument()->CreateElement("div"));
+	return element;
+}
+
+TEST_CASE("events")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_events_rml);
+	REQUIRE(document);
+	document->Show();
+
+	constexpr int depth = 50;
+	Element* left = AppendDescendants(document->GetElementById("left"), depth);
+	Element* right = AppendDescendants(document->GetElementById("right"), depth);
+
+	context->Update();
+	context->Render();
+
+	const int left_x = 100, right_x = 500, y = 100;
+
+	nanobench::Bench bench;
+	bench.title("Events");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+	bench.minEpochIterations(1000);
+
+	int x_offset = 0;
+	bench.run("Mousemove (no listeners)", [&] {
+		x_offset = (x_offset + 1) % 20;
+		context->ProcessMouseMove(left_x + x_offset, y, 0);
+	});
+
+	bench.run("Dispatch mousemove (no listeners)", [&] { left->DispatchEvent(EventId::Mousemove, Dictionary()); });
+	bench.run("Dispatch scroll (no listeners)", [&] { left->DispatchEvent(EventId::Scroll, Dictionary()); });
+
+	bool on_left = false;
+	bench.run("Mousemove hover change (no listeners)", [&] {
+		on_left = !on_left;
+		context->ProcessMouseMove(on_left ? left_x : right_x, y, 0);
+	});
+
+	CountingListener listener;
+	document->AddEventListener(EventId::Mousemove, &listener);
+	document->AddEventListener(EventId::Mouseover, &listener);
+
+	bench.run("Mousemove (listener on document)", [&] {
+		x_offset = (x_offset + 1) % 20;
+		context->ProcessMouseMove(left_x + x_offset, y, 0);
+	});
+
+	bench.run("Mousemove hover change (listener on document)", [&] {
+		on_left = !on_left;
+		context->ProcessMouseMove(on_left ? left_x : right_x, y, 0);
+	});
+
+	CHECK(listener.num_events > 0);
+	CHECK(context->GetHoverElement() != nullptr);
+	CHECK((context->GetHoverElement() == left || context->GetHoverElement() == right));
+
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	document->RemoveEventListener(EventId::Mouseover, &listener);
+
+	document->Close();
+	context->Update();
+}
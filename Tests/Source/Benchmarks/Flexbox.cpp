@@ -26,6 +26,7 @@
  *
  */
 
+#include "../../../Source/Core/LayoutEngine.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
@@ -491,3 +492,94 @@ TEST_CASE("flexbox")
 		document->Close();
 	}
 }
+
+static const String rml_flexbox_inventory_document = R"(
+<rml>
+<head>
+    <title>Flex 04 - Inventory</title>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		.inventory {
+			display: flex;
+			flex-wrap: wrap;
+			background: #666;
+		}
+		.slot {
+			display: flex;
+			flex-direction: column;
+			margin: 3dp;
+			padding: 3dp;
+			background-color: #edd3c0;
+		}
+		.icon {
+			width: 32dp;
+			height: 32dp;
+			background-color: #eb6e14;
+		}
+	</style>
+</head>
+<body>
+<p id="status">Status</p>
+<div class="inventory" id="inventory"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("flexbox.layout_cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	nanobench::Bench bench;
+	bench.title("Flexbox layout cache");
+	bench.relative(true);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml_flexbox_inventory_document);
+	REQUIRE(document);
+	document->Show();
+
+	Element* status = document->GetElementById("status");
+	Element* inventory = document->GetElementById("inventory");
+	REQUIRE(status);
+	REQUIRE(inventory);
+
+	String inventory_rml;
+	for (int i = 0; i < 200; i++)
+		inventory_rml += CreateString(128, R"(<div class="slot"><div class="icon"/><span>Item %d</span><span id="count%d">x%d</span></div>)", i, i, i);
+	inventory->SetInnerRML(inventory_rml);
+
+	context->Update();
+	context->Render();
+	TestsShell::RenderLoop();
+
+	Element* count = document->GetElementById("count42");
+	REQUIRE(count);
+
+	// The content-sized items are measured several times, both during a single layout and across layouts.
+	LayoutEngine::GetAndResetCacheStatistics();
+	status->SetInnerRML("Status changed");
+	context->Update();
+	LayoutEngine::CacheStatistics statistics = LayoutEngine::GetAndResetCacheStatistics();
+	MESSAGE("Layout cache when changing text outside the items: " << statistics.num_hits << " hits, " << statistics.num_misses << " misses.");
+	CHECK(statistics.num_hits > statistics.num_misses);
+
+	count->SetInnerRML("x1000");
+	context->Update();
+	statistics = LayoutEngine::GetAndResetCacheStatistics();
+	MESSAGE("Layout cache when changing text inside a single item: " << statistics.num_hits << " hits, " << statistics.num_misses << " misses.");
+
+	int counter = 0;
+	bench.run("Update (unmodified)", [&] { context->Update(); });
+
+	bench.run("Change text outside items + Update", [&] {
+		status->SetInnerRML(counter++ % 2 == 0 ? "Status" : "Status changed");
+		context->Update();
+	});
+
+	bench.run("Change text inside item + Update", [&] {
+		count->SetInnerRML(counter++ % 2 == 0 ? "x42" : "x1000");
+		context->Update();
+	});
+
+	document->Close();
+}
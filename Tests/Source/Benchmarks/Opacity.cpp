@@ -0,0 +1,124 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+    <link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		#menu {
+			opacity: 1;
+		}
+		.item {
+			height: 20px;
+			margin: 2px;
+			padding: 2px 5px;
+			background: #335;
+			border: 1px #88c;
+			color: #eee;
+		}
+		.item img {
+			width: 16px;
+			height: 16px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="menu"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("opacity")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* menu = document->GetElementById("menu");
+	REQUIRE(menu);
+
+	// Each item consists of five elements, including text.
+	constexpr int num_items = 100;
+	String rml;
+	for (int i = 0; i < num_items; i++)
+		rml += CreateString(128, "<div class=\"item\"><img src=\"/assets/high_scores_alien_1.tga\"/><span>Menu item %d</span></div>", i);
+	menu->SetInnerRML(rml);
+
+	TestsShell::RenderLoop();
+
+	const String msg = TestsShell::GetRenderStats();
+	MESSAGE(msg);
+
+	nanobench::Bench bench;
+	bench.title("Opacity");
+	bench.relative(true);
+	bench.minEpochIterations(100);
+	bench.warmup(50);
+
+	bench.run("Reference (update + render)", [&] {
+		context->Update();
+		context->Render();
+	});
+
+	// Fading the menu changes the opacity of all its descendants, like every frame of an opacity animation.
+	int frame = 0;
+	bench.run("Fade menu", [&] {
+		frame = (frame + 1) % 100;
+		menu->SetProperty(PropertyId::Opacity, Property(0.01f * float(frame), Unit::NUMBER));
+		context->Update();
+		context->Render();
+	});
+
+	// For comparison, changing the color regenerates the geometry of all the text.
+	bench.run("Recolor menu text", [&] {
+		frame = (frame + 1) % 100;
+		menu->SetProperty(PropertyId::Color, Property(Colourb(byte(155 + frame), 255, 255), Unit::COLOUR));
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+}
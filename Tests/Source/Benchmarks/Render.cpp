@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_render_rml = R"(
+<rml>
+<head>
+	<title>Render</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 15px;
+			color: #fff;
+		}
+		body.no_culling {
+			transform: translateX(0px);
+		}
+		#scroll {
+			height: 400px;
+			overflow: auto;
+		}
+		#scroll div {
+			background-color: #333;
+			border: 1px #aaa;
+			padding: 2px 5px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroll"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("render.long_scroll_container")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_render_rml);
+	REQUIRE(document);
+
+	constexpr int num_rows = 5000;
+	Element* scroll = document->GetElementById("scroll");
+	String rows_rml;
+	for (int i = 0; i < num_rows; i++)
+		rows_rml += CreateString(64, "<div>Row %d</div>", i);
+	scroll->SetInnerRML(rows_rml);
+
+	document->Show();
+	context->Update();
+
+	nanobench::Bench bench;
+	bench.title("Long scroll container");
+	bench.relative(true);
+	bench.minEpochIterations(20);
+	bench.warmup(5);
+
+	const float scroll_middle = 0.5f * (scroll->GetScrollHeight() - scroll->GetClientHeight());
+
+	// Transforms disable culling, use this as the reference.
+	document->SetClass("no_culling", true);
+	scroll->SetScrollTop(scroll_middle);
+	context->Update();
+	MESSAGE("Culling disabled:\n" << TestsShell::GetRenderStats());
+
+	bench.run("Render (culling disabled)", [&] { context->Render(); });
+
+	document->SetClass("no_culling", false);
+	context->Update();
+	MESSAGE("Culling enabled:\n" << TestsShell::GetRenderStats());
+
+	bench.run("Render", [&] { context->Render(); });
+
+	float scroll_top = 0.f;
+	bench.run("Scroll + update + render", [&] {
+		scroll_top = (scroll_top > scroll_middle ? 0.f : scroll_top + 50.f);
+		scroll->SetScrollTop(scroll_top);
+		context->Update();
+		context->Render();
+	});
+
+	document->Close();
+	context->Update();
+}
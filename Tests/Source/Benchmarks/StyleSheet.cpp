@@ -0,0 +1,143 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static constexpr const char* document_stylesheet_rml_template = R"(
+<rml>
+<head>
+	<title>Benchmark Sample</title>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			width: 800px;
+			height: 600px;
+		}
+%s
+	</style>
+</head>
+<body>
+%s
+</body>
+</rml>
+)";
+
+static constexpr int num_classes = 200;
+
+static String GenerateLargeRCSS(const int num_rules)
+{
+	static const char* declarations[] = {
+		"color: #%02x%02x%02x;",
+		"background-color: #%02x%02x%02x;",
+		"border: %dpx #%02x%02x;",
+		"padding: %dpx %dpx %dpx;",
+		"margin-left: %dpx; margin-top: %dpx; margin-right: %dpx;",
+		"font-size: %dpx; line-height: %d.%dem;",
+	};
+	constexpr int num_declarations = int(sizeof(declarations) / sizeof(declarations[0]));
+
+	nanobench::Rng rng(42);
+
+	String result;
+	result.reserve(num_rules * 100);
+
+	for (int i = 0; i < num_rules; i++)
+	{
+		const int class_a = int(rng() % num_classes);
+		const int class_b = int(rng() % num_classes);
+		result += CreateString(64, ".c%d.c%d, #id%d {", class_a, class_b, i);
+
+		for (int j = 0; j < 3; j++)
+		{
+			// Use a small set of values so that many rules have identical declarations.
+			const int v0 = int(rng() % 4) + 1, v1 = int(rng() % 4) + 1, v2 = int(rng() % 4) + 1;
+			result += ' ';
+			result += CreateString(128, declarations[rng() % num_declarations], v0, v1, v2);
+		}
+		result += " }\n";
+	}
+
+	return result;
+}
+
+static String GenerateClassRml(const int num_elements)
+{
+	nanobench::Rng rng(7);
+
+	String result;
+	for (int i = 0; i < num_elements; i++)
+		result += CreateString(128, "<div class=\"c%d c%d c%d\"/>\n", int(rng() % num_classes), int(rng() % num_classes), int(rng() % num_classes));
+
+	return result;
+}
+
+TEST_CASE("stylesheet.large")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rules = 20'000;
+	constexpr int num_elements = 1000;
+
+	const String rcss = GenerateLargeRCSS(num_rules);
+	const String elements_rml = GenerateClassRml(num_elements);
+	const String document_rml = CreateString(rcss.size() + elements_rml.size() + 1000, document_stylesheet_rml_template, rcss.c_str(), elements_rml.c_str());
+
+	nanobench::Bench bench;
+	bench.title("Large style sheet");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+	bench.relative(true);
+	bench.minEpochIterations(5);
+
+	bench.run("Parse style sheet", [&] {
+		SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(rcss);
+		nanobench::doNotOptimizeAway(style_sheet);
+	});
+
+	bench.run("Load document", [&] {
+		ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+		document->Show();
+		context->Update();
+		document->Close();
+		context->Update();
+	});
+
+	Factory::ClearStyleSheetCache();
+}
@@ -0,0 +1,119 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_text_rml = R"(
+<rml>
+<head>
+	<title>Text</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 15px;
+			color: #fff;
+		}
+		#text {
+			width: 600px;
+		}
+		p {
+			margin: 0.5em 0;
+		}
+		em {
+			font-style: italic;
+		}
+	</style>
+</head>
+
+<body>
+<div id="text"/>
+</body>
+</rml>
+)";
+
+static const char* lorem_ipsum = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna "
+								 "aliqua. Ut enim ad minim veniam, quis nostrud <em>exercitation ullamco laboris</em> nisi ut aliquip ex ea commodo "
+								 "consequat. Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur. "
+								 "Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit anim id est laborum.";
+
+TEST_CASE("text.paragraphs")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_text_rml);
+	REQUIRE(document);
+
+	constexpr int num_paragraphs = 200;
+	Element* text = document->GetElementById("text");
+	String paragraphs_rml;
+	for (int i = 0; i < num_paragraphs; i++)
+		paragraphs_rml += CreateString(1024, "<p>%d. %s</p>", i, lorem_ipsum);
+	text->SetInnerRML(paragraphs_rml);
+
+	document->Show();
+	context->Update();
+	context->Render();
+
+	nanobench::Bench bench;
+	bench.title("Text paragraphs");
+	bench.relative(true);
+	bench.minEpochIterations(10);
+	bench.warmup(3);
+
+	// Every width change reformats all the text, measuring each word again.
+	int width = 600;
+	bench.run("Resize + update", [&] {
+		width = (width >= 700 ? 500 : width + 10);
+		text->SetProperty(PropertyId::Width, Property(float(width), Unit::PX));
+		context->Update();
+	});
+
+	bench.run("Change text + update", [&] {
+		width = (width >= 700 ? 500 : width + 10);
+		text->SetInnerRML(CreateString(64, "<p>Width %d</p>", width) + paragraphs_rml);
+		context->Update();
+	});
+
+	document->Close();
+	context->Update();
+}
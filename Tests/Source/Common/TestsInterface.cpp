@@ -83,9 +83,25 @@ void TestsSystemInterface::SetTime(double t)
 	elapsed_time = t;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* vertices, int /*num_vertices*/, int* indices, int num_indices, const Rml::TextureHandle texture, const Rml::Vector2f& translation)
 {
 	counters.render_calls += 1;
+	RecordGeometry(vertices, indices, num_indices, texture, translation);
+}
+
+bool TestsRenderInterface::SupportsDrawLists()
+{
+	return draw_lists_enabled;
+}
+
+void TestsRenderInterface::RenderDrawList(const Rml::DrawList& draw_list)
+{
+	counters.render_draw_list += 1;
+	for (const Rml::DrawListCommand& command : draw_list.commands)
+	{
+		RecordGeometry(draw_list.vertices.data(), draw_list.indices.data() + command.index_offset, command.num_indices, command.texture,
+			Rml::Vector2f(0.f));
+	}
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
@@ -114,6 +130,13 @@ bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, c
 	return true;
 }
 
+bool TestsRenderInterface::UpdateTexture(Rml::TextureHandle /*texture_handle*/, const Rml::byte* /*source*/, const Rml::Vector2i& /*offset*/,
+	const Rml::Vector2i& /*dimensions*/)
+{
+	counters.update_texture += 1;
+	return true;
+}
+
 void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
 {
 	counters.release_texture += 1;
@@ -123,3 +146,33 @@ void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
 }
+
+void TestsRenderInterface::PushLayer(Rml::RenderClear /*clear_new_layer*/)
+{
+	counters.push_layer += 1;
+}
+
+Rml::TextureHandle TestsRenderInterface::PopLayer(Rml::RenderTarget render_target, Rml::BlendMode /*blend_mode*/)
+{
+	counters.pop_layer += 1;
+	return render_target == Rml::RenderTarget::RenderTexture ? 1 : 0;
+}
+
+void TestsRenderInterface::RecordGeometry(const Rml::Vertex* vertices, const int* indices, int num_indices, Rml::TextureHandle texture,
+	Rml::Vector2f translation)
+{
+	if (!geometry_recording_enabled)
+		return;
+
+	for (int i = 0; i + 2 < num_indices; i += 3)
+	{
+		Triangle triangle;
+		for (int j = 0; j < 3; j++)
+		{
+			triangle.vertices[j] = vertices[indices[i + j]];
+			triangle.vertices[j].position += translation;
+		}
+		triangle.texture = texture;
+		recorded_triangles.push_back(triangle);
+	}
+}
@@ -62,28 +62,60 @@ public:
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
+		size_t update_texture;
 		size_t release_texture;
 		size_t set_transform;
+		size_t render_draw_list;
+		size_t push_layer;
+		size_t pop_layer;
+	};
+
+	// A rendered triangle, with its translation applied to the vertices.
+	struct Triangle {
+		Rml::Vertex vertices[3];
+		Rml::TextureHandle texture;
 	};
 
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture,
 		const Rml::Vector2f& translation) override;
 
+	bool SupportsDrawLists() override;
+	void RenderDrawList(const Rml::DrawList& draw_list) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
 	bool LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& source) override;
 	bool GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* source, const Rml::Vector2i& source_dimensions) override;
+	bool UpdateTexture(Rml::TextureHandle texture_handle, const Rml::byte* source, const Rml::Vector2i& offset,
+		const Rml::Vector2i& dimensions) override;
 	void ReleaseTexture(Rml::TextureHandle texture_handle) override;
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	void PushLayer(Rml::RenderClear clear_new_layer) override;
+	Rml::TextureHandle PopLayer(Rml::RenderTarget render_target, Rml::BlendMode blend_mode) override;
+
 	const Counters& GetCounters() const { return counters; }
 
 	void ResetCounters() { counters = {}; }
 
+	// Submit geometry through draw lists instead of a render call for each geometry, takes effect from the next context render.
+	void EnableDrawLists(bool enable) { draw_lists_enabled = enable; }
+
+	// Records the triangles of all rendered geometry in submission order, while enabled.
+	void EnableGeometryRecording(bool enable) { geometry_recording_enabled = enable; }
+	const Rml::Vector<Triangle>& GetRecordedTriangles() const { return recorded_triangles; }
+	void ResetRecordedTriangles() { recorded_triangles.clear(); }
+
 private:
+	void RecordGeometry(const Rml::Vertex* vertices, const int* indices, int num_indices, Rml::TextureHandle texture, Rml::Vector2f translation);
+
 	Counters counters = {};
+
+	bool draw_lists_enabled = false;
+	bool geometry_recording_enabled = false;
+	Rml::Vector<Triangle> recorded_triangles;
 };
 
 #endif
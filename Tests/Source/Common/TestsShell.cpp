@@ -177,22 +177,30 @@ Rml::String TestsShell::GetRenderStats()
 	shell_context->Render();
 	auto& counters = shell_render_interface.GetCounters();
 
-	result = Rml::CreateString(256,
+	result = Rml::CreateString(512,
 		"Context::Render() stats:\n"
 		"  Render calls: %zu\n"
 		"  Scissor enable: %zu\n"
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
 		"  Texture generate: %zu\n"
+		"  Texture update: %zu\n"
 		"  Texture release: %zu\n"
-		"  Transform set: %zu",
+		"  Transform set: %zu\n"
+		"  Draw lists: %zu\n"
+		"  Layer push: %zu\n"
+		"  Layer pop: %zu",
 		counters.render_calls,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
 		counters.generate_texture,
+		counters.update_texture,
 		counters.release_texture,
-		counters.set_transform
+		counters.set_transform,
+		counters.render_draw_list,
+		counters.push_layer,
+		counters.pop_layer
 	);
 
 #endif
@@ -204,3 +212,12 @@ TestsSystemInterface* TestsShell::GetTestsSystemInterface()
 {
 	return &tests_system_interface;
 }
+
+TestsRenderInterface* TestsShell::GetTestsRenderInterface()
+{
+#ifdef RMLUI_TESTS_USE_SHELL
+	return nullptr;
+#else
+	return &shell_render_interface;
+#endif
+}
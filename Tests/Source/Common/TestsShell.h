@@ -31,6 +31,7 @@
 
 #include <RmlUi/Core/Types.h>
 class TestsSystemInterface;
+class TestsRenderInterface;
 
 namespace TestsShell {
 
@@ -55,6 +56,9 @@ namespace TestsShell {
 	Rml::String GetRenderStats();
 
 	TestsSystemInterface* GetTestsSystemInterface();
+
+	// Returns nullptr when rendering to the shell window, the dummy renderer is used otherwise.
+	TestsRenderInterface* GetTestsRenderInterface();
 }
 
 #endif
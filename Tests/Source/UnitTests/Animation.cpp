@@ -28,9 +28,12 @@
 
 #include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Transform.h>
+#include <RmlUi/Core/TransformPrimitive.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -157,3 +160,120 @@ TEST_CASE("animation.filter")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_transform_opacity_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+		}
+		.box {
+			position: absolute;
+			left: 100px;
+			top: 100px;
+			width: 64px;
+			height: 64px;
+			transform: rotate(0deg);
+		}
+		#own-opacity {
+			opacity: 0.5;
+		}
+	</style>
+</head>
+
+<body>
+	<div id="fade">Text<div id="inherit"><span>Nested</span></div><div id="own-opacity">Own</div></div>
+	<div class="box" id="spin"/>
+	<div class="box" id="reference"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("animation.transform_and_opacity")
+{
+	TestsSystemInterface* system_interface = TestsShell::GetTestsSystemInterface();
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	system_interface->SetTime(0.0);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_transform_opacity_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	Element* fade = document->GetElementById("fade");
+	Element* inherit = document->GetElementById("inherit");
+	Element* own_opacity = document->GetElementById("own-opacity");
+	Element* spin = document->GetElementById("spin");
+	Element* reference = document->GetElementById("reference");
+
+	REQUIRE(fade->Animate("opacity", Property(0.f, Unit::NUMBER), 0.1f));
+	REQUIRE(spin->Animate("transform", Property(TransformPtr(MakeShared<Transform>(Transform::PrimitiveList{Transforms::Rotate2D(90.f, Unit::DEG)})), Unit::TRANSFORM), 0.1f));
+	context->Update();
+	context->Render();
+
+	auto CheckSameTransform = [&]() {
+		// The reference element receives the animated transform through the style system.
+		reference->SetProperty(PropertyId::Transform, *spin->GetProperty(PropertyId::Transform));
+		context->Update();
+		context->Render();
+
+		for (Vector2f point : {Vector2f(110, 120), Vector2f(150, 105), Vector2f(160, 160)})
+		{
+			Vector2f projected_spin = point, projected_reference = point;
+			REQUIRE(spin->Project(projected_spin));
+			REQUIRE(reference->Project(projected_reference));
+			CHECK(projected_spin.x == doctest::Approx(projected_reference.x));
+			CHECK(projected_spin.y == doctest::Approx(projected_reference.y));
+		}
+	};
+
+	// Intermediate values are applied without the style system computing any values, including for the descendants inheriting the opacity.
+	system_interface->SetTime(0.025);
+	context->Update();
+	context->Render();
+	context->Update();
+	CHECK(context->GetFrameStatistics().num_elements_updated == 0);
+
+	CHECK(fade->GetProperty<float>("opacity") == doctest::Approx(0.75f));
+	CHECK(fade->GetComputedValues().opacity() == doctest::Approx(0.75f));
+	CHECK(inherit->GetComputedValues().opacity() == doctest::Approx(0.75f));
+	CHECK(inherit->GetFirstChild()->GetComputedValues().opacity() == doctest::Approx(0.75f));
+	CHECK(own_opacity->GetComputedValues().opacity() == 0.5f);
+
+	Vector2f projected_center(132, 132);
+	REQUIRE(spin->Project(projected_center));
+	CHECK(projected_center.x == doctest::Approx(132.f));
+	CHECK(projected_center.y == doctest::Approx(132.f));
+	CheckSameTransform();
+
+	// The computed values stay consistent when the style system updates the elements again.
+	inherit->SetProperty(PropertyId::Color, Property(Colourb(255, 0, 0), Unit::COLOUR));
+	context->Update();
+	CHECK(inherit->GetComputedValues().opacity() == doctest::Approx(0.75f));
+	CHECK(inherit->GetFirstChild()->GetComputedValues().opacity() == doctest::Approx(0.75f));
+
+	// The final values are set through the style system.
+	system_interface->SetTime(0.2);
+	context->Update();
+	context->Render();
+
+	CHECK(fade->GetComputedValues().opacity() == 0.f);
+	CHECK(inherit->GetFirstChild()->GetComputedValues().opacity() == 0.f);
+	CHECK(own_opacity->GetComputedValues().opacity() == 0.5f);
+	CheckSameTransform();
+
+	document->Close();
+	system_interface->SetTime(0.0);
+
+	TestsShell::ShutdownShell();
+}
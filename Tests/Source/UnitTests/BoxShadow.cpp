@@ -0,0 +1,148 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_box_shadow_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		.button {
+			width: 100px;
+			height: 30px;
+			margin: 10px;
+			background-color: #333;
+			border: 2px #aaa;
+			border-radius: 5px;
+			box-shadow: #000 2px 2px 5px, #f00a 0 0 3px 1px inset;
+		}
+		.wide {
+			width: 150px;
+		}
+	</style>
+</head>
+
+<body>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button"/>
+<div class="button wide"/>
+<div class="button wide"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("box_shadow.shared_textures")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_box_shadow_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	const BoxShadowCacheStatistics initial = context->GetBoxShadowCacheStatistics();
+	CHECK(initial.num_textures == 0);
+
+	auto RenderAndCountGeneratedTextures = [&]() -> size_t {
+		if (render_interface)
+			render_interface->ResetCounters();
+		context->Update();
+		context->Render();
+		return render_interface ? render_interface->GetCounters().pop_layer : 0;
+	};
+
+	// Each unique box-shadow is only generated once, and shared between all elements using it.
+	const size_t num_generated = RenderAndCountGeneratedTextures();
+	BoxShadowCacheStatistics statistics = context->GetBoxShadowCacheStatistics();
+	CHECK(statistics.num_textures == 2);
+	CHECK(statistics.num_users == 10);
+	CHECK(statistics.num_misses - initial.num_misses == 2);
+	CHECK(statistics.num_hits - initial.num_hits == 8);
+
+	// The tests render interface does not support filters, thus each generated texture pops a single layer.
+	if (render_interface)
+	{
+		CHECK(num_generated == 2);
+		CHECK(statistics.texture_memory > 0);
+	}
+
+	CHECK(RenderAndCountGeneratedTextures() == 0);
+
+	// Changing the size of a single element only generates a texture for the new size.
+	ElementList buttons;
+	document->GetElementsByClassName(buttons, "button");
+	REQUIRE(buttons.size() == 10);
+	buttons[0]->SetClass("wide", true);
+
+	CHECK(RenderAndCountGeneratedTextures() == 0);
+	statistics = context->GetBoxShadowCacheStatistics();
+	CHECK(statistics.num_textures == 2);
+	CHECK(statistics.num_users == 10);
+
+	buttons[1]->SetProperty(PropertyId::Width, Property(120.f, Unit::PX));
+
+	if (render_interface)
+		CHECK(RenderAndCountGeneratedTextures() == 1);
+	else
+		RenderAndCountGeneratedTextures();
+	statistics = context->GetBoxShadowCacheStatistics();
+	CHECK(statistics.num_textures == 3);
+	CHECK(statistics.num_users == 10);
+
+	// Textures are released when no longer used.
+	buttons[1]->RemoveProperty(PropertyId::Width);
+	RenderAndCountGeneratedTextures();
+	CHECK(context->GetBoxShadowCacheStatistics().num_textures == 2);
+
+	document->Close();
+	context->Update();
+
+	CHECK(context->GetBoxShadowCacheStatistics().num_textures == 0);
+}
@@ -0,0 +1,184 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include <RmlUi/Core/ConvolutionFilter.h>
+#include <RmlUi/Core/Math.h>
+#include <doctest.h>
+#include <float.h>
+
+using namespace Rml;
+
+// Straightforward implementation of the filter to compare against.
+static void RunReferenceFilter(const float* kernel, Vector2i kernel_radius, FilterOperation operation, byte* destination,
+	Vector2i destination_dimensions, int destination_stride, ColorFormat destination_color_format, const byte* source,
+	Vector2i source_dimensions, Vector2i source_offset, ColorFormat source_color_format)
+{
+	const Vector2i kernel_size = kernel_radius * 2 + Vector2i(1);
+	const int destination_bytes_per_pixel = (destination_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int destination_alpha_offset = (destination_color_format == ColorFormat::RGBA8 ? 3 : 0);
+	const int source_bytes_per_pixel = (source_color_format == ColorFormat::RGBA8 ? 4 : 1);
+	const int source_alpha_offset = (source_color_format == ColorFormat::RGBA8 ? 3 : 0);
+
+	for (int y = 0; y < destination_dimensions.y; ++y)
+	{
+		for (int x = 0; x < destination_dimensions.x; ++x)
+		{
+			float opacity = (operation == FilterOperation::Erosion ? FLT_MAX : 0.f);
+
+			for (int kernel_y = 0; kernel_y < kernel_size.y; ++kernel_y)
+			{
+				for (int kernel_x = 0; kernel_x < kernel_size.x; ++kernel_x)
+				{
+					float pixel_opacity = 0.f;
+
+					const int source_x = x - source_offset.x - kernel_radius.x + kernel_x;
+					const int source_y = y - source_offset.y - kernel_radius.y + kernel_y;
+					if (source_y >= 0 && source_y < source_dimensions.y && source_x >= 0 && source_x < source_dimensions.x)
+					{
+						const int source_index = (source_y * source_dimensions.x + source_x) * source_bytes_per_pixel + source_alpha_offset;
+						pixel_opacity = float(source[source_index]) * kernel[kernel_y * kernel_size.x + kernel_x];
+					}
+
+					switch (operation)
+					{
+					case FilterOperation::Sum: opacity += pixel_opacity; break;
+					case FilterOperation::Dilation: opacity = Math::Max(opacity, pixel_opacity); break;
+					case FilterOperation::Erosion: opacity = Math::Min(opacity, pixel_opacity); break;
+					}
+				}
+			}
+
+			destination[y * destination_stride + x * destination_bytes_per_pixel + destination_alpha_offset] = byte(Math::Min(255.f, opacity));
+		}
+	}
+}
+
+enum class KernelType { Blur, BlurHorizontal, Outline, Random };
+
+static void FillKernel(ConvolutionFilter& filter, Vector<float>& kernel, KernelType type, Vector2i radius)
+{
+	const Vector2i size = radius * 2 + Vector2i(1);
+	kernel.resize(size.x * size.y);
+
+	for (int y = -radius.y; y <= radius.y; y++)
+	{
+		for (int x = -radius.x; x <= radius.x; x++)
+		{
+			float weight = 0.f;
+			switch (type)
+			{
+			case KernelType::Blur:
+			case KernelType::BlurHorizontal:
+			{
+				const float two_variance = 2.f * Math::Max(0.16f * float(radius.x * radius.x), 1.f);
+				weight = 0.2f * Math::Exp(-float(x * x + y * y) / two_variance);
+			}
+			break;
+			case KernelType::Outline:
+			{
+				const float distance = Math::SquareRoot(float(x * x + y * y));
+				weight = (distance > radius.x ? Math::Max((radius.x + 1) - distance, 0.0f) : 1.f);
+			}
+			break;
+			case KernelType::Random:
+				weight = float((x * 7 + y * 13 + 5) % 11) / 20.f;
+				break;
+			}
+
+			filter[y + radius.y][x + radius.x] = weight;
+			kernel[(y + radius.y) * size.x + x + radius.x] = weight;
+		}
+	}
+}
+
+TEST_CASE("convolution_filter")
+{
+	const Vector2i source_dimensions(23, 17);
+
+	Vector<byte> source_a8(source_dimensions.x * source_dimensions.y);
+	Vector<byte> source_rgba8(source_a8.size() * 4, byte(0x7f));
+	for (int i = 0; i < (int)source_a8.size(); i++)
+	{
+		source_a8[i] = byte((i * 37) % 256 > 128 ? 255 : (i * 11) % 256);
+		source_rgba8[i * 4 + 3] = source_a8[i];
+	}
+
+	struct TestCase {
+		KernelType type;
+		FilterOperation operation;
+		int tolerance;
+	};
+	const TestCase test_cases[] = {
+		{KernelType::Blur, FilterOperation::Sum, 1},
+		{KernelType::BlurHorizontal, FilterOperation::Sum, 0},
+		{KernelType::Random, FilterOperation::Sum, 0},
+		{KernelType::Outline, FilterOperation::Dilation, 0},
+		{KernelType::Outline, FilterOperation::Erosion, 0},
+		{KernelType::Random, FilterOperation::Dilation, 0},
+		{KernelType::Random, FilterOperation::Erosion, 0},
+	};
+
+	for (const TestCase& test_case : test_cases)
+	{
+		for (int radius : {0, 1, 2, 5, 9})
+		{
+			for (ColorFormat source_format : {ColorFormat::A8, ColorFormat::RGBA8})
+			{
+				for (ColorFormat destination_format : {ColorFormat::A8, ColorFormat::RGBA8})
+				{
+					const Vector2i kernel_radius(radius, test_case.type == KernelType::BlurHorizontal ? 0 : radius);
+					const Vector2i destination_dimensions = source_dimensions + kernel_radius * 2;
+					const int bytes_per_pixel = (destination_format == ColorFormat::RGBA8 ? 4 : 1);
+					const int destination_stride = destination_dimensions.x * bytes_per_pixel + 8;
+					const byte* source = (source_format == ColorFormat::RGBA8 ? source_rgba8.data() : source_a8.data());
+
+					ConvolutionFilter filter;
+					Vector<float> kernel;
+					REQUIRE(filter.Initialise(kernel_radius, test_case.operation));
+					FillKernel(filter, kernel, test_case.type, kernel_radius);
+
+					Vector<byte> result(destination_stride * destination_dimensions.y, byte(0x7f));
+					Vector<byte> expected = result;
+
+					filter.Run(result.data(), destination_dimensions, destination_stride, destination_format, source, source_dimensions,
+						kernel_radius, source_format);
+					RunReferenceFilter(kernel.data(), kernel_radius, test_case.operation, expected.data(), destination_dimensions,
+						destination_stride, destination_format, source, source_dimensions, kernel_radius, source_format);
+
+					int max_difference = 0;
+					for (size_t i = 0; i < result.size(); i++)
+						max_difference = Math::Max(max_difference, Math::AbsoluteValue(int(result[i]) - int(expected[i])));
+
+					INFO("Kernel type: ", int(test_case.type), ", operation: ", int(test_case.operation), ", radius: ", radius,
+						", source format: ", int(source_format), ", destination format: ", int(destination_format));
+					CHECK(max_difference <= test_case.tolerance);
+				}
+			}
+		}
+	}
+}
@@ -26,11 +26,13 @@
  *
  */
 
+#include "../Common/TestsInterface.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Texture.h>
 #include <doctest.h>
 #include <algorithm>
 
@@ -122,3 +124,124 @@ TEST_CASE("core.texture_source_list")
 
 	TestsShell::ShutdownShell();
 }
+
+static inline StringList GetTextureMemoryFileSources(const TextureMemoryStatistics& statistics)
+{
+	StringList list;
+	for (const TextureMemoryStatistics::Entry& texture : statistics.textures)
+	{
+		if (texture.source.find("assets/") != String::npos)
+			list.push_back(texture.source);
+	}
+	std::sort(list.begin(), list.end());
+	return list;
+}
+
+TEST_CASE("core.texture_memory_budget")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textures_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// The tests render interface loads all textures with the same dimensions.
+	const size_t file_texture_size = 4 * 512 * 256;
+	TextureMemoryStatistics statistics = Rml::GetTextureMemoryStatistics();
+	REQUIRE(GetTextureMemoryFileSources(statistics).size() == 4);
+	CHECK(statistics.budget == 0);
+	for (const TextureMemoryStatistics::Entry& texture : statistics.textures)
+		CHECK(texture.size > 0);
+
+	// Make room for only two of the file textures.
+	const size_t budget = statistics.total_size - 2 * file_texture_size;
+	Rml::SetTextureMemoryBudget(budget, 1);
+	render_interface->ResetCounters();
+
+	// Textures rendered during the current frame are never released.
+	context->Update();
+	context->Render();
+	CHECK(render_interface->GetCounters().release_texture == 0);
+	CHECK(GetTextureMemoryFileSources(Rml::GetTextureMemoryStatistics()).size() == 4);
+
+	// Stop rendering the textures, then the least recently used ones are released until the budget is met.
+	document->GetFirstChild()->SetProperty("display", "none");
+	context->Update();
+	context->Render();
+	CHECK(render_interface->GetCounters().release_texture == 2);
+
+	statistics = Rml::GetTextureMemoryStatistics();
+	CHECK(GetTextureMemoryFileSources(statistics).size() == 2);
+	CHECK(statistics.total_size == budget);
+	CHECK(statistics.budget == budget);
+
+	// The released textures are loaded again when they are needed.
+	document->GetFirstChild()->SetProperty("display", "block");
+	context->Update();
+	context->Render();
+	CHECK(render_interface->GetCounters().load_texture == 2);
+	CHECK(render_interface->GetCounters().release_texture == 2);
+
+	statistics = Rml::GetTextureMemoryStatistics();
+	CHECK(GetTextureMemoryFileSources(statistics).size() == 4);
+	for (const TextureMemoryStatistics::Entry& texture : statistics.textures)
+		CHECK(texture.last_used_frame == statistics.frame - 1);
+
+	Rml::SetTextureMemoryBudget(0);
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("core.frame_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_textures_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Showing the document already formats it, make a change so that the layout is also done during the update.
+	document->GetFirstChild()->SetProperty("width", "200px");
+
+	// The statistics of a frame are finished at the start of the next update.
+	context->Update();
+	context->Render();
+	context->Update();
+
+	FrameStatistics statistics = context->GetFrameStatistics();
+	CHECK(statistics.num_elements_updated > 0);
+	CHECK(statistics.num_definitions_updated > 0);
+	CHECK(statistics.num_elements_formatted > 0);
+	CHECK(statistics.num_geometry_generated > 0);
+	CHECK(statistics.num_draw_calls > 0);
+	CHECK(statistics.num_textures_generated > 0);
+	CHECK(statistics.style_time > 0);
+	CHECK(statistics.layout_time > 0);
+	CHECK(statistics.render_time > 0);
+	CHECK(statistics.data_model_time >= 0);
+
+	// Nothing changed since the last frame, so only rendering should have done any work.
+	context->Render();
+	context->Update();
+
+	statistics = context->GetFrameStatistics();
+	CHECK(statistics.num_elements_updated == 0);
+	CHECK(statistics.num_definitions_updated == 0);
+	CHECK(statistics.num_elements_formatted == 0);
+	CHECK(statistics.num_geometry_generated == 0);
+	CHECK(statistics.num_textures_generated == 0);
+	CHECK(statistics.num_draw_calls > 0);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
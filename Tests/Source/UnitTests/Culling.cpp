@@ -0,0 +1,233 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <algorithm>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_culling_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 15px;
+			color: #fff;
+		}
+		body.no_culling {
+			transform: translateX(0px);
+		}
+		#scroll {
+			height: 100px;
+			overflow: auto;
+		}
+		#scroll div {
+			background-color: #333;
+			border: 2px #aaa;
+			padding: 3px;
+		}
+		#below {
+			margin-top: 2000px;
+			background-color: #4a4;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroll"/>
+<div id="below">Below the window</div>
+</body>
+</rml>
+)";
+
+static bool operator==(const TestsRenderInterface::Triangle& a, const TestsRenderInterface::Triangle& b)
+{
+	if (a.texture != b.texture)
+		return false;
+	for (int i = 0; i < 3; i++)
+	{
+		const Vertex& va = a.vertices[i];
+		const Vertex& vb = b.vertices[i];
+		if (va.position != vb.position || va.colour != vb.colour || va.tex_coord != vb.tex_coord)
+			return false;
+	}
+	return true;
+}
+
+static bool Intersects(const TestsRenderInterface::Triangle& triangle, Vector2f region_min, Vector2f region_max)
+{
+	Vector2f min = triangle.vertices[0].position, max = min;
+	for (const Vertex& vertex : triangle.vertices)
+	{
+		min = Math::Min(min, vertex.position);
+		max = Math::Max(max, vertex.position);
+	}
+	return min.x < region_max.x && max.x > region_min.x && min.y < region_max.y && max.y > region_min.y;
+}
+
+static Vector<TestsRenderInterface::Triangle> RenderAndRecord(ElementDocument* document, bool culling, TestsRenderInterface::Counters& out_counters)
+{
+	Context* context = document->GetContext();
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+
+	document->SetClass("no_culling", !culling);
+	context->Update();
+
+	render_interface->EnableGeometryRecording(true);
+	render_interface->ResetRecordedTriangles();
+	render_interface->ResetCounters();
+
+	context->Render();
+
+	out_counters = render_interface->GetCounters();
+	Vector<TestsRenderInterface::Triangle> triangles = render_interface->GetRecordedTriangles();
+
+	render_interface->EnableGeometryRecording(false);
+	render_interface->ResetRecordedTriangles();
+	return triangles;
+}
+
+// Checks that culling only skipped geometry, and that no geometry visible within the padding area of the given element was skipped.
+static void CheckCulledTriangles(const Vector<TestsRenderInterface::Triangle>& triangles_culled, const Vector<TestsRenderInterface::Triangle>& triangles_all,
+	Element* region_element)
+{
+	// Culling may only skip geometry, all submitted geometry must also be submitted without culling.
+	size_t i_all = 0;
+	for (const TestsRenderInterface::Triangle& triangle : triangles_culled)
+	{
+		while (i_all < triangles_all.size() && !(triangles_all[i_all] == triangle))
+			i_all += 1;
+		REQUIRE(i_all < triangles_all.size());
+		i_all += 1;
+	}
+
+	// All geometry visible inside the region must still be submitted.
+	const Vector2f region_min = region_element->GetAbsoluteOffset(BoxArea::Padding);
+	const Vector2f region_max = region_min + region_element->GetBox().GetSize(BoxArea::Padding);
+	size_t num_visible = 0;
+	for (const TestsRenderInterface::Triangle& triangle : triangles_all)
+	{
+		if (!Intersects(triangle, region_min, region_max))
+			continue;
+		num_visible += 1;
+		CHECK(std::find(triangles_culled.begin(), triangles_culled.end(), triangle) != triangles_culled.end());
+	}
+	CHECK(num_visible > 0);
+}
+
+TEST_CASE("render.culling")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	if (!TestsShell::GetTestsRenderInterface())
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_culling_rml);
+	REQUIRE(document);
+
+	Element* scroll = document->GetElementById("scroll");
+	String rows_rml;
+	for (int i = 0; i < 200; i++)
+		rows_rml += CreateString(64, "<div>Row %d</div>", i);
+	scroll->SetInnerRML(rows_rml);
+
+	document->Show();
+	context->Update();
+
+	for (float scroll_top : {0.f, 1234.f})
+	{
+		CAPTURE(scroll_top);
+		scroll->SetScrollTop(scroll_top);
+		context->Update();
+
+		TestsRenderInterface::Counters counters_culled = {}, counters_all = {};
+		const Vector<TestsRenderInterface::Triangle> triangles_culled = RenderAndRecord(document, true, counters_culled);
+		const Vector<TestsRenderInterface::Triangle> triangles_all = RenderAndRecord(document, false, counters_all);
+
+		REQUIRE(!triangles_culled.empty());
+		CHECK(counters_culled.render_calls < counters_all.render_calls / 4);
+
+		CheckCulledTriangles(triangles_culled, triangles_all, scroll);
+	}
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("render.culling.text")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	if (!TestsShell::GetTestsRenderInterface())
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_culling_rml);
+	REQUIRE(document);
+
+	// A single text element spanning many lines, where its first line is scrolled out of view.
+	Element* scroll = document->GetElementById("scroll");
+	scroll->SetProperty("width", "200px");
+	scroll->SetProperty("height", "60px");
+	String paragraph_rml = "<p>";
+	for (int i = 0; i < 40; i++)
+		paragraph_rml += "Lorem ipsum dolor sit amet. ";
+	paragraph_rml += "</p>";
+	scroll->SetInnerRML(paragraph_rml);
+
+	document->Show();
+	context->Update();
+
+	for (float scroll_top : {0.f, 120.f})
+	{
+		CAPTURE(scroll_top);
+		scroll->SetScrollTop(scroll_top);
+		context->Update();
+
+		TestsRenderInterface::Counters counters_culled = {}, counters_all = {};
+		const Vector<TestsRenderInterface::Triangle> triangles_culled = RenderAndRecord(document, true, counters_culled);
+		const Vector<TestsRenderInterface::Triangle> triangles_all = RenderAndRecord(document, false, counters_all);
+
+		REQUIRE(!triangles_culled.empty());
+		CheckCulledTriangles(triangles_culled, triangles_all, scroll);
+	}
+
+	document->Close();
+	context->Update();
+}
@@ -449,4 +449,220 @@ TEST_CASE("databinding.inside_string")
 	document->Close();
 
 	TestsShell::ShutdownShell();
-}
\ No newline at end of file
+}
+
+static const String for_fragment_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="for_fragment">
+<div id="rows"><p data-for="value, i : values" class="row"><span data-attr-title="'v' + value">{{ i }}: {{ value }}</span> <em>{{ value < 2 ? 'low' : 'high' }}</em><b data-for="inner : values">{{ value * inner }}</b></p></div>
+<div id="text"><span data-for="values">{{ it }}</span></div>
+<div id="select"><div data-for="values"><select><option value="a">{{ it }}</option></select></div></div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("databinding.for_fragment")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<int> values = {1, 2, 3};
+	{
+		DataModelConstructor constructor = context->CreateDataModel("for_fragment");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<int>>();
+		constructor.Bind("values", &values);
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_fragment_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	TestsShell::RenderLoop();
+
+	// The generated rows should be identical to those instanced directly from the inner RML of the 'data-for' element.
+	CHECK(document->GetElementById("rows")->GetInnerRML() ==
+		R"(<p class="row"><span data-attr-title="'v' + value" title="v1">0: 1</span><em>low</em><b>1</b><b>2</b><b>3</b><b data-for="inner : values" /></p>)"
+		R"(<p class="row"><span data-attr-title="'v' + value" title="v2">1: 2</span><em>high</em><b>2</b><b>4</b><b>6</b><b data-for="inner : values" /></p>)"
+		R"(<p class="row"><span data-attr-title="'v' + value" title="v3">2: 3</span><em>high</em><b>3</b><b>6</b><b>9</b><b data-for="inner : values" /></p>)"
+		R"(<p class="row" data-for="value, i : values" />)");
+	CHECK(document->GetElementById("text")->GetInnerRML() == R"(<span>1</span><span>2</span><span>3</span><span data-for="values" />)");
+
+	// Contents using custom node handlers are instanced from the RML string.
+	CHECK(document->GetElementById("select")->GetInnerRML() ==
+		R"(<div><select value="a" /></div><div><select value="a" /></div><div><select value="a" /></div><div data-for="values" />)");
+
+	values = {5};
+	context->GetDataModel("for_fragment").GetModelHandle().DirtyVariable("values");
+	context->Update();
+
+	CHECK(document->GetElementById("text")->GetInnerRML() == R"(<span>5</span><span data-for="values" />)");
+
+	document->Close();
+	context->RemoveDataModel("for_fragment");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String for_keyed_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="for_keyed">
+<div id="rows"><p data-for="item, i : items" data-key="item.id">{{ i }}:{{ item.health }}</p></div>
+</div>
+</body>
+</rml>
+)";
+
+struct KeyedItem {
+	int id;
+	int health;
+};
+
+TEST_CASE("databinding.for_keyed")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Vector<KeyedItem> items = {{1, 10}, {2, 20}, {3, 30}};
+	DataModelHandle handle;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("for_keyed");
+		REQUIRE(bool(constructor));
+		if (auto item_handle = constructor.RegisterStruct<KeyedItem>())
+		{
+			item_handle.RegisterMember("id", &KeyedItem::id);
+			item_handle.RegisterMember("health", &KeyedItem::health);
+		}
+		constructor.RegisterArray<Vector<KeyedItem>>();
+		constructor.Bind("items", &items);
+		handle = constructor.GetModelHandle();
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(for_keyed_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* rows = document->GetElementById("rows");
+	CHECK(rows->GetInnerRML() == R"(<p>0:10</p><p>1:20</p><p>2:30</p><p data-for="item, i : items" data-key="item.id" />)");
+
+	// Only the views of the dirtied entry should be updated.
+	items[0].health = 11;
+	items[1].health = 21;
+	handle.DirtyAddress("items[1].health");
+	context->Update();
+	CHECK(rows->GetInnerRML() == R"(<p>0:10</p><p>1:21</p><p>2:30</p><p data-for="item, i : items" data-key="item.id" />)");
+
+	// Inserted and removed entries should not affect the elements of the remaining entries.
+	Element* element_1 = rows->GetChild(0);
+	Element* element_3 = rows->GetChild(2);
+
+	items = {{4, 40}, {1, 11}, {3, 30}};
+	handle.DirtyVariable("items");
+	context->Update();
+
+	CHECK(rows->GetInnerRML() == R"(<p>0:40</p><p>1:11</p><p>2:30</p><p data-for="item, i : items" data-key="item.id" />)");
+	CHECK(rows->GetChild(1) == element_1);
+	CHECK(rows->GetChild(2) == element_3);
+
+	// Rebound elements should follow their new index.
+	items[2].health = 31;
+	handle.DirtyAddress("items[2]");
+	context->Update();
+	CHECK(rows->GetInnerRML() == R"(<p>0:40</p><p>1:11</p><p>2:31</p><p data-for="item, i : items" data-key="item.id" />)");
+
+	document->Close();
+	context->RemoveDataModel("for_keyed");
+
+	TestsShell::ShutdownShell();
+}
+
+static const String write_dirty_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+<div data-model="write_dirty">
+<input id="input" type="text" data-value="stats.value"/>
+<button id="button" data-event-click="stats.value = 10">Set</button>
+<p id="doubled">{{ stats.doubled }}</p>
+</div>
+</body>
+</rml>
+)";
+
+struct Stats {
+	int value = 1;
+	int GetDoubled() { return 2 * value; }
+};
+
+TEST_CASE("databinding.write_dirties_variable")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	Stats stats;
+	{
+		DataModelConstructor constructor = context->CreateDataModel("write_dirty");
+		REQUIRE(bool(constructor));
+		if (auto stats_handle = constructor.RegisterStruct<Stats>())
+		{
+			stats_handle.RegisterMember("value", &Stats::value);
+			stats_handle.RegisterMember("doubled", &Stats::GetDoubled);
+		}
+		constructor.Bind("stats", &stats);
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(write_dirty_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* doubled = document->GetElementById("doubled");
+	CHECK(doubled->GetInnerRML() == "2");
+
+	// Writes from controllers and assignments dirty the whole variable, so that members derived from the written member are updated too.
+	document->GetElementById("input")->DispatchEvent(EventId::Change, {{"value", Variant("5")}});
+	context->Update();
+	CHECK(stats.value == 5);
+	CHECK(doubled->GetInnerRML() == "10");
+
+	document->GetElementById("button")->DispatchEvent(EventId::Click, Dictionary());
+	context->Update();
+	CHECK(stats.value == 10);
+	CHECK(doubled->GetInnerRML() == "20");
+
+	document->Close();
+	context->RemoveDataModel("write_dirty");
+
+	TestsShell::ShutdownShell();
+}
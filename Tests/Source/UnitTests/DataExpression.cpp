@@ -33,6 +33,7 @@
 #include <RmlUi/Core/Types.h>
 
 #include <doctest.h>
+#include <algorithm>
 
 using namespace Rml;
 
@@ -150,3 +151,49 @@ TEST_CASE("Data expressions")
 }
 
 
+
+TEST_CASE("Data expressions.compiled")
+{
+	float radius = 8.7f;
+	DataModelConstructor handle(&model, &type_register);
+	handle.Bind("radius_compiled", &radius);
+
+	auto ParseProgram = [](const String& expression) {
+		DataParser parser(expression, interface);
+		REQUIRE(parser.Parse(false));
+		return parser.ReleaseProgram();
+	};
+	auto CountInstructions = [](const Program& program, Instruction instruction) {
+		return std::count_if(program.begin(), program.end(), [&](const InstructionData& data) { return data.instruction == instruction; });
+	};
+
+	// Constant sub-expressions are folded into a single literal.
+	for (const char* expression : {"5*(1+2)", "'fox' + 'dog' ? 'FoxyDog' : 'hot' + 'dog'", "!!('tr' + 'ue')", "5 == 1 + 2*2 || 8 == 1 + 4"})
+	{
+		const Program program = ParseProgram(expression);
+		CHECK(program.size() == 1);
+		CHECK(program[0].instruction == Instruction::Literal);
+	}
+
+	Program program = ParseProgram("radius_compiled * (2 + 3) - 1");
+	CHECK(CountInstructions(program, Instruction::Literal) == 2);
+	CHECK(CountInstructions(program, Instruction::Variable) == 1);
+
+	// Simple operands are moved directly to the left-hand side register instead of through the stack.
+	CHECK(CountInstructions(program, Instruction::Push) == 0);
+	CHECK(CountInstructions(program, Instruction::Pop) == 0);
+	CHECK(TestExpression("radius_compiled * (2 + 3) - 1") == "42.5");
+
+	// Transform functions are resolved during parsing, while those not yet registered are looked up by name during execution.
+	program = ParseProgram("radius_compiled | round | compiled_double");
+	REQUIRE(CountInstructions(program, Instruction::TransformFnc) == 2);
+	CHECK(program[program.size() - 2].transform_func != nullptr);
+	CHECK(program.back().transform_func == nullptr);
+
+	handle.RegisterTransformFunc("compiled_double", [](Variant& variant, const VariantList& /*arguments*/) -> bool {
+		variant = 2.0 * variant.Get<double>();
+		return true;
+	});
+	CHECK(TestExpression("radius_compiled | round | compiled_double") == "18");
+	CHECK(ParseProgram("radius_compiled | compiled_double").back().transform_func != nullptr);
+}
@@ -0,0 +1,280 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/DataSource.h>
+#include <RmlUi/Core/Elements/ElementDataGrid.h>
+#include <RmlUi/Core/Elements/ElementDataGridRow.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+namespace {
+
+class ServerDataSource : public DataSource {
+public:
+	ServerDataSource(int num_rows) : DataSource("servers")
+	{
+		for (int i = 0; i < num_rows; i++)
+			server_ids.push_back(i);
+	}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		num_get_row_calls += 1;
+		for (const String& column : columns)
+		{
+			if (column == "name")
+				row.push_back(CreateString(32, "Server %d", server_ids[row_index]));
+			else if (column == "ping")
+				row.push_back(CreateString(32, "%d", server_ids[row_index] % 100));
+			else
+				row.push_back(String());
+		}
+	}
+
+	int GetNumRows(const String& /*table*/) override { return (int)server_ids.size(); }
+
+	void AddRows(int first_row, int num_rows_added)
+	{
+		server_ids.insert(server_ids.begin() + first_row, num_rows_added, -1);
+		NotifyRowAdd("list", first_row, num_rows_added);
+	}
+	void RemoveRows(int first_row, int num_rows_removed)
+	{
+		server_ids.erase(server_ids.begin() + first_row, server_ids.begin() + first_row + num_rows_removed);
+		NotifyRowRemove("list", first_row, num_rows_removed);
+	}
+	void ChangeRows(int first_row, int num_rows_changed)
+	{
+		for (int i = first_row; i < first_row + num_rows_changed; i++)
+			server_ids[i] += 1000000;
+		NotifyRowChange("list", first_row, num_rows_changed);
+	}
+	// Removes rows from the end without notifying the grid, so that it expects more rows than the data source has.
+	void LoseRows(int num_rows_lost) { server_ids.resize(server_ids.size() - num_rows_lost); }
+
+	Vector<int> server_ids;
+	int num_get_row_calls = 0;
+};
+
+} // namespace
+
+static const String document_datagrid_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 16px;
+		}
+		datagrid {
+			width: 400px;
+			height: 200px;
+		}
+		datagridrow {
+			height: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<datagrid id="grid" source="servers.list" virtualized>
+	<col fields="name" width="70%">Name</col>
+	<col fields="ping" width="30%">Ping</col>
+</datagrid>
+</body>
+</rml>
+)";
+
+static String GetRowText(ElementDataGridRow* row)
+{
+	String result;
+	for (int i = 0; i < row->GetNumChildren(); i++)
+	{
+		if (i > 0)
+			result += ";";
+		result += row->GetChild(i)->GetInnerRML();
+	}
+	return result;
+}
+
+TEST_CASE("datagrid.virtualized")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	constexpr int num_rows = 10000;
+	ServerDataSource data_source(num_rows);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_datagrid_rml);
+	REQUIRE(document);
+	document->Show();
+
+	ElementDataGrid* grid = rmlui_dynamic_cast<ElementDataGrid*>(document->GetElementById("grid"));
+	REQUIRE(grid);
+	CHECK(grid->IsVirtualized());
+
+	auto NumInstancedRows = [&]() {
+		int result = 0;
+		for (int i = 0; i < num_rows; i++)
+		{
+			if (grid->GetRow(i))
+				result += 1;
+		}
+		return result;
+	};
+
+	// The first updates measure the row height and fill the visible window.
+	for (int i = 0; i < 3; i++)
+	{
+		context->Update();
+		context->Render();
+	}
+
+	CHECK(grid->GetNumRows() == num_rows);
+	CHECK(grid->GetScrollHeight() >= num_rows * 20.f);
+
+	// Only the visible rows, plus a few rows of overscan, are instanced and fetched from the data source.
+	const int num_visible_rows = NumInstancedRows();
+	CHECK(num_visible_rows >= 10);
+	CHECK(num_visible_rows <= 20);
+	CHECK(data_source.num_get_row_calls == num_visible_rows);
+
+	REQUIRE(grid->GetRow(0));
+	CHECK(GetRowText(grid->GetRow(0)) == "Server 0;0");
+	CHECK(grid->GetRow(0)->GetTableRelativeIndex() == 0);
+	CHECK(grid->GetRow(5)->GetAbsoluteTop() - grid->GetRow(0)->GetAbsoluteTop() == doctest::Approx(5 * 20.f));
+	CHECK(grid->GetRow(5000) == nullptr);
+
+	// Scrolling recycles the row elements for the rows scrolled into view.
+	grid->SetScrollTop(5000 * 20.f);
+	context->Update();
+	context->Render();
+
+	CHECK(grid->GetRow(0) == nullptr);
+	ElementDataGridRow* row = grid->GetRow(5000);
+	REQUIRE(row);
+	CHECK(GetRowText(row) == "Server 5000;0");
+	CHECK(row->GetTableRelativeIndex() == 5000);
+	// The window now has overscan rows above it as well.
+	const int num_window_rows = NumInstancedRows();
+	CHECK(num_window_rows <= num_visible_rows + 5);
+	CHECK(data_source.num_get_row_calls == num_visible_rows + num_window_rows);
+
+	// Added and removed rows move the instanced rows without fetching them again.
+	const int num_get_row_calls = data_source.num_get_row_calls;
+	data_source.AddRows(0, 10);
+	CHECK(grid->GetNumRows() == num_rows + 10);
+	CHECK(grid->GetRow(5010) == row);
+
+	data_source.RemoveRows(0, 10);
+	CHECK(grid->GetRow(5000) == row);
+	context->Update();
+	CHECK(data_source.num_get_row_calls == num_get_row_calls);
+
+	ElementDataGridRow* next_row = grid->GetRow(5001);
+	data_source.RemoveRows(5000, 1);
+	CHECK(grid->GetRow(5000) == next_row);
+	CHECK(GetRowText(next_row) == "Server 5001;1");
+
+	// Changed rows are fetched again.
+	data_source.ChangeRows(5000, 1);
+	context->Update();
+	CHECK(GetRowText(grid->GetRow(5000)) == "Server 1005001;1");
+	CHECK(GetRowText(grid->GetRow(5001)) == "Server 5002;2");
+	CHECK(data_source.num_get_row_calls == num_get_row_calls + 2);
+
+	// Switching back to regular rows instances all of them.
+	grid->SetVirtualized(false);
+	context->Update();
+	CHECK(grid->GetNumRows() == num_rows - 1);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("datagrid.virtualized.missing_rows")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ServerDataSource data_source(100);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_datagrid_rml);
+	REQUIRE(document);
+	document->Show();
+
+	ElementDataGrid* grid = rmlui_dynamic_cast<ElementDataGrid*>(document->GetElementById("grid"));
+	REQUIRE(grid);
+
+	for (int i = 0; i < 3; i++)
+	{
+		context->Update();
+		context->Render();
+	}
+	REQUIRE(grid->GetRow(0));
+	CHECK(GetRowText(grid->GetRow(0)) == "Server 0;0");
+
+	data_source.LoseRows(50);
+
+	// The rows recycled for rows missing in the data source must not keep showing the rows they displayed before.
+	TestsShell::SetNumExpectedWarnings(1);
+	grid->SetScrollTop(80 * 20.f);
+	context->Update();
+	context->Render();
+	TestsShell::SetNumExpectedWarnings(0);
+
+	REQUIRE(grid->GetRow(80));
+	CHECK(GetRowText(grid->GetRow(80)) == ";");
+	CHECK(GetRowText(grid->GetRow(85)) == ";");
+
+	// When only part of the window is missing, the available rows are still loaded.
+	TestsShell::SetNumExpectedWarnings(1);
+	grid->SetScrollTop(45 * 20.f);
+	context->Update();
+	context->Render();
+	TestsShell::SetNumExpectedWarnings(0);
+
+	REQUIRE(grid->GetRow(46));
+	CHECK(GetRowText(grid->GetRow(46)) == "Server 46;46");
+	REQUIRE(grid->GetRow(54));
+	CHECK(GetRowText(grid->GetRow(54)) == ";");
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
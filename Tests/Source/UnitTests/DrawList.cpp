@@ -0,0 +1,219 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_draw_list_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+			font-family: LatoLatin;
+			font-size: 15px;
+			color: #fff;
+		}
+		div {
+			background-color: #333;
+			border: 2px #aaa;
+			padding: 5px;
+			margin: 3px;
+		}
+		#scroll {
+			height: 50px;
+			overflow: auto;
+		}
+		#transform {
+			transform: rotate(10deg);
+		}
+		img {
+			width: 32px;
+			height: 32px;
+		}
+	</style>
+</head>
+
+<body>
+<div>Hello <img src="/assets/high_scores_alien_1.tga"/> world</div>
+<div id="scroll">
+	<div>Scrolled A</div>
+	<div>Scrolled B</div>
+	<div>Scrolled C</div>
+</div>
+<div id="transform">Transformed <img src="/assets/high_scores_alien_1.tga"/></div>
+<div style="border-radius: 8px; background-color: #4a4;">After</div>
+</body>
+</rml>
+)";
+
+static bool operator==(const TestsRenderInterface::Triangle& a, const TestsRenderInterface::Triangle& b)
+{
+	if (a.texture != b.texture)
+		return false;
+	for (int i = 0; i < 3; i++)
+	{
+		const Vertex& va = a.vertices[i];
+		const Vertex& vb = b.vertices[i];
+		if (va.position != vb.position || va.colour != vb.colour || va.tex_coord != vb.tex_coord)
+			return false;
+	}
+	return true;
+}
+
+TEST_CASE("draw_list.identical_geometry")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_draw_list_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto RenderAndRecord = [&](bool enable_draw_lists, TestsRenderInterface::Counters& out_counters) {
+		render_interface->EnableDrawLists(enable_draw_lists);
+		render_interface->EnableGeometryRecording(true);
+		render_interface->ResetRecordedTriangles();
+		render_interface->ResetCounters();
+
+		context->Render();
+
+		out_counters = render_interface->GetCounters();
+		Vector<TestsRenderInterface::Triangle> triangles = render_interface->GetRecordedTriangles();
+
+		render_interface->EnableDrawLists(false);
+		render_interface->EnableGeometryRecording(false);
+		render_interface->ResetRecordedTriangles();
+		return triangles;
+	};
+
+	TestsRenderInterface::Counters counters_direct = {}, counters_draw_list = {};
+	const Vector<TestsRenderInterface::Triangle> triangles_direct = RenderAndRecord(false, counters_direct);
+	const Vector<TestsRenderInterface::Triangle> triangles_draw_list = RenderAndRecord(true, counters_draw_list);
+
+	// The same triangles should be submitted in the same order, only batched into fewer calls.
+	REQUIRE(!triangles_direct.empty());
+	REQUIRE(triangles_direct.size() == triangles_draw_list.size());
+	for (size_t i = 0; i < triangles_direct.size(); i++)
+	{
+		CAPTURE(i);
+		CHECK(triangles_direct[i] == triangles_draw_list[i]);
+	}
+
+	CHECK(counters_draw_list.render_calls == 0);
+	CHECK(counters_direct.render_draw_list == 0);
+	CHECK(counters_draw_list.render_draw_list > 0);
+	CHECK(counters_draw_list.render_draw_list < counters_direct.render_calls);
+
+	// State changes are submitted identically, with draw lists split around them.
+	CHECK(counters_draw_list.set_scissor == counters_direct.set_scissor);
+	CHECK(counters_draw_list.enable_scissor == counters_direct.enable_scissor);
+	CHECK(counters_draw_list.set_transform == counters_direct.set_transform);
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("draw_list.opacity")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_draw_list_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto RenderAndRecord = [&](bool enable_draw_lists) {
+		render_interface->EnableDrawLists(enable_draw_lists);
+		render_interface->EnableGeometryRecording(true);
+		render_interface->ResetRecordedTriangles();
+
+		context->Render();
+
+		Vector<TestsRenderInterface::Triangle> triangles = render_interface->GetRecordedTriangles();
+
+		render_interface->EnableDrawLists(false);
+		render_interface->EnableGeometryRecording(false);
+		render_interface->ResetRecordedTriangles();
+		return triangles;
+	};
+
+	const Vector<TestsRenderInterface::Triangle> triangles_opaque = RenderAndRecord(false);
+	REQUIRE(!triangles_opaque.empty());
+
+	// Changing the opacity should only affect the submitted colours, and not regenerate any geometry.
+	document->SetProperty(PropertyId::Opacity, Property(0.5f, Unit::NUMBER));
+	context->Update();
+
+	for (bool enable_draw_lists : {false, true})
+	{
+		CAPTURE(enable_draw_lists);
+		const Vector<TestsRenderInterface::Triangle> triangles = RenderAndRecord(enable_draw_lists);
+
+		REQUIRE(triangles.size() == triangles_opaque.size());
+		for (size_t i = 0; i < triangles.size(); i++)
+		{
+			CAPTURE(i);
+			TestsRenderInterface::Triangle expected = triangles_opaque[i];
+			for (Vertex& vertex : expected.vertices)
+				vertex.colour.alpha = byte(0.5f * float(vertex.colour.alpha));
+			CHECK(triangles[i] == expected);
+		}
+	}
+
+	context->Update();
+	CHECK(context->GetFrameStatistics().num_geometry_generated == 0);
+
+	// Fully transparent geometry is not submitted at all.
+	document->SetProperty(PropertyId::Opacity, Property(0.f, Unit::NUMBER));
+	context->Update();
+	CHECK(RenderAndRecord(true).empty());
+
+	document->Close();
+	context->Update();
+}
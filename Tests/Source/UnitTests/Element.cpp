@@ -28,6 +28,7 @@
 
 #include "../Common/Mocks.h"
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -214,3 +215,378 @@ TEST_CASE("Element")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_element_at_point_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			left: 0;
+			top: 0;
+			right: 0;
+			bottom: 0;
+		}
+		div {
+			position: absolute;
+			top: 0;
+			width: 100px;
+			height: 100px;
+		}
+		#above { top: 50px; left: 50px; z-index: 1; }
+		#rotated { left: 300px; transform: rotate(45deg); }
+		#no_pointer { left: 500px; pointer-events: none; }
+		#clip { left: 700px; overflow: hidden; }
+		#overflow { position: static; width: 300px; height: 50px; }
+		#scroll { left: 1200px; overflow: auto; }
+		#scroll div { position: static; width: 80px; height: 100px; }
+		scrollbarvertical, scrollbarvertical sliderbar { width: 10px; }
+		#scroll_overlay { left: 1200px; top: 80px; height: 20px; z-index: 1; }
+	</style>
+</head>
+
+<body>
+<div id="below"/>
+<div id="above"/>
+<div id="rotated"/>
+<div id="no_pointer"/>
+<div id="clip"><div id="overflow"/></div>
+<div id="scroll"><div id="scroll_first"/><div id="scroll_second"/></div>
+<div id="scroll_overlay"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.GetElementAtPoint")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_element_at_point_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	auto GetIdAtPoint = [&](float x, float y, const Element* ignore_element = nullptr) -> String {
+		Element* element = context->GetElementAtPoint(Vector2f(x, y), ignore_element);
+		return element ? element->GetId() : String("none");
+	};
+
+	Element* body = document;
+	body->SetId("body");
+
+	CHECK(GetIdAtPoint(10, 10) == "below");
+	CHECK(GetIdAtPoint(60, 60) == "above");
+	CHECK(GetIdAtPoint(140, 140) == "above");
+	CHECK(GetIdAtPoint(60, 60, document->GetElementById("above")) == "below");
+	CHECK(GetIdAtPoint(200, 200) == "body");
+
+	// Corners of the untransformed box are outside the rotated box, while the rotated corners extend past it.
+	CHECK(GetIdAtPoint(302, 2) == "body");
+	CHECK(GetIdAtPoint(350, -15) == "rotated");
+	CHECK(GetIdAtPoint(350, 50) == "rotated");
+
+	CHECK(GetIdAtPoint(550, 50) == "body");
+
+	CHECK(GetIdAtPoint(750, 25) == "overflow");
+	CHECK(GetIdAtPoint(750, 75) == "clip");
+	CHECK(GetIdAtPoint(850, 25) == "body");
+
+	SUBCASE("Invalidation")
+	{
+		Element* above = document->GetElementById("above");
+		above->SetProperty("left", "1000px");
+		context->Update();
+
+		CHECK(GetIdAtPoint(140, 140) == "body");
+		CHECK(GetIdAtPoint(1010, 60) == "above");
+
+		// Transforms are resolved during rendering.
+		above->SetProperty("transform", "translateY(200px)");
+		context->Update();
+		context->Render();
+
+		CHECK(GetIdAtPoint(1010, 60) == "body");
+		CHECK(GetIdAtPoint(1010, 260) == "above");
+
+		document->RemoveChild(above);
+		context->Update();
+
+		CHECK(GetIdAtPoint(1010, 260) == "body");
+
+		document->AppendChild(document->CreateElement("div"))->SetId("new");
+		context->Update();
+
+		CHECK(GetIdAtPoint(10, 10) == "new");
+	}
+
+	SUBCASE("Scrolling")
+	{
+		// Enough other elements so that the scrolled elements are updated in place rather than rebuilding the grid.
+		for (int i = 0; i < 50; i++)
+			document->AppendChild(document->CreateElement("div"))->SetProperty("top", "500px");
+		context->Update();
+
+		Element* scroll = document->GetElementById("scroll");
+		CHECK(GetIdAtPoint(1210, 50) == "scroll_first");
+		CHECK(GetIdAtPoint(1210, 90) == "scroll_overlay");
+
+		// Scrolling only updates the moved elements in the grid, they must still be tested in the same order as the other elements.
+		for (float scroll_top : {100.f, 50.f, 0.f, 100.f})
+		{
+			CAPTURE(scroll_top);
+			scroll->SetScrollTop(scroll_top);
+			context->Update();
+
+			CHECK(GetIdAtPoint(1210, 50) == (scroll_top < 50.f ? "scroll_first" : "scroll_second"));
+			CHECK(GetIdAtPoint(1210, 90) == "scroll_overlay");
+			CHECK(GetIdAtPoint(10, 10) == "below");
+		}
+
+		// Elements outside the scrolled subtree can move in the same way.
+		document->GetElementById("scroll_overlay")->SetProperty("top", "0px");
+		context->Update();
+
+		CHECK(GetIdAtPoint(1210, 10) == "scroll_overlay");
+		CHECK(GetIdAtPoint(1210, 90) == "scroll_second");
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_stacking_context_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body { left: 0; top: 0; right: 0; bottom: 0; }
+		div { display: block; height: 10px; }
+		span { display: inline; }
+	</style>
+</head>
+<body>
+<div id="container"/>
+<table>
+	<tr><td/><td/></tr>
+	<tr><td/><td/></tr>
+</table>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.StackingContext")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_stacking_context_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* container = document->GetElementById("container");
+	REQUIRE(container);
+
+	// Spans never receive children and only divs are made inline, so that no block boxes end up inside inline boxes.
+	for (int i = 0; i < 20; i++)
+	{
+		const bool span = (i % 3 == 0);
+		Element* child = container->AppendChild(document->CreateElement(span ? "span" : "div"));
+		if (i % 4 == 0 && !span)
+			child->AppendChild(document->CreateElement("div"))->AppendChild(document->CreateElement("span"));
+	}
+
+	context->Update();
+	context->Render();
+
+	// Compares the stacking context of every element that has one against a full rebuild.
+	int num_checks = 0;
+	int num_up_to_date = 0;
+	auto CheckStackingContexts = [&]() {
+		ElementList elements = {document};
+		document->QuerySelectorAll(elements, "*");
+
+		for (Element* element : elements)
+		{
+			if (element != document && element->GetComputedValues().z_index().type == Style::ZIndex::Auto)
+				continue;
+
+			ElementList current, rebuilt;
+			num_checks += 1;
+			if (element->GetStackingContextForTesting(current, rebuilt))
+				num_up_to_date += 1;
+
+			CHECK(current == rebuilt);
+		}
+	};
+
+	CheckStackingContexts();
+
+	const char* properties[][2] = {
+		{"display", "none"},
+		{"display", "block"},
+		{"display", "inline"},
+		{"display", "inline-block"},
+		{"position", "static"},
+		{"position", "relative"},
+		{"position", "absolute"},
+		{"float", "none"},
+		{"float", "left"},
+		{"z-index", "auto"},
+		{"z-index", "-1"},
+		{"z-index", "0"},
+		{"z-index", "2"},
+		{"visibility", "hidden"},
+		{"visibility", "visible"},
+	};
+	const int num_properties = int(sizeof(properties) / sizeof(properties[0]));
+
+	// Simple deterministic generator, so that any failures are reproducible.
+	unsigned int seed = 1;
+	auto Random = [&seed](int range) {
+		seed = seed * 1103515245u + 12345u;
+		return int((seed >> 16) % unsigned(range));
+	};
+
+	for (int iteration = 0; iteration < 500; iteration++)
+	{
+		const int num_mutations = 1 + Random(2);
+		for (int i = 0; i < num_mutations; i++)
+		{
+			ElementList elements;
+			document->QuerySelectorAll(elements, "#container *, td");
+			REQUIRE(!elements.empty());
+
+			Element* element = elements[Random(int(elements.size()))];
+			Element* parent = element->GetParentNode();
+
+			// Keep the table structure valid, table cells can only have their style changed or children added.
+			const bool table_cell = (element->GetTagName() == "td");
+			const bool span = (element->GetTagName() == "span");
+
+			switch (Random(5))
+			{
+			case 0:
+				if (!table_cell && (parent != container || container->GetNumChildren() > 5))
+					parent->RemoveChild(element);
+				break;
+			case 1:
+				if (!table_cell)
+					parent->InsertBefore(document->CreateElement(Random(2) ? "div" : "span"), element);
+				break;
+			case 2:
+				if (!span)
+					element->AppendChild(document->CreateElement("div"));
+				break;
+			default:
+			{
+				const int property = Random(num_properties);
+				const String name = properties[property][0];
+				const String value = properties[property][1];
+				if (table_cell && name == "display")
+					break;
+				if (!span && name == "display" && value == "inline")
+					break;
+				element->SetProperty(name, value);
+			}
+			break;
+			}
+		}
+
+		context->Update();
+		CheckStackingContexts();
+
+		if (iteration % 10 == 0)
+			context->Render();
+	}
+
+	// Most mutations should have been patched into the existing stacking contexts, rather than requiring a rebuild.
+	CHECK(num_up_to_date > num_checks / 2);
+
+	document->Close();
+	context->Update();
+	TestsShell::ShutdownShell();
+}
+
+class CountingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		num_events += 1;
+		// Dispatch a nested event to exercise re-entrant dispatching.
+		if (nested_event != EventId::Invalid && event.GetId() != nested_event)
+			event.GetTargetElement()->DispatchEvent(nested_event, Dictionary());
+	}
+
+	int num_events = 0;
+	EventId nested_event = EventId::Invalid;
+};
+
+TEST_CASE("Element.EventListenerSummary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_clone_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* container_a = document->AppendChild(document->CreateElement("div"));
+	Element* container_b = document->AppendChild(document->CreateElement("div"));
+
+	CountingEventListener listener;
+
+	// Listeners are summarized per element and cached for its ancestry, make sure the summaries follow listener and
+	// hierarchy changes.
+	ElementPtr detached_ptr = document->CreateElement("div");
+	Element* element = detached_ptr.get();
+	container_a->AddEventListener(EventId::Scroll, &listener);
+
+	element->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.num_events == 0);
+
+	container_a->AppendChild(std::move(detached_ptr));
+	element->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.num_events == 1);
+
+	element->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.num_events == 1);
+
+	container_b->AppendChild(container_a->RemoveChild(element));
+	element->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.num_events == 1);
+
+	container_b->AddEventListener(EventId::Scroll, &listener, true);
+	element->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.num_events == 2);
+
+	container_b->RemoveEventListener(EventId::Scroll, &listener, true);
+	element->DispatchEvent(EventId::Scroll, Dictionary());
+	CHECK(listener.num_events == 2);
+
+	// Custom events beyond the defined ids must also reach their listeners.
+	document->AddEventListener("custom_summary_event", &listener);
+	element->DispatchEvent("custom_summary_event", Dictionary());
+	CHECK(listener.num_events == 3);
+
+	// Nested dispatches from within a listener.
+	listener.nested_event = EventId::Resize;
+	document->AddEventListener(EventId::Mousemove, &listener);
+	document->AddEventListener(EventId::Resize, &listener);
+	element->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.num_events == 4);
+	element->DispatchEvent(EventId::Resize, Dictionary());
+	CHECK(listener.num_events == 4);
+	document->DispatchEvent(EventId::Mousemove, Dictionary());
+	CHECK(listener.num_events == 6);
+
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	document->RemoveEventListener(EventId::Resize, &listener);
+	document->RemoveEventListener("custom_summary_event", &listener);
+	container_a->RemoveEventListener(EventId::Scroll, &listener);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../Common/TestsShell.h"
+#include <RmlUi/Core/ComputedValues.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -34,6 +35,94 @@
 
 using namespace Rml;
 
+static const String document_shared_values_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-size: 10px;
+		}
+		p {
+			padding-left: 2em;
+			line-height: 1.5;
+			color: #0f0;
+		}
+		p.big {
+			font-size: 20px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="list">
+	<p/><p/><p style="color: #f00"/><p class="big"/><p/><p/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.shared_computed_values")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Siblings with the same definition share their computed values, make sure they are still resolved correctly for each element.
+	ElementDocument* document = context->LoadDocumentFromMemory(document_shared_values_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* list = document->GetElementById("list");
+	REQUIRE(list->GetNumChildren() == 6);
+
+	auto CheckValues = [&](const int i, float font_size, Colourb color) {
+		Element* element = list->GetChild(i);
+		const ComputedValues& computed = element->GetComputedValues();
+		CAPTURE(i);
+		CHECK(computed.font_size() == font_size);
+		CHECK(computed.padding_left().value == 2.f * font_size);
+		CHECK(computed.line_height().value == 1.5f * font_size);
+		CHECK(computed.color() == color);
+	};
+
+	const Colourb green(0, 255, 0), red(255, 0, 0);
+
+	CheckValues(0, 10.f, green);
+	CheckValues(1, 10.f, green);
+	CheckValues(2, 10.f, red);
+	CheckValues(3, 20.f, green);
+	CheckValues(4, 10.f, green);
+	CheckValues(5, 10.f, green);
+
+	// Changing the inherited font size should update all the em-relative values.
+	list->SetProperty(PropertyId::FontSize, Property(12.f, Unit::PX));
+	context->Update();
+
+	CheckValues(0, 12.f, green);
+	CheckValues(1, 12.f, green);
+	CheckValues(2, 12.f, red);
+	CheckValues(3, 20.f, green);
+	CheckValues(4, 12.f, green);
+	CheckValues(5, 12.f, green);
+
+	// Changing the definition of some elements should only affect those elements.
+	list->GetChild(1)->SetClass("big", true);
+	list->GetChild(3)->SetClass("big", false);
+	list->GetChild(4)->SetProperty(PropertyId::Color, Property(red, Unit::COLOUR));
+	context->Update();
+
+	CheckValues(0, 12.f, green);
+	CheckValues(1, 20.f, green);
+	CheckValues(2, 12.f, red);
+	CheckValues(3, 12.f, green);
+	CheckValues(4, 12.f, red);
+	CheckValues(5, 12.f, green);
+
+	document->Close();
+}
+
 static const String document_decorator_rml = R"(
 <rml>
 <head>
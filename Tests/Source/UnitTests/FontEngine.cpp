@@ -0,0 +1,197 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FontEngineInterface.h>
+#include <RmlUi/Core/StringWidthCache.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_font_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 20px;
+		}
+		p.shadow {
+			font-effect: shadow(2px 2px black);
+		}
+		p.outline {
+			font-effect: outline(1px black);
+		}
+	</style>
+</head>
+
+<body>
+<p id="text">Hello</p>
+<p class="shadow">Hello</p>
+<p class="outline">Hello</p>
+</body>
+</rml>
+)";
+
+TEST_CASE("font_engine.incremental_glyphs")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_font_rml);
+	REQUIRE(document);
+	document->Show();
+
+	TestsShell::RenderLoop();
+
+	Element* element = document->GetElementById("text");
+	const FontFaceHandle handle = element->GetFontFaceHandle();
+	REQUIRE(handle);
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+	const int version = font_engine_interface->GetVersion(handle);
+
+	SUBCASE("Single glyph")
+	{
+		// Only ASCII glyphs are loaded initially, new glyphs should be uploaded into the existing textures.
+		render_interface->ResetCounters();
+		for (Element* paragraph : {document->GetChild(0), document->GetChild(1), document->GetChild(2)})
+			paragraph->SetInnerRML("H\xC3\xA9llo");
+
+		TestsShell::RenderLoop();
+
+		const TestsRenderInterface::Counters& counters = render_interface->GetCounters();
+		CHECK(counters.update_texture == 2);
+		CHECK(counters.generate_texture == 0);
+		CHECK(counters.release_texture == 0);
+		CHECK(font_engine_interface->GetVersion(handle) == version);
+	}
+
+	SUBCASE("Many glyphs")
+	{
+		// Adding many glyphs eventually enlarges the textures, which should only occasionally require the text to be regenerated.
+		int num_version_changes = 0;
+		int previous_version = version;
+
+		for (char32_t character = 0xC0; character <= 0x17F; character++)
+		{
+			element->SetInnerRML(StringUtilities::ToUTF8(Character(character)));
+			TestsShell::RenderLoop();
+
+			const int new_version = font_engine_interface->GetVersion(handle);
+			if (new_version != previous_version)
+				num_version_changes += 1;
+			previous_version = new_version;
+		}
+
+		MESSAGE("Version changes: ", num_version_changes);
+		CHECK(num_version_changes <= 4);
+	}
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("font_engine.string_width_cache")
+{
+	SUBCASE("Least recently used")
+	{
+		StringWidthCache cache(3, 8);
+		int width = 0;
+
+		cache.Insert("one", Character::Null, 1);
+		cache.Insert("two", Character::Null, 2);
+		cache.Insert("two", Character('a'), 3);
+		CHECK(cache.GetNumEntries() == 3);
+
+		CHECK(cache.Find("two", Character::Null, width));
+		CHECK(width == 2);
+		CHECK(cache.Find("two", Character('a'), width));
+		CHECK(width == 3);
+		CHECK(!cache.Find("two", Character('b'), width));
+
+		// Marks 'one' as recently used, so that the first 'two' is evicted.
+		CHECK(cache.Find("one", Character::Null, width));
+		cache.Insert("three", Character::Null, 4);
+		CHECK(cache.GetNumEntries() == 3);
+		CHECK(!cache.Find("two", Character::Null, width));
+		CHECK(cache.Find("one", Character::Null, width));
+		CHECK(cache.Find("three", Character::Null, width));
+		CHECK(width == 4);
+
+		// Strings longer than the maximum length are never stored.
+		cache.Insert("too long string", Character::Null, 5);
+		CHECK(!cache.Find("too long string", Character::Null, width));
+		CHECK(cache.Find("two", Character('a'), width));
+
+		cache.Clear();
+		CHECK(cache.GetNumEntries() == 0);
+		CHECK(!cache.Find("one", Character::Null, width));
+	}
+
+	SUBCASE("Default font engine")
+	{
+		Context* context = TestsShell::GetContext();
+		REQUIRE(context);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_font_rml);
+		REQUIRE(document);
+		const FontFaceHandle handle = document->GetElementById("text")->GetFontFaceHandle();
+		REQUIRE(handle);
+
+		// The prior character must be part of the key, as the width of a string depends on its kerning with the prior character.
+		FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+		for (int i = 0; i < 2; i++)
+		{
+			for (const char* word : {"V", "ea", "ello", "onderful"})
+			{
+				for (const char* prior : {"A", "T", "H", "W"})
+				{
+					const int combined_width = font_engine_interface->GetStringWidth(handle, prior + String(word));
+					const int prior_width = font_engine_interface->GetStringWidth(handle, prior);
+					CHECK(font_engine_interface->GetStringWidth(handle, word, Character(prior[0])) == combined_width - prior_width);
+				}
+			}
+		}
+
+		document->Close();
+		context->Update();
+	}
+}
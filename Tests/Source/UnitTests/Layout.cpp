@@ -26,6 +26,7 @@
  *
  */
 
+#include "../../../Source/Core/LayoutEngine.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
@@ -139,3 +140,246 @@ TEST_CASE("Layout.Position.Relative")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_relayout_boundary_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 600px;
+			height: 400px;
+			top: 50px;
+			left: 50px;
+			font-family: LatoLatin;
+			font-size: 14px;
+		}
+		#flex { display: flex; flex-wrap: wrap; }
+		.item { width: 120px; height: 60px; margin: 5px; }
+		.content_item { margin: 5px; }
+		.absolute { position: absolute; right: 10px; top: 10px; }
+		.inline_block { display: inline-block; }
+		.float { float: left; }
+	</style>
+</head>
+<body>
+	<div id="flex">
+		<div class="item"><p>Fixed <span id="a">%s</span></p></div>
+		<div class="item">Fixed</div>
+		<div class="content_item">Content <span id="b">%s</span></div>
+		<div class="content_item">Content</div>
+	</div>
+	<div class="absolute">Absolute <span id="c">%s</span></div>
+	<p>Text <span class="inline_block">Inline-block <span id="d">%s</span></span> text.</p>
+	<div class="float">Float <span id="e">%s</span></div>
+	<p>Text after <span id="f">%s</span></p>
+</body>
+</rml>
+)";
+
+static void CheckEqualLayout(Element* element, Element* reference)
+{
+	CAPTURE(element->GetAddress());
+	CHECK(element->GetAbsoluteOffset(BoxArea::Border) == reference->GetAbsoluteOffset(BoxArea::Border));
+	CHECK(element->GetBox().GetSize(BoxArea::Margin) == reference->GetBox().GetSize(BoxArea::Margin));
+
+	REQUIRE(element->GetNumChildren() == reference->GetNumChildren());
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		CheckEqualLayout(element->GetChild(i), reference->GetChild(i));
+}
+
+TEST_CASE("Layout.RelayoutBoundary")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	auto make_rml = [](const char* text) {
+		return CreateString(document_relayout_boundary_rml.size() + 1024, document_relayout_boundary_rml.c_str(), text, text, text, text, text, text);
+	};
+
+	const String initial_text = "short";
+	const String changed_text = "a considerably longer text which should wrap inside its box";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(make_rml(initial_text.c_str()));
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	ElementDocument* reference_document = context->LoadDocumentFromMemory(make_rml(changed_text.c_str()));
+	REQUIRE(reference_document);
+	reference_document->Show();
+	context->Update();
+
+	// Change the contents one by one, so that each change is handled by its own relayout boundary if possible.
+	for (const char* id : {"a", "b", "c", "d", "e", "f"})
+	{
+		document->GetElementById(id)->SetInnerRML(changed_text);
+		context->Update();
+	}
+
+	CheckEqualLayout(document, reference_document);
+
+	// Then change all of them during the same update.
+	for (const char* id : {"a", "b", "c", "d", "e", "f"})
+		document->GetElementById(id)->SetInnerRML(initial_text);
+	context->Update();
+	for (const char* id : {"a", "b", "c", "d", "e", "f"})
+		document->GetElementById(id)->SetInnerRML(changed_text);
+	context->Update();
+
+	CheckEqualLayout(document, reference_document);
+
+	document->Close();
+	reference_document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_cache_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: %dpx;
+			height: 400px;
+			top: 50px;
+			left: 50px;
+			font-family: LatoLatin;
+			font-size: 14px;
+		}
+		.row { display: flex; flex-wrap: wrap; }
+		.column { display: flex; flex-direction: column; height: 150px; }
+		.item { margin: 5px; }
+		table { display: table; }
+		tr { display: table-row; }
+		td { display: table-cell; }
+	</style>
+</head>
+<body>
+	<p>Header <span id="header">%s</span></p>
+	<div class="row">
+		<div class="item">Item one</div>
+		<div class="item">Item two <span id="item">%s</span></div>
+		<div class="item">A longer item three</div>
+	</div>
+	<div class="column">
+		<div class="item">Column one</div>
+		<div class="item">Column two</div>
+	</div>
+	<table>
+		<tr><td>Cell one</td><td>Cell two</td></tr>
+		<tr><td>Cell three</td><td>Cell four</td></tr>
+	</table>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Cache")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	auto make_rml = [](int width, const char* header, const char* item) {
+		return CreateString(document_layout_cache_rml.size() + 1024, document_layout_cache_rml.c_str(), width, header, item);
+	};
+
+	ElementDocument* document = context->LoadDocumentFromMemory(make_rml(600, "short", "short"));
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	auto check_reference = [&](int width, const char* header, const char* item) {
+		ElementDocument* reference_document = context->LoadDocumentFromMemory(make_rml(width, header, item));
+		REQUIRE(reference_document);
+		reference_document->Show();
+		context->Update();
+		CheckEqualLayout(document, reference_document);
+		reference_document->Close();
+		context->Update();
+	};
+
+	LayoutEngine::GetAndResetCacheStatistics();
+
+	// Changing the header reformats the document, but the unchanged flex items and table cells can reuse their previous layout.
+	document->GetElementById("header")->SetInnerRML("a somewhat longer header");
+	context->Update();
+	{
+		const LayoutEngine::CacheStatistics statistics = LayoutEngine::GetAndResetCacheStatistics();
+		CHECK(statistics.num_hits > 0);
+		check_reference(600, "a somewhat longer header", "short");
+	}
+
+	// Changing the contents of a flex item must invalidate its cached layout.
+	document->GetElementById("item")->SetInnerRML("a considerably longer text which should make the item wrap");
+	context->Update();
+	check_reference(600, "a somewhat longer header", "a considerably longer text which should make the item wrap");
+
+	// Changing the containing block must also be reflected, even if the contents are unchanged.
+	document->SetProperty("width", "300px");
+	context->Update();
+	check_reference(300, "a somewhat longer header", "a considerably longer text which should make the item wrap");
+
+	document->SetProperty("width", "600px");
+	context->Update();
+	check_reference(600, "a somewhat longer header", "a considerably longer text which should make the item wrap");
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+static const String document_layout_cache_in_flow_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			width: 600px;
+			height: 400px;
+			top: 50px;
+			left: 50px;
+		}
+		#flex { display: flex; }
+		#a { display: inline-block; }
+		#c { width: 100px; height: 20px; }
+	</style>
+</head>
+<body>
+	<div id="flex">
+		<div id="b"><div id="a"><div id="c"/></div></div>
+	</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Layout.Cache.InFlow")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_layout_cache_in_flow_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* b = document->GetElementById("b");
+	Element* a = document->GetElementById("a");
+	Element* c = document->GetElementById("c");
+
+	// The element was formatted on its own as an inline-block, now it is formatted as part of its parent's formatting context.
+	a->SetProperty("display", "block");
+	context->Update();
+	CHECK(b->GetBox().GetSize().y == 20.f);
+
+	// Its cached layout must not stop later changes to its descendants from reaching the relayout boundaries above it.
+	c->SetProperty("height", "80px");
+	context->Update();
+	CHECK(c->GetBox().GetSize().y == 80.f);
+	CHECK(a->GetBox().GetSize().y == 80.f);
+	CHECK(b->GetBox().GetSize().y == 80.f);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
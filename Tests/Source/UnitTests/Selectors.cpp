@@ -192,6 +192,45 @@ TEST_CASE("Selectors")
 		}
 	}
 
+	SUBCASE("RCSS document selectors with changing ancestors")
+	{
+		// Descendant selectors are matched against the ancestor filter, and siblings share their matching results. Make sure
+		// descendants are updated when their ancestors change.
+		const String selector_css = "#P.active p > span, .world #Z.hello, body.active :nth-child(2) { drag: drag; } ";
+		const String document_string = doc_begin + selector_css + doc_end;
+		ElementDocument* document = context->LoadDocumentFromMemory(document_string);
+		REQUIRE(document);
+
+		auto GetIds = [&]() {
+			context->Update();
+			String matching_ids;
+			GetMatchingIds(matching_ids, document);
+			if (!matching_ids.empty())
+				matching_ids.pop_back();
+			return matching_ids;
+		};
+
+		CHECK(GetIds() == "");
+
+		Element* element_p = document->GetElementById("P");
+		element_p->SetClass("active", true);
+		CHECK(GetIds() == "D0 D1 F0");
+
+		document->SetClass("active", true);
+		CHECK(GetIds() == "Y B D0 D1 F0");
+
+		element_p->SetClass("active", false);
+		document->SetClass("world", true);
+		CHECK(GetIds() == "Y Z B D1");
+
+		document->SetClass("active", false);
+		element_p->SetId("Q");
+		element_p->SetClass("active", true);
+		CHECK(GetIds() == "Z");
+
+		context->UnloadDocument(document);
+	}
+
 	SUBCASE("QuerySelector(All)")
 	{
 		const String document_string = doc_begin + doc_end;
@@ -297,3 +297,47 @@ TEST_CASE("specificity.basic")
 
 	TestsShell::ShutdownShell();
 }
+
+TEST_CASE("specificity.many_rules")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	// Enough rules to index the children of the style sheet's root node, with some selectors repeated in later rules.
+	String rcss;
+	for (int i = 0; i < 100; i++)
+		rcss += CreateString(128, ".r%d { width: %dpx; height: %dpx; }\n", i, i + 1, i + 1);
+	rcss += ".r42 { width: 7px; }\n";
+	rcss += ".r10.r20 { height: 300px; }\n";
+	rcss += ".r20 { width: 500px; height: 500px; }\n";
+
+	const String document_rml = "<rml><head><style>" + rcss + R"(</style></head>
+<body>
+	<div id="a" class="r42"/>
+	<div id="b" class="r10 r20"/>
+	<div id="c" class="r99"/>
+</body>
+</rml>)";
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* a = document->GetElementById("a");
+	CHECK(a->GetProperty<float>("width") == 7.f);
+	CHECK(a->GetProperty<float>("height") == 43.f);
+
+	Element* b = document->GetElementById("b");
+	CHECK(b->GetProperty<float>("width") == 500.f);
+	CHECK(b->GetProperty<float>("height") == 300.f);
+
+	Element* c = document->GetElementById("c");
+	CHECK(c->GetProperty<float>("width") == 100.f);
+	CHECK(c->GetProperty<float>("height") == 100.f);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,252 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <doctest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace Rml;
+
+static const String document_async_textures_rml = R"(
+<rml>
+<head>
+	<style>
+		body { left: 0; top: 0; right: 0; bottom: 0; }
+		img { display: block; }
+	</style>
+</head>
+<body>
+	<img id="a" src="icon_1.png"/>
+	<img id="b" src="icon_2.png"/>
+	<img id="c" src="icon_3.png"/>
+	<img id="d" src="icon_4.png"/>
+	<img id="e" src="icon_5.png" width="10" height="10"/>
+</body>
+</rml>
+)";
+
+// Decodes textures as a one pixel high image, with the width given by the number in its source name.
+class AsyncTexturesRenderInterface : public TestsRenderInterface {
+public:
+	bool DecodeTexture(Vector<byte>& texture_data, Vector2i& texture_dimensions, const String& source) override
+	{
+		num_decode_started += 1;
+		while (blocked)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		const size_t number_begin = source.rfind('_') + 1;
+		texture_dimensions = Vector2i(FromString(source.substr(number_begin, source.rfind('.') - number_begin), 0), 1);
+		texture_data.resize(4 * texture_dimensions.x, 255);
+
+		num_decoded += 1;
+		return true;
+	}
+
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions) override
+	{
+		TestsRenderInterface::GenerateTexture(texture_handle, source, source_dimensions);
+		generated_widths.push_back(source_dimensions.x);
+		texture_handle = TextureHandle(100 + source_dimensions.x);
+		return true;
+	}
+
+	void WaitForDecoded(int num)
+	{
+		for (int i = 0; i < 5000 && num_decoded < num; i++)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		REQUIRE(num_decoded == num);
+	}
+
+	std::atomic<int> num_decode_started{0};
+	std::atomic<int> num_decoded{0};
+	std::atomic<bool> blocked{false};
+	Vector<int> generated_widths;
+};
+
+class LoadListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override { loaded_ids.push_back(event.GetCurrentElement()->GetId()); }
+	StringList loaded_ids;
+};
+
+TEST_CASE("texture_loader")
+{
+	TestsSystemInterface system_interface;
+	AsyncTexturesRenderInterface render_interface;
+
+	SetRenderInterface(&render_interface);
+	SetSystemInterface(&system_interface);
+
+	Rml::Initialise();
+
+	Context* context = Rml::CreateContext("main", Vector2i(1024, 768));
+	REQUIRE(context);
+
+	LoadListener listener;
+
+	auto LoadDocument = [&]() {
+		ElementDocument* document = context->LoadDocumentFromMemory(document_async_textures_rml);
+		REQUIRE(document);
+		for (const char* id : {"a", "b", "c", "d", "e"})
+			document->GetElementById(id)->AddEventListener(EventId::Load, &listener);
+		document->Show();
+		return document;
+	};
+
+	SUBCASE("budget_and_order")
+	{
+		// Only generate a single texture per update.
+		SetAsyncTextureLoading(1);
+		render_interface.blocked = true;
+
+		ElementDocument* document = LoadDocument();
+		context->Update();
+		render_interface.EnableGeometryRecording(true);
+		context->Render();
+
+		// Nothing is rendered while loading, and the images without a size are empty.
+		CHECK(render_interface.GetRecordedTriangles().empty());
+		CHECK(render_interface.GetCounters().load_texture == 0);
+		CHECK(document->GetElementById("a")->GetClientWidth() == 0.f);
+
+		render_interface.blocked = false;
+		render_interface.WaitForDecoded(5);
+		CHECK(render_interface.generated_widths.empty());
+
+		// Textures are generated in the order they were requested, first during layout, then during render.
+		for (int i = 1; i <= 5; i++)
+		{
+			context->Update();
+			CHECK(render_interface.generated_widths.size() == size_t(i));
+			CHECK(listener.loaded_ids.size() == size_t(i));
+		}
+		CHECK(render_interface.generated_widths == Vector<int>{1, 2, 3, 4, 5});
+		CHECK(listener.loaded_ids == StringList{"a", "b", "c", "d", "e"});
+
+		// The images are sized by their textures once loaded.
+		CHECK(document->GetElementById("a")->GetClientWidth() == 1.f);
+		CHECK(document->GetElementById("d")->GetClientWidth() == 4.f);
+
+		render_interface.ResetRecordedTriangles();
+		context->Render();
+		CHECK(render_interface.GetRecordedTriangles().size() == 2 * 5);
+		CHECK(render_interface.GetCounters().load_texture == 0);
+		render_interface.EnableGeometryRecording(false);
+
+		// A larger budget generates several textures at once.
+		document->Close();
+		ReleaseTextures();
+		render_interface.generated_widths.clear();
+		SetAsyncTextureLoading(100);
+		render_interface.blocked = true;
+
+		LoadDocument();
+		context->Update();
+		context->Render();
+		render_interface.blocked = false;
+		render_interface.WaitForDecoded(10);
+		context->Update();
+		CHECK(render_interface.generated_widths == Vector<int>{1, 2, 3, 4, 5});
+	}
+
+	SUBCASE("cancel")
+	{
+		SetAsyncTextureLoading(1);
+		render_interface.blocked = true;
+
+		ElementDocument* document = LoadDocument();
+		context->Update();
+		context->Render();
+
+		for (int i = 0; i < 5000 && render_interface.num_decode_started == 0; i++)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		REQUIRE(render_interface.num_decode_started > 0);
+
+		// Remove all but the last image while they are being loaded.
+		for (const char* id : {"a", "b", "c", "d"})
+		{
+			Element* element = document->GetElementById(id);
+			element->GetParentNode()->RemoveChild(element);
+		}
+		context->Update();
+
+		render_interface.blocked = false;
+		for (int i = 0; i < 5000 && render_interface.generated_widths.empty(); i++)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			context->Update();
+		}
+
+		// Only the texture of the remaining image is generated.
+		CHECK(render_interface.generated_widths == Vector<int>{5});
+		CHECK(listener.loaded_ids == StringList{"e"});
+		CHECK(render_interface.num_decoded <= 5);
+	}
+
+	SUBCASE("placeholder")
+	{
+		SetAsyncTextureLoading(1, "placeholder.png");
+		render_interface.blocked = true;
+
+		LoadDocument();
+		context->Update();
+		render_interface.EnableGeometryRecording(true);
+		context->Render();
+
+		// The placeholder is loaded directly, and rendered in place of the images.
+		CHECK(render_interface.GetCounters().load_texture == 1);
+		CHECK(render_interface.GetRecordedTriangles().size() == 2 * 5);
+		for (const TestsRenderInterface::Triangle& triangle : render_interface.GetRecordedTriangles())
+			CHECK(triangle.texture == TextureHandle(1));
+
+		render_interface.blocked = false;
+		render_interface.WaitForDecoded(5);
+		context->Update();
+		context->Update();
+		context->Update();
+		context->Update();
+		context->Update();
+
+		render_interface.ResetRecordedTriangles();
+		context->Render();
+		CHECK(render_interface.GetRecordedTriangles().size() == 2 * 5);
+		for (const TestsRenderInterface::Triangle& triangle : render_interface.GetRecordedTriangles())
+			CHECK(triangle.texture != TextureHandle(1));
+		render_interface.EnableGeometryRecording(false);
+	}
+
+	Rml::Shutdown();
+}